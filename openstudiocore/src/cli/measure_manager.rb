@@ -136,7 +136,7 @@ class MeasureManager
       force_reload = true
     end
 
-    current_checksum = OpenStudio::checksum(OpenStudio::toPath(osm_path))
+    current_checksum = OpenStudio::cachedChecksum(OpenStudio::toPath(osm_path))
 
     result = nil
     if !force_reload
@@ -193,7 +193,7 @@ class MeasureManager
       force_reload = true
     end
 
-    current_checksum = OpenStudio::checksum(OpenStudio::toPath(idf_path))
+    current_checksum = OpenStudio::cachedChecksum(OpenStudio::toPath(idf_path))
 
     result = nil
     if !force_reload
@@ -913,12 +913,25 @@ class Run
       run_options[:preserve_run_dir] = true
     end
 
+    # reuse checksums of measure files from earlier runs of this workflow, files are only checksummed
+    # again if their size or last write time has changed
+    run_dir = nil
+    workflow = OpenStudio::WorkflowJSON.load(OpenStudio::toPath(osw_path))
+    if workflow.is_initialized
+      run_dir = workflow.get.absoluteRunDir
+      OpenStudio::loadChecksumCache(run_dir)
+    end
+
     $logger.debug "Initializing run method"
     k = OpenStudio::Workflow::Run.new osw_path, run_options
 
     $logger.debug "Beginning run"
     k.run
 
+    if run_dir && File.directory?(run_dir.to_s)
+      $logger.warn "Could not save checksum cache to #{run_dir}" unless OpenStudio::saveChecksumCache(run_dir)
+    end
+
     0
   end
 end
@@ -29,19 +29,176 @@
 
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
 #include <boost/algorithm/string.hpp>
+#include <boost/optional.hpp>
+
+#include <cctype>
+#include <iterator>
 
 namespace openstudio {
 namespace energyplus {
 
+  namespace detail {
+
+    bool isSpace(char c)
+    {
+      return std::isspace(static_cast<unsigned char>(c)) != 0;
+    }
+
+    size_t skipSpaces(const std::string& line, size_t i)
+    {
+      while (i < line.size() && isSpace(line[i])){
+        ++i;
+      }
+      return i;
+    }
+
+    // matches "** <type> ** <rest>" starting at i
+    bool matchMessageHeader(const std::string& line, size_t i, std::string& type, std::string& rest)
+    {
+      if (line.compare(i, 2, "**") != 0){
+        return false;
+      }
+      i = skipSpaces(line, i + 2);
+
+      size_t typeBegin = i;
+      while (i < line.size() && !isSpace(line[i]) && line[i] != '*'){
+        ++i;
+      }
+      if (i == typeBegin){
+        return false;
+      }
+      size_t typeEnd = i;
+
+      i = skipSpaces(line, i);
+      if (line.compare(i, 2, "**") != 0){
+        return false;
+      }
+
+      type = line.substr(typeBegin, typeEnd - typeBegin);
+      rest = line.substr(i + 2);
+      return true;
+    }
+
+    // equivalent to regex "^\s*\**\s+\*\*\s*([^\s\*]+)\s*\*\*(.*)$", type is matches[1] and rest is matches[2]
+    bool matchWarningOrError(const std::string& line, std::string& type, std::string& rest)
+    {
+      size_t begin = skipSpaces(line, 0);
+
+      // leading whitespace then "**"
+      if (begin > 0 && matchMessageHeader(line, begin, type, rest)){
+        return true;
+      }
+
+      // optional whitespace, a run of stars, whitespace then "**"
+      size_t i = begin;
+      while (i < line.size() && line[i] == '*'){
+        ++i;
+      }
+      size_t j = skipSpaces(line, i);
+      if (j == i){
+        return false;
+      }
+      return matchMessageHeader(line, j, type, rest);
+    }
+
+    // equivalent to regex "^\s*\*+ <text>.*", returns position after text or npos
+    size_t matchStarredLine(const std::string& line, const std::string& text)
+    {
+      size_t i = skipSpaces(line, 0);
+      size_t starsBegin = i;
+      while (i < line.size() && line[i] == '*'){
+        ++i;
+      }
+      if (i == starsBegin || line.compare(i, text.size(), text) != 0){
+        return std::string::npos;
+      }
+      return i + text.size();
+    }
+
+    bool matchCompletedSuccessful(const std::string& line)
+    {
+      if (matchStarredLine(line, " EnergyPlus Completed Successfully") != std::string::npos){
+        return true;
+      }
+
+      // ground temp completed successfully, "^\s*\*+ GroundTempCalc\S* Completed Successfully.*"
+      size_t i = matchStarredLine(line, " GroundTempCalc");
+      if (i == std::string::npos){
+        return false;
+      }
+      while (i < line.size() && !isSpace(line[i])){
+        ++i;
+      }
+      const std::string completed(" Completed Successfully");
+      return (line.compare(i, completed.size(), completed) == 0);
+    }
+
+    bool matchCompletedUnsuccessful(const std::string& line)
+    {
+      return (matchStarredLine(line, " EnergyPlus Terminated") != std::string::npos);
+    }
+
+  }
+
   /// constructor
   ErrorFile::ErrorFile(const openstudio::path& errPath)
-    : m_completed(false), m_completedSuccessfully(false)
+    : m_path(errPath), m_offset(0), m_hasPendingMessage(false), m_numNewMessages(0),
+      m_completed(false), m_completedSuccessfully(false)
   {
-    openstudio::filesystem::ifstream ifs(errPath);
-    parse(ifs);
-    ifs.close();
+    update(true);
+  }
+
+  ErrorFile::ErrorFile(const openstudio::path& errPath, std::function<void(const ErrorLevel&, const std::string&)> errorCallback)
+    : m_path(errPath), m_errorCallback(errorCallback), m_offset(0), m_hasPendingMessage(false), m_numNewMessages(0),
+      m_completed(false), m_completedSuccessfully(false)
+  {
+    update(false);
+  }
+
+  unsigned ErrorFile::update(bool endOfFile)
+  {
+    m_numNewMessages = 0;
+
+    if (!m_completed){
+      openstudio::filesystem::ifstream ifs(m_path, std::ios_base::binary);
+      if (ifs){
+        ifs.seekg(m_offset);
+
+        std::string text;
+        if (ifs){
+          text.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        }
+
+        // only parse complete lines unless the file will not grow any more
+        size_t end = endOfFile ? text.size() : text.rfind('\n');
+        if (end == std::string::npos){
+          end = 0;
+        }else if (!endOfFile){
+          end += 1;
+        }
+
+        size_t begin = 0;
+        std::string line;
+        while (begin < end && !m_completed){
+          size_t newline = text.find('\n', begin);
+          size_t lineEnd = (newline == std::string::npos || newline >= end) ? end : newline;
+          line.assign(text, begin, lineEnd - begin);
+          if (!line.empty() && line[line.size() - 1] == '\r'){
+            line.erase(line.size() - 1);
+          }
+          parseLine(line);
+          begin = (lineEnd < end) ? lineEnd + 1 : end;
+        }
+        m_offset += static_cast<std::streamoff>(begin);
+      }
+    }
+
+    if (endOfFile || m_completed){
+      flushPendingMessage();
+    }
+
+    return m_numNewMessages;
   }
 
   /// get warnings
@@ -75,94 +232,76 @@ namespace energyplus {
     return m_completedSuccessfully;
   }
 
-  void ErrorFile::parse(openstudio::filesystem::ifstream& is)
+  void ErrorFile::parseLine(const std::string& line)
   {
-    std::string line;
-
-
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError("^\\s*\\**\\s+\\*\\*\\s*([^\\s\\*]+)\\s*\\*\\*(.*)$");
-
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue("^\\s*\\**\\s+\\*\\*\\s*~~~\\s*\\*\\*(.*)$");
-
-    // completed successfully
-    boost::regex completedSuccessful("^\\s*\\*+ EnergyPlus Completed Successfully.*");
-
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful("^\\s*\\*+ GroundTempCalc\\S* Completed Successfully.*");
+//    LOG(Debug, "Parsing ErrorFile Line: " << line);
 
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful("^\\s*\\*+ EnergyPlus Terminated.*");
-
-    // repeat count
-
-
-    // read the file line by line using regexes
-    while(std::getline(is, line)){
-
-      boost::smatch matches;
-
-//      LOG(Debug, "Parsing ErrorFile Line: " << line);
+    std::string type;
+    std::string rest;
 
+    if (detail::matchWarningOrError(line, type, rest)){
+      if (m_hasPendingMessage && type == "~~~"){
+        // continuation of a multi line warning or error
+        boost::trim_right(rest);
+        m_pendingMessage += "\n" + rest;
+        return;
+      }
 
-      // parse the file
-      if (boost::regex_search(line, matches, warningOrError)){
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second); boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second); boost::trim(warningOrErrorString);
+      flushPendingMessage();
 
-        // read the rest of the multi line warning or error
-        while(true){
-          std::streampos pos = is.tellg();
-          if (!std::getline(is, line)){
-            break;
-          }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)){
-            std::string temp = std::string(matches[1].first, matches[1].second); boost::trim_right(temp);
-            warningOrErrorString += "\n" + temp;
-          }else{
-            // unget the line
-            is.seekg(pos);
-            break;
-          }
-        }
+      boost::trim(type);
+      boost::trim(rest);
+      m_hasPendingMessage = true;
+      m_pendingType = type;
+      m_pendingMessage = rest;
+      return;
+    }
 
-        LOG(Trace, "Error parsed: " << warningOrErrorString);
+    flushPendingMessage();
 
+    if (detail::matchCompletedSuccessful(line)){
+      m_completed = true;
+      m_completedSuccessfully = true;
+    }else if (detail::matchCompletedUnsuccessful(line)){
+      m_completed = true;
+      m_completedSuccessfully = false;
+    }
+  }
 
-        // correctly sort warnings and errors
-        try{
-          ErrorLevel level(warningOrErrorType);
+  void ErrorFile::flushPendingMessage()
+  {
+    if (!m_hasPendingMessage){
+      return;
+    }
+    m_hasPendingMessage = false;
 
-          switch(level.value()){
-            case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Severe:
-              m_severeErrors.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Fatal:
-              m_fatalErrors.push_back(warningOrErrorString);
-              break;
-          }
+    LOG(Trace, "Error parsed: " << m_pendingMessage);
 
-        }catch(...){
-          LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
-        }
+    // correctly sort warnings and errors
+    boost::optional<ErrorLevel> level;
+    try{
+      level = ErrorLevel(m_pendingType);
+    }catch(...){
+      LOG(Error, "Unknown warning or error level '" << m_pendingType << "'");
+      return;
+    }
 
-      }else if (boost::regex_match(line, completedSuccessful)
-                || boost::regex_match(line, groundTempCompletedSuccessful)) {
-        m_completed = true;
-        m_completedSuccessfully = true;
+    switch(level->value()){
+      case ErrorLevel::Warning:
+        m_warnings.push_back(m_pendingMessage);
         break;
-      }else if (boost::regex_match(line, completedUnsuccessful)){
-        m_completed = true;
-        m_completedSuccessfully = false;
+      case ErrorLevel::Severe:
+        m_severeErrors.push_back(m_pendingMessage);
+        break;
+      case ErrorLevel::Fatal:
+        m_fatalErrors.push_back(m_pendingMessage);
         break;
-      }
     }
 
+    ++m_numNewMessages;
+    if (m_errorCallback){
+      m_errorCallback(*level, m_pendingMessage);
+    }
   }
 
 } // energyplus
@@ -37,6 +37,7 @@
 #include "../utilities/core/Logger.hpp"
 
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -53,9 +54,17 @@ namespace energyplus {
   class ENERGYPLUS_API ErrorFile {
    public:
 
-    /// constructor
+    /// constructor, parses the complete file
     ErrorFile(const openstudio::path& errPath);
 
+    /// constructor for a file that may still be written by a running simulation, parses the lines written so far
+    /// and calls errorCallback for each warning, severe or fatal error, call update to parse lines appended later
+    ErrorFile(const openstudio::path& errPath, std::function<void(const ErrorLevel&, const std::string&)> errorCallback);
+
+    /// parse lines appended to the file since the last update, pass endOfFile once the simulation has exited so that a
+    /// trailing line without newline and the last multi line message are also parsed, returns number of new messages
+    unsigned update(bool endOfFile = false);
+
     /// get warnings
     std::vector<std::string> warnings() const;
 
@@ -75,7 +84,21 @@ namespace energyplus {
 
     REGISTER_LOGGER("energyplus.ErrorFile");
 
-    void parse(openstudio::filesystem::ifstream& is);
+    void parseLine(const std::string& line);
+
+    void flushPendingMessage();
+
+    openstudio::path m_path;
+    std::function<void(const ErrorLevel&, const std::string&)> m_errorCallback;
+
+    // bytes of the file parsed so far, always at the start of a line
+    std::streamoff m_offset;
+
+    // warning or error whose continuation lines may not have been written yet
+    bool m_hasPendingMessage;
+    std::string m_pendingType;
+    std::string m_pendingMessage;
+    unsigned m_numNewMessages;
 
     std::vector<std::string> m_warnings;
     std::vector<std::string> m_severeErrors;
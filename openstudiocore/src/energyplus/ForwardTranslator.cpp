@@ -175,6 +175,11 @@ void ForwardTranslator::setExcludeLCCObjects(bool excludeLCCObjects)
   m_excludeLCCObjects = excludeLCCObjects;
 }
 
+void ForwardTranslator::setScheduleFileDirectory(const openstudio::path& directory)
+{
+  m_scheduleFileDirectory = directory;
+}
+
 Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool fullModelTranslation )
 {
   reset();
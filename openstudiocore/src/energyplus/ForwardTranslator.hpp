@@ -36,6 +36,7 @@
 #include "../model/HVACComponent.hpp"
 #include "../utilities/idf/Workspace.hpp"
 #include "../utilities/core/Logger.hpp"
+#include "../utilities/core/Path.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 #include "../utilities/time/Time.hpp"
 
@@ -488,6 +489,12 @@ class ENERGYPLUS_API ForwardTranslator {
     */
   void setExcludeLCCObjects(bool excludeLCCObjects);
 
+  /** If directory is not empty, ScheduleFixedInterval values are written to CSV files in directory and
+    * translated to Schedule:File rather than Schedule:Compact, which keeps long schedules out of the IDF.
+    * Schedules that cannot be expressed as a single year of evenly divided hourly data fall back to Schedule:Compact.
+   */
+  void setScheduleFileDirectory(const openstudio::path& directory);
+
  private:
 
   REGISTER_LOGGER("openstudio.energyplus.ForwardTranslator");
@@ -1072,6 +1079,8 @@ class ENERGYPLUS_API ForwardTranslator {
 
   boost::optional<IdfObject> translateScheduleFixedInterval( model::ScheduleFixedInterval & modelObject );
 
+  boost::optional<IdfObject> translateScheduleFixedIntervalToScheduleFile( model::ScheduleFixedInterval & modelObject );
+
   boost::optional<IdfObject> translateScheduleFile( model::ScheduleFile & modelObject );
 
   boost::optional<IdfObject> translateScheduleRuleset( model::ScheduleRuleset & modelObject );
@@ -1428,6 +1437,8 @@ class ENERGYPLUS_API ForwardTranslator {
   bool m_ipTabularOutput;
 
   bool m_excludeLCCObjects;
+
+  openstudio::path m_scheduleFileDirectory;
 };
 
 namespace detail
@@ -35,13 +35,19 @@
 #include "../../model/ScheduleFixedInterval_Impl.hpp"
 
 #include "../../utilities/data/TimeSeries.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/core/UUID.hpp"
 
 #include <utilities/idd/Schedule_Compact_FieldEnums.hxx>
+#include <utilities/idd/Schedule_File_FieldEnums.hxx>
 
 #include "../../utilities/idd/IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
 
+#include <iomanip>
+#include <limits>
+
 using namespace openstudio::model;
 
 using namespace std;
@@ -70,8 +76,99 @@ static unsigned addUntil(IdfObject &idfObject,unsigned fieldIndex,int hours,int
   return fieldIndex;
 }
 
+boost::optional<IdfObject> ForwardTranslator::translateScheduleFixedIntervalToScheduleFile( ScheduleFixedInterval & modelObject )
+{
+  // Schedule:File reads one value per item starting at 01/01 00:00 for a full non-leap year
+  double intervalLength = modelObject.intervalLength();
+  int minutesPerItem = static_cast<int>(intervalLength);
+  if ((minutesPerItem < 1) || (minutesPerItem > 60) || (minutesPerItem != intervalLength) || (60 % minutesPerItem != 0)){
+    return boost::none;
+  }
+
+  const Vector& values = modelObject.getImpl<model::detail::ScheduleFixedInterval_Impl>()->values();
+  if (values.empty()){
+    return boost::none;
+  }
+
+  Date startDate(openstudio::MonthOfYear(modelObject.startMonth()), modelObject.startDay());
+  unsigned itemsPerDay = 24 * 60 / minutesPerItem;
+  unsigned numItems = 365 * itemsPerDay;
+  unsigned firstItem = (startDate.dayOfYear() - 1) * itemsPerDay;
+  if (firstItem + values.size() > numItems){
+    return boost::none;
+  }
+
+  try {
+    if (!exists(m_scheduleFileDirectory)){
+      openstudio::filesystem::create_directories(m_scheduleFileDirectory);
+    }
+  } catch (std::exception& e) {
+    LOG(Error, "Cannot create schedule file directory \"" << toString(m_scheduleFileDirectory) << "\": " << e.what()
+               << ", '" << modelObject.name().get() << "' will be translated to Schedule:Compact");
+    return boost::none;
+  }
+
+  path filePath = m_scheduleFileDirectory / toPath(removeBraces(modelObject.handle()) + ".csv");
+  openstudio::filesystem::ofstream file(filePath);
+  if (!file.is_open()){
+    LOG(Warn, "Cannot write \"" << toString(filePath) << "\", '" << modelObject.name().get() << "' will be translated to Schedule:Compact");
+    return boost::none;
+  }
+
+  // items outside the schedule get the out of range value, as they would from timeSeries()
+  double outOfRangeValue = modelObject.outOfRangeValue();
+  // enough digits that every value reads back exactly
+  file << std::setprecision(std::numeric_limits<double>::max_digits10);
+  for (unsigned i = 0; i < firstItem; ++i){
+    file << outOfRangeValue << '\n';
+  }
+  for (const double value : values){
+    file << value << '\n';
+  }
+  for (unsigned i = firstItem + values.size(); i < numItems; ++i){
+    file << outOfRangeValue << '\n';
+  }
+  file.close();
+
+  IdfObject idfObject( openstudio::IddObjectType::Schedule_File );
+
+  idfObject.setName(modelObject.name().get());
+
+  boost::optional<ScheduleTypeLimits> scheduleTypeLimits = modelObject.scheduleTypeLimits();
+  if (scheduleTypeLimits){
+    boost::optional<IdfObject> idfScheduleTypeLimits = translateAndMapModelObject(*scheduleTypeLimits);
+    if (idfScheduleTypeLimits){
+      idfObject.setString(Schedule_FileFields::ScheduleTypeLimitsName, idfScheduleTypeLimits->name().get());
+    }
+  }
+
+  idfObject.setString(Schedule_FileFields::FileName, toString(system_complete(filePath)));
+  idfObject.setInt(Schedule_FileFields::ColumnNumber, 1);
+  idfObject.setInt(Schedule_FileFields::RowstoSkipatTop, 0);
+  idfObject.setInt(Schedule_FileFields::NumberofHoursofData, 8760);
+  idfObject.setString(Schedule_FileFields::ColumnSeparator, "Comma");
+
+  if (modelObject.interpolatetoTimestep()){
+    idfObject.setString(Schedule_FileFields::InterpolatetoTimestep, "Yes");
+  } else {
+    idfObject.setString(Schedule_FileFields::InterpolatetoTimestep, "No");
+  }
+
+  idfObject.setString(Schedule_FileFields::MinutesperItem, toString(minutesPerItem));
+
+  m_idfObjects.push_back(idfObject);
+  return idfObject;
+}
+
 boost::optional<IdfObject> ForwardTranslator::translateScheduleFixedInterval( ScheduleFixedInterval & modelObject )
 {
+  if (!m_scheduleFileDirectory.empty()){
+    boost::optional<IdfObject> idfObject = translateScheduleFixedIntervalToScheduleFile(modelObject);
+    if (idfObject){
+      return idfObject;
+    }
+  }
+
   IdfObject idfObject( openstudio::IddObjectType::Schedule_Compact );
 
   m_idfObjects.push_back(idfObject);
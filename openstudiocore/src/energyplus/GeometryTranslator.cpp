@@ -86,6 +86,8 @@
 #include "../utilities/idf/WorkspaceObject.hpp"
 #include "../utilities/idf/IdfExtensibleGroup.hpp"
 
+#include <map>
+
 
 
 using openstudio::IddObjectType;
@@ -2353,6 +2355,23 @@ namespace energyplus {
     bool result = true;
 
     Transformation buildingTransformation = this->buildingTransformation();
+    Transformation buildingTransformationInverse = buildingTransformation.inverse();
+
+    // surfaces, sub surfaces and zone shading all resolve to a zone, build each zone's combined
+    // transformation for this coordinate change once instead of once per surface
+    std::map<Handle, Transformation> zoneCoordChanges;
+    auto zoneCoordChange = [&](const WorkspaceObject& zone) -> const Transformation& {
+      auto it = zoneCoordChanges.find(zone.handle());
+      if (it == zoneCoordChanges.end()){
+        Transformation relativeToAbsolute = buildingTransformation*this->zoneTransformation(zone);
+        if (detailedCoordChange == CoordinateChange::AbsoluteToRelative){
+          it = zoneCoordChanges.insert(std::make_pair(zone.handle(), relativeToAbsolute.inverse())).first;
+        }else{
+          it = zoneCoordChanges.insert(std::make_pair(zone.handle(), relativeToAbsolute)).first;
+        }
+      }
+      return it->second;
+    };
 
     for (WorkspaceObject surface : m_workspace.getObjectsByType(IddObjectType::BuildingSurface_Detailed)){
       Point3dVector vertices = getVertices(BuildingSurface_DetailedFields::NumberofVertices + 1, surface);
@@ -2364,15 +2383,7 @@ namespace energyplus {
           continue;
         }
 
-        Transformation zoneTransformation = this->zoneTransformation(*zone);
-
-        if (detailedCoordChange == CoordinateChange::AbsoluteToRelative){
-          vertices = zoneTransformation.inverse()*buildingTransformation.inverse()*vertices;
-          setVertices(BuildingSurface_DetailedFields::NumberofVertices + 1, surface, vertices);
-        }else if(detailedCoordChange == CoordinateChange::RelativeToAbsolute){
-          vertices = buildingTransformation*zoneTransformation*vertices;
-          setVertices(BuildingSurface_DetailedFields::NumberofVertices + 1, surface, vertices);
-        }
+        setVertices(BuildingSurface_DetailedFields::NumberofVertices + 1, surface, zoneCoordChange(*zone)*vertices);
       }
     }
 
@@ -2390,14 +2401,7 @@ namespace energyplus {
           LOG(Error, "Could not find zone");
           continue;
         }
-        Transformation zoneTransformation = this->zoneTransformation(*zone);
-        if (detailedCoordChange == CoordinateChange::AbsoluteToRelative){
-          vertices = zoneTransformation.inverse()*buildingTransformation.inverse()*vertices;
-          setVertices(FenestrationSurface_DetailedFields::NumberofVertices + 1, subsurface, vertices);
-        }else if(detailedCoordChange == CoordinateChange::RelativeToAbsolute){
-          vertices = buildingTransformation*zoneTransformation*vertices;
-          setVertices(FenestrationSurface_DetailedFields::NumberofVertices + 1, subsurface, vertices);
-        }
+        setVertices(FenestrationSurface_DetailedFields::NumberofVertices + 1, subsurface, zoneCoordChange(*zone)*vertices);
       }
     }
 
@@ -2416,15 +2420,7 @@ namespace energyplus {
           continue;
         }
 
-        Transformation zoneTransformation = this->zoneTransformation(*zone);
-
-        if (detailedCoordChange == CoordinateChange::AbsoluteToRelative){
-          vertices = zoneTransformation.inverse()*buildingTransformation.inverse()*vertices;
-          setVertices(Shading_Zone_DetailedFields::NumberofVertices + 1, zoneShading, vertices);
-        }else if(detailedCoordChange == CoordinateChange::RelativeToAbsolute){
-          vertices = buildingTransformation*zoneTransformation*vertices;
-          setVertices(Shading_Zone_DetailedFields::NumberofVertices + 1, zoneShading, vertices);
-        }
+        setVertices(Shading_Zone_DetailedFields::NumberofVertices + 1, zoneShading, zoneCoordChange(*zone)*vertices);
       }
     }
 
@@ -2433,7 +2429,7 @@ namespace energyplus {
       buildingShading.setString(Shading_Building_DetailedFields::NumberofVertices, "Autocalculate");
       if (detailedCoordChange != CoordinateChange::NoChange){
         if (detailedCoordChange == CoordinateChange::AbsoluteToRelative){
-          vertices = buildingTransformation.inverse()*vertices;
+          vertices = buildingTransformationInverse*vertices;
           setVertices(Shading_Building_DetailedFields::NumberofVertices + 1, buildingShading, vertices);
         }else if(detailedCoordChange == CoordinateChange::RelativeToAbsolute){
           vertices = buildingTransformation*vertices;
@@ -2489,8 +2485,8 @@ namespace energyplus {
   {
     bool result = true;
 
-    // delete current fields, cannot currently delete all so leave first 3 vertices
-    while( !surface.popExtensibleGroup().empty() )
+    // reuse the existing vertex fields, only removing or adding the difference
+    while( ((surface.numFields()-firstVertex)/3 > vertices.size()) && !surface.popExtensibleGroup().empty() )
     {}
 
     // preallocate enough space for all vertices
@@ -38,8 +38,11 @@
 #include "../utilities/idf/ValidityReport.hpp"
 #include "../utilities/idd/IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
+#include <utilities/idd/IddFactory.hxx>
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Compare.hpp"
+#include "../utilities/core/ParallelFor.hpp"
 #include "../utilities/plot/ProgressBar.hpp"
 
 #include <QThread>
@@ -54,6 +57,7 @@ namespace openstudio {
 namespace energyplus {
 
 ReverseTranslator::ReverseTranslator()
+  : m_progressBar(nullptr), m_bulkTranslation(false)
 {
   m_logSink.setLogLevel(Warn);
   m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
@@ -72,6 +76,8 @@ boost::optional<model::Model> ReverseTranslator::loadModel(const openstudio::pat
 
   m_untranslatedIdfObjects.clear();
 
+  m_untranslatedHandles.clear();
+
   m_logSink.resetStringStream();
 
   m_logSink.setThreadId(QThread::currentThread());
@@ -163,6 +169,8 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
 
   m_untranslatedIdfObjects.clear();
 
+  m_untranslatedHandles.clear();
+
   // if multiple runperiod objects in idf, remove them all
   vector<WorkspaceObject> runPeriods = m_workspace.getObjectsByType(IddObjectType::RunPeriod);
   if (runPeriods.size() > 1){
@@ -188,6 +196,11 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
 
   m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
 
+  if (m_bulkTranslation){
+    LOG(Trace,"Translating leaf objects in bulk.");
+    translateObjectsInBulk();
+  }
+
   // look for site object in workspace and translate if found
   LOG(Trace,"Translating Site:Location object.");
   vector<WorkspaceObject> site = m_workspace.getObjectsByType(IddObjectType::Site_Location);
@@ -258,18 +271,130 @@ std::vector<IdfObject> ReverseTranslator::untranslatedIdfObjects() const
   return m_untranslatedIdfObjects;
 }
 
-struct IdfObjectEqual {
-  explicit IdfObjectEqual(const IdfObject& target)
-    : m_target(target)
-  {}
+void ReverseTranslator::setBulkTranslation(bool bulkTranslation)
+{
+  m_bulkTranslation = bulkTranslation;
+}
 
-  bool operator()(const IdfObject& other) const
-  {
-    return (m_target == other);
+/** EnergyPlus types whose type specific translator only copies fields onto an OpenStudio object with the
+ *  same fields after its handle.  Only types without object list fields belong here, so that converted
+ *  objects never depend on anything else being translated first. */
+static std::vector<std::pair<IddObjectType, IddObjectType> > bulkTranslatableTypes()
+{
+  std::vector<std::pair<IddObjectType, IddObjectType> > candidates {
+    {IddObjectType::Material, IddObjectType::OS_Material},
+    {IddObjectType::Material_AirGap, IddObjectType::OS_Material_AirGap},
+    {IddObjectType::Material_NoMass, IddObjectType::OS_Material_NoMass},
+    {IddObjectType::Curve_Bicubic, IddObjectType::OS_Curve_Bicubic},
+    {IddObjectType::Curve_Biquadratic, IddObjectType::OS_Curve_Biquadratic},
+    {IddObjectType::Curve_Cubic, IddObjectType::OS_Curve_Cubic},
+    {IddObjectType::Curve_DoubleExponentialDecay, IddObjectType::OS_Curve_DoubleExponentialDecay},
+    {IddObjectType::Curve_ExponentialSkewNormal, IddObjectType::OS_Curve_ExponentialSkewNormal},
+    {IddObjectType::Curve_FanPressureRise, IddObjectType::OS_Curve_FanPressureRise},
+    {IddObjectType::Curve_Functional_PressureDrop, IddObjectType::OS_Curve_Functional_PressureDrop},
+    {IddObjectType::Curve_Linear, IddObjectType::OS_Curve_Linear},
+    {IddObjectType::Curve_Quadratic, IddObjectType::OS_Curve_Quadratic},
+    {IddObjectType::Curve_QuadraticLinear, IddObjectType::OS_Curve_QuadraticLinear},
+    {IddObjectType::Curve_Quartic, IddObjectType::OS_Curve_Quartic},
+    {IddObjectType::Curve_RectangularHyperbola1, IddObjectType::OS_Curve_RectangularHyperbola1},
+    {IddObjectType::Curve_RectangularHyperbola2, IddObjectType::OS_Curve_RectangularHyperbola2},
+    {IddObjectType::Curve_Sigmoid, IddObjectType::OS_Curve_Sigmoid},
+    {IddObjectType::Curve_Triquadratic, IddObjectType::OS_Curve_Triquadratic}
+  };
+
+  // guard against either idd drifting, a type whose fields no longer line up goes back to its translator
+  std::vector<std::pair<IddObjectType, IddObjectType> > result;
+  for (const auto& candidate : candidates){
+    IddObject energyPlusIdd = IddFactory::instance().getObject(candidate.first).get();
+    IddObject openStudioIdd = IddFactory::instance().getObject(candidate.second).get();
+    bool match = openStudioIdd.hasHandleField() &&
+                 !energyPlusIdd.properties().extensible && !openStudioIdd.properties().extensible &&
+                 (energyPlusIdd.numFields() + 1 == openStudioIdd.numFields());
+    for (unsigned i = 0, n = energyPlusIdd.numFields(); match && (i < n); ++i){
+      const IddField& energyPlusField = energyPlusIdd.getField(i).get();
+      const IddField& openStudioField = openStudioIdd.getField(i + 1).get();
+      match = istringEqual(energyPlusField.name(), openStudioField.name()) &&
+              energyPlusField.properties().objectLists.empty() &&
+              openStudioField.properties().objectLists.empty();
+    }
+    if (match){
+      result.push_back(candidate);
+    }
+  }
+  return result;
+}
+
+void ReverseTranslator::translateObjectsInBulk()
+{
+  static const std::vector<std::pair<IddObjectType, IddObjectType> > types = bulkTranslatableTypes();
+
+  std::vector<WorkspaceObject> sources;
+  std::vector<IddObject> targetIdds;
+  for (const auto& type : types){
+    std::vector<WorkspaceObject> objects = m_workspace.getObjectsByType(type.first);
+    if (objects.empty()){
+      continue;
+    }
+    IddObject targetIdd = IddFactory::instance().getObject(type.second).get();
+    sources.insert(sources.end(), objects.begin(), objects.end());
+    targetIdds.insert(targetIdds.end(), objects.size(), targetIdd);
+  }
+
+  if (sources.empty()){
+    return;
+  }
+
+  // converting fields only reads the (pointer free) source objects and writes new IdfObjects,
+  // so the batch can be split across threads, each index owning its slot of the output
+  std::vector<IdfObject> converted(sources.size(), IdfObject(IddObjectType::Catchall));
+  std::vector<char> valid(sources.size(), false);
+  parallelFor(sources.size(), [&sources, &targetIdds, &converted, &valid](size_t i){
+    IdfObject idfObject(targetIdds[i]);
+    for (unsigned j = 0, n = sources[i].numFields(); j < n; ++j){
+      boost::optional<std::string> value = sources[i].getString(j, false, true);
+      if (value){
+        idfObject.setString(j + 1, *value);
+      }
+    }
+    // the type specific translators start from the constructor defaults of the required fields and
+    // only keep values their setters accept, which are the idd bounds and keys, an object that is missing
+    // a required field or has a value out of bounds would come out differently so it is left to them
+    valid[i] = idfObject.isValid(StrictnessLevel::Final);
+    converted[i] = idfObject;
+  });
+
+  std::vector<WorkspaceObject> bulkSources;
+  std::vector<IdfObject> bulkObjects;
+  for (size_t i = 0; i < sources.size(); ++i){
+    if (valid[i]){
+      bulkSources.push_back(sources[i]);
+      bulkObjects.push_back(converted[i]);
+    }
+  }
+
+  if (bulkSources.size() < sources.size()){
+    LOG(Info, (sources.size() - bulkSources.size()) << " objects do not pass field validation, translating them individually.");
+  }
+
+  if (bulkSources.empty()){
+    return;
   }
 
-  IdfObject m_target;
-};
+  // one insert for the whole batch, name conflicts and validity are checked once
+  std::vector<WorkspaceObject> added = m_model.addObjects(bulkObjects);
+  if (added.size() != bulkSources.size()){
+    LOG(Warn, "Unable to add " << bulkSources.size() << " objects to the Model in bulk, translating them individually.");
+    return;
+  }
+
+  for (size_t i = 0; i < bulkSources.size(); ++i){
+    m_workspaceToModelMap.insert(make_pair(bulkSources[i].handle(), added[i].cast<ModelObject>()));
+  }
+
+  if (m_progressBar){
+    m_progressBar->setValue(m_untranslatedIdfObjects.size() + m_workspaceToModelMap.size());
+  }
+}
 
 boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(const WorkspaceObject & workspaceObject)
 {
@@ -1034,7 +1159,7 @@ boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(c
     m_workspaceToModelMap.insert(make_pair(workspaceObject.handle(), modelObject.get()));
   }else{
     if (addToUntranslated){
-      if (std::find_if(m_untranslatedIdfObjects.begin(), m_untranslatedIdfObjects.end(), IdfObjectEqual(workspaceObject.idfObject())) == m_untranslatedIdfObjects.end()){
+      if (m_untranslatedHandles.insert(workspaceObject.handle()).second){
         LOG(Trace,"Ignoring " << workspaceObject.briefDescription() << ".");
         m_untranslatedIdfObjects.push_back(workspaceObject.idfObject());
       }
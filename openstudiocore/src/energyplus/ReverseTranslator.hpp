@@ -59,6 +59,16 @@ class ENERGYPLUS_API ReverseTranslator {
   /** Get IdfObjects that were passed over by the last translation. */
   std::vector<IdfObject> untranslatedIdfObjects() const;
 
+  /** If bulkTranslation, leaf objects whose fields map one to one onto their OpenStudio counterparts
+    * (opaque materials and performance curves) are converted on worker threads and added to the Model
+    * with a single Workspace::addObjects call, which resolves names and pointers once for the whole batch.
+    * Fields are copied without going through the model object constructors and setters, so only objects
+    * that set every required field and pass final strictness validation are bulk translated, those are the
+    * objects for which constructor defaults and setter checks make no difference.  All other objects still
+    * go through their type specific translators.  Defaults to false.
+   */
+  void setBulkTranslation(bool bulkTranslation);
+
  private:
 
   REGISTER_LOGGER("openstudio.energyplus.ReverseTranslator");
@@ -79,6 +89,10 @@ class ENERGYPLUS_API ReverseTranslator {
    */
   boost::optional<model::ModelObject> translateAndMapWorkspaceObject(const WorkspaceObject & workspaceObject);
 
+  // translates the bulk translatable objects in m_workspace and adds them to m_workspaceToModelMap,
+  // objects are left for translateAndMapWorkspaceObject if the bulk add fails
+  void translateObjectsInBulk();
+
   boost::optional<model::ModelObject> translateAirLoopHVAC(const WorkspaceObject& workspaceObject);
 
   boost::optional<model::ModelObject> translateAirLoopHVACOutdoorAirSystem(const WorkspaceObject& workspaceObject);
@@ -339,9 +353,13 @@ class ENERGYPLUS_API ReverseTranslator {
 
   std::vector<IdfObject> m_untranslatedIdfObjects;
 
+  std::set<openstudio::Handle> m_untranslatedHandles;
+
   StringStreamLogSink m_logSink;
 
   ProgressBar* m_progressBar;
+
+  bool m_bulkTranslation;
 };
 
 
@@ -36,9 +36,11 @@
 
 #include <resources.hxx>
 
+#include <fstream>
 #include <sstream>
 
 using openstudio::energyplus::ErrorFile;
+using openstudio::energyplus::ErrorLevel;
 
 TEST_F(EnergyPlusFixture,ErrorFile_NoErrorsNoWarnings)
 {
@@ -114,4 +116,61 @@ TEST_F(EnergyPlusFixture,ErrorFile_WarningsAndCrash)
   EXPECT_FALSE(errorFile.completedSuccessfully());
 }
 
+TEST_F(EnergyPlusFixture,ErrorFile_Incremental)
+{
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/WarningsAndSevere.err");
+  std::string contents;
+  {
+    openstudio::filesystem::ifstream ifs(path, std::ios_base::binary);
+    ASSERT_TRUE(ifs);
+    contents.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+  }
+
+  openstudio::path tailPath = openstudio::filesystem::temp_directory_path() / openstudio::toPath("ErrorFile_Incremental.err");
+  {
+    openstudio::filesystem::ofstream ofs(tailPath, std::ios_base::binary | std::ios_base::trunc);
+  }
+
+  unsigned numWarnings = 0;
+  unsigned numSevere = 0;
+  unsigned numFatal = 0;
+  ErrorFile errorFile(tailPath, [&](const ErrorLevel& level, const std::string& message) {
+    switch (level.value()) {
+      case ErrorLevel::Warning:
+        ++numWarnings;
+        break;
+      case ErrorLevel::Severe:
+        ++numSevere;
+        break;
+      case ErrorLevel::Fatal:
+        ++numFatal;
+        break;
+    }
+  });
+  EXPECT_FALSE(errorFile.completed());
 
+  // append the file in chunks that split lines and multi line messages, as a running simulation would
+  unsigned numMessages = 0;
+  for (size_t i = 0; i < contents.size(); i += 100) {
+    {
+      openstudio::filesystem::ofstream ofs(tailPath, std::ios_base::binary | std::ios_base::app);
+      ofs << contents.substr(i, 100);
+    }
+    numMessages += errorFile.update();
+  }
+  numMessages += errorFile.update(true);
+
+  EXPECT_EQ(55u, numMessages);
+  EXPECT_EQ(46u, numWarnings);
+  EXPECT_EQ(8u, numSevere);
+  EXPECT_EQ(1u, numFatal);
+
+  ErrorFile batchErrorFile(path);
+  EXPECT_EQ(batchErrorFile.warnings(), errorFile.warnings());
+  EXPECT_EQ(batchErrorFile.severeErrors(), errorFile.severeErrors());
+  EXPECT_EQ(batchErrorFile.fatalErrors(), errorFile.fatalErrors());
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_FALSE(errorFile.completedSuccessfully());
+
+  openstudio::filesystem::remove(tailPath);
+}
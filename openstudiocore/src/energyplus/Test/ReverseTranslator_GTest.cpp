@@ -328,6 +328,130 @@ TEST_F(EnergyPlusFixture,ReverseTranslatorTest_TranslateStandardOpaqueMaterial)
 
 }
 
+TEST_F(EnergyPlusFixture,ReverseTranslatorTest_BulkTranslation)
+{
+  openstudio::Workspace workspace(openstudio::StrictnessLevel::None,openstudio::IddFileType::EnergyPlus);
+
+  openstudio::IdfObject material(openstudio::IddObjectType::Material);
+  material.setString(0, "Test Material");
+  material.setString(1, "Smooth");
+  material.setString(2, "0.012");
+  material.setString(3, "3.2");
+  material.setString(4, "2.5");
+  material.setString(5, "2.04");
+
+  openstudio::IdfObject noMass(openstudio::IddObjectType::Material_NoMass);
+  noMass.setString(0, "Test NoMass");
+  noMass.setString(1, "Rough");
+  noMass.setString(2, "3.05");
+
+  openstudio::IdfObject curve(openstudio::IddObjectType::Curve_Quadratic);
+  curve.setString(0, "Test Curve");
+  curve.setString(1, "1.0");
+  curve.setString(2, "0.5");
+  curve.setString(3, "0.25");
+  curve.setString(4, "0.0");
+  curve.setString(5, "1.0");
+
+  openstudio::IdfObject construction(openstudio::IddObjectType::Construction);
+  construction.setString(0, "Test Construction");
+  construction.setString(1, "Test Material");
+  construction.setString(2, "Test NoMass");
+
+  std::vector<IdfObject> idfObjects {material, noMass, curve, construction};
+  ASSERT_EQ(4u, workspace.addObjects(idfObjects).size());
+
+  ReverseTranslator trans;
+  trans.setBulkTranslation(true);
+  Model model = trans.translateWorkspace(workspace);
+
+  ASSERT_EQ(1u, model.getModelObjects<StandardOpaqueMaterial>().size());
+  StandardOpaqueMaterial mat = model.getModelObjects<StandardOpaqueMaterial>()[0];
+  EXPECT_EQ("Test Material", mat.nameString());
+  EXPECT_EQ("Smooth", mat.roughness());
+  EXPECT_DOUBLE_EQ(0.012, mat.thickness());
+  EXPECT_DOUBLE_EQ(3.2, mat.thermalConductivity());
+
+  ASSERT_EQ(1u, model.getModelObjects<MasslessOpaqueMaterial>().size());
+  MasslessOpaqueMaterial massless = model.getModelObjects<MasslessOpaqueMaterial>()[0];
+  EXPECT_DOUBLE_EQ(3.05, massless.thermalResistance());
+
+  ASSERT_EQ(1u, model.getObjectsByType(IddObjectType::OS_Curve_Quadratic).size());
+  WorkspaceObject osCurve = model.getObjectsByType(IddObjectType::OS_Curve_Quadratic)[0];
+  EXPECT_EQ("Test Curve", osCurve.nameString());
+  ASSERT_TRUE(osCurve.getDouble(3));
+  EXPECT_DOUBLE_EQ(0.5, osCurve.getDouble(3).get());
+
+  // the construction is translated individually and points at the bulk translated materials
+  ASSERT_EQ(1u, model.getModelObjects<Construction>().size());
+  Construction osConstruction = model.getModelObjects<Construction>()[0];
+  ASSERT_EQ(2u, osConstruction.layers().size());
+  EXPECT_EQ(mat.handle(), osConstruction.layers()[0].handle());
+  EXPECT_EQ(massless.handle(), osConstruction.layers()[1].handle());
+
+  EXPECT_TRUE(trans.untranslatedIdfObjects().empty());
+}
+
+TEST_F(EnergyPlusFixture,ReverseTranslatorTest_BulkTranslationFallback)
+{
+  openstudio::Workspace workspace(openstudio::StrictnessLevel::None,openstudio::IddFileType::EnergyPlus);
+
+  // complete material, can be bulk translated
+  openstudio::IdfObject complete(openstudio::IddObjectType::Material);
+  complete.setString(0, "Complete Material");
+  complete.setString(1, "Smooth");
+  complete.setString(2, "0.012");
+  complete.setString(3, "3.2");
+  complete.setString(4, "2.5");
+  complete.setString(5, "2.04");
+  workspace.addObject(complete);
+
+  // missing required density, translator should fill in the constructor default
+  openstudio::IdfObject missing(openstudio::IddObjectType::Material);
+  missing.setString(0, "Missing Density");
+  missing.setString(1, "Smooth");
+  missing.setString(2, "0.012");
+  missing.setString(3, "3.2");
+  missing.setString(5, "2.04");
+  workspace.addObject(missing);
+
+  // thickness out of bounds, setter should reject it
+  openstudio::IdfObject outOfBounds(openstudio::IddObjectType::Material);
+  outOfBounds.setString(0, "Negative Thickness");
+  outOfBounds.setString(1, "Smooth");
+  outOfBounds.setString(2, "-1.0");
+  outOfBounds.setString(3, "3.2");
+  outOfBounds.setString(4, "2.5");
+  outOfBounds.setString(5, "2.04");
+  workspace.addObject(outOfBounds);
+
+  ReverseTranslator bulkTrans;
+  bulkTrans.setBulkTranslation(true);
+  Model bulkModel = bulkTrans.translateWorkspace(workspace);
+
+  ReverseTranslator trans;
+  trans.setBulkTranslation(false);
+  Model model = trans.translateWorkspace(workspace);
+
+  ASSERT_EQ(3u, bulkModel.getModelObjects<openstudio::model::StandardOpaqueMaterial>().size());
+  ASSERT_EQ(3u, model.getModelObjects<openstudio::model::StandardOpaqueMaterial>().size());
+
+  for (const std::string& name : {std::string("Complete Material"), std::string("Missing Density"), std::string("Negative Thickness")}){
+    boost::optional<openstudio::model::StandardOpaqueMaterial> bulkMat = bulkModel.getModelObjectByName<openstudio::model::StandardOpaqueMaterial>(name);
+    boost::optional<openstudio::model::StandardOpaqueMaterial> mat = model.getModelObjectByName<openstudio::model::StandardOpaqueMaterial>(name);
+    ASSERT_TRUE(bulkMat);
+    ASSERT_TRUE(mat);
+    EXPECT_EQ(mat->roughness(), bulkMat->roughness());
+    EXPECT_DOUBLE_EQ(mat->thickness(), bulkMat->thickness());
+    EXPECT_DOUBLE_EQ(mat->thermalConductivity(), bulkMat->thermalConductivity());
+    EXPECT_DOUBLE_EQ(mat->density(), bulkMat->density());
+    EXPECT_DOUBLE_EQ(mat->specificHeat(), bulkMat->specificHeat());
+    EXPECT_TRUE(bulkMat->isValid(StrictnessLevel::Final));
+  }
+
+  EXPECT_LT(0.0, bulkModel.getModelObjectByName<openstudio::model::StandardOpaqueMaterial>("Negative Thickness")->thickness());
+}
+
 TEST_F(EnergyPlusFixture,ReverseTranslatorTest_TranslateConstruction)
 {
   // Initialize the workspace from a file containing a Construction and two Materials
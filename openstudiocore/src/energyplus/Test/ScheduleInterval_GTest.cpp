@@ -46,9 +46,11 @@
 #include "../../model/ScheduleVariableInterval_Impl.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
+#include <utilities/idd/Schedule_File_FieldEnums.hxx>
 
 #include <boost/regex.hpp>
 
+#include <fstream>
 #include <sstream>
 
 
@@ -1213,3 +1215,58 @@ TEST_F(EnergyPlusFixture, DISABLED_ForwardTranslator_ScheduleVariableInterval_Da
   // check that there were XX untils
   //EXPECT_EQ(864, numUntils);
 }
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_ScheduleFixedInterval_ScheduleFile)
+{
+  // 15 minute data starting on 1/2, the rest of the year is padded with the out of range value
+  Vector values = linspace(1, 96, 96);
+  TimeSeries timeseries(DateTime(Date(MonthOfYear::Jan, 2), Time(0,0,15)), Time(0,0,15), values, "");
+
+  Model model;
+
+  boost::optional<ScheduleInterval> scheduleInterval = ScheduleInterval::fromTimeSeries(timeseries, model);
+  ASSERT_TRUE(scheduleInterval);
+  boost::optional<ScheduleFixedInterval> scheduleFixedInterval = scheduleInterval->optionalCast<ScheduleFixedInterval>();
+  ASSERT_TRUE(scheduleFixedInterval);
+  EXPECT_TRUE(scheduleFixedInterval->setOutOfRangeValue(-1.0));
+
+  // packed values match the time series
+  Vector packed = scheduleFixedInterval->getImpl<detail::ScheduleFixedInterval_Impl>()->values();
+  ASSERT_EQ(96u, packed.size());
+  EXPECT_DOUBLE_EQ(1.0, packed[0]);
+  EXPECT_DOUBLE_EQ(96.0, packed[95]);
+
+  openstudio::path directory = toPath("./ForwardTranslator_ScheduleFixedInterval_ScheduleFile");
+
+  ForwardTranslator ft;
+  ft.setScheduleFileDirectory(directory);
+  Workspace workspace = ft.translateModel(model);
+
+  EXPECT_EQ(0u, workspace.getObjectsByType(IddObjectType::Schedule_Compact).size());
+  std::vector<WorkspaceObject> objects = workspace.getObjectsByType(IddObjectType::Schedule_File);
+  ASSERT_EQ(1u, objects.size());
+
+  EXPECT_EQ(15, objects[0].getInt(Schedule_FileFields::MinutesperItem).get());
+  EXPECT_EQ(8760, objects[0].getInt(Schedule_FileFields::NumberofHoursofData).get());
+
+  openstudio::path filePath = toPath(objects[0].getString(Schedule_FileFields::FileName).get());
+  ASSERT_TRUE(exists(filePath));
+
+  std::ifstream file(toString(filePath));
+  std::vector<double> fileValues;
+  double value;
+  while (file >> value){
+    fileValues.push_back(value);
+  }
+  ASSERT_EQ(8760u * 4u, fileValues.size());
+  EXPECT_DOUBLE_EQ(-1.0, fileValues[95]);
+  EXPECT_DOUBLE_EQ(1.0, fileValues[96]);
+  EXPECT_DOUBLE_EQ(96.0, fileValues[191]);
+  EXPECT_DOUBLE_EQ(-1.0, fileValues[192]);
+
+  // intervals that do not divide an hour stay in Schedule:Compact
+  EXPECT_TRUE(scheduleFixedInterval->setIntervalLength(7.0));
+  workspace = ft.translateModel(model);
+  EXPECT_EQ(1u, workspace.getObjectsByType(IddObjectType::Schedule_Compact).size());
+  EXPECT_EQ(0u, workspace.getObjectsByType(IddObjectType::Schedule_File).size());
+}
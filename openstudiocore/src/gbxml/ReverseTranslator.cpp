@@ -71,7 +71,9 @@
 
 #include <QDomDocument>
 #include <QDomElement>
+#include <QFile>
 #include <QThread>
+#include <QXmlStreamReader>
 
 namespace openstudio {
 namespace gbxml {
@@ -85,6 +87,48 @@ namespace gbxml {
     return os;
   }
 
+  // copy the element the reader is positioned at, and its subtree, into doc
+  // leaves the reader positioned at the matching end element
+  static QDomElement readElementFragment(QXmlStreamReader& xml, QDomDocument& doc)
+  {
+    QDomElement result = doc.createElement(xml.qualifiedName().toString());
+    for (const QXmlStreamAttribute& attribute : xml.attributes()){
+      result.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+    }
+
+    QDomElement current = result;
+    int depth = 1;
+    while (depth > 0 && !xml.atEnd()){
+      switch (xml.readNext()){
+        case QXmlStreamReader::StartElement:
+        {
+          QDomElement child = doc.createElement(xml.qualifiedName().toString());
+          for (const QXmlStreamAttribute& attribute : xml.attributes()){
+            child.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+          }
+          current.appendChild(child);
+          current = child;
+          ++depth;
+          break;
+        }
+        case QXmlStreamReader::EndElement:
+          current = current.parentNode().toElement();
+          --depth;
+          break;
+        case QXmlStreamReader::Characters:
+          // QDomDocument drops whitespace only text nodes by default, do the same
+          if (!xml.isWhitespace()){
+            current.appendChild(doc.createTextNode(xml.text().toString()));
+          }
+          break;
+        default:
+          break;
+      }
+    }
+
+    return result;
+  }
+
   ReverseTranslator::ReverseTranslator()
     : m_nonBaseMultiplier(1.0), m_lengthMultiplier(1.0)
   {
@@ -125,6 +169,188 @@ namespace gbxml {
   }
 
 
+  boost::optional<openstudio::model::Model> ReverseTranslator::loadModelStreaming(const openstudio::path& path, ProgressBar* progressBar)
+  {
+    m_progressBar = progressBar;
+
+    m_logSink.setThreadId(QThread::currentThread());
+
+    m_logSink.resetStringStream();
+
+    m_idToObjectMap.clear();
+
+    if (!openstudio::filesystem::exists(path)){
+      return boost::none;
+    }
+
+    // first pass, keep the small library elements (materials, constructions, schedules, zones)
+    // and the root and building headers, count everything else
+    QDomDocument libraryDoc;
+    QDomElement rootElement;
+    QDomElement buildingElement;
+    int numCampuses = 0;
+    int numBuildings = 0;
+    int numStories = 0;
+    int numSpaces = 0;
+    int numSurfaces = 0;
+    {
+      QFile file(toQString(path));
+      if (!file.open(QFile::ReadOnly)){
+        return boost::none;
+      }
+
+      QXmlStreamReader xml(&file);
+      int depth = 0;
+      int buildingDepth = -1;
+      while (!xml.atEnd()){
+        xml.readNext();
+        if (xml.isStartElement()){
+          QString name = xml.qualifiedName().toString();
+          if (depth == 0){
+            rootElement = libraryDoc.createElement(name);
+            for (const QXmlStreamAttribute& attribute : xml.attributes()){
+              rootElement.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+            }
+            libraryDoc.appendChild(rootElement);
+            ++depth;
+          } else if (name == "Material" || name == "Layer" || name == "Construction" || name == "WindowType" ||
+                     name == "Schedule" || name == "WeekSchedule" || name == "DaySchedule" || name == "Zone"){
+            rootElement.appendChild(readElementFragment(xml, libraryDoc));
+          } else if (name == "BuildingStorey"){
+            ++numStories;
+            xml.skipCurrentElement();
+          } else if (name == "Space"){
+            ++numSpaces;
+            xml.skipCurrentElement();
+          } else if (name == "Surface"){
+            ++numSurfaces;
+            xml.skipCurrentElement();
+          } else if (name == "Name" && depth == buildingDepth + 1){
+            buildingElement.appendChild(readElementFragment(xml, libraryDoc));
+          } else{
+            if (name == "Campus"){
+              ++numCampuses;
+            } else if (name == "Building"){
+              ++numBuildings;
+              buildingDepth = depth;
+              buildingElement = libraryDoc.createElement(name);
+              buildingElement.setAttribute("id", xml.attributes().value("id").toString());
+            }
+            ++depth;
+          }
+        } else if (xml.isEndElement()){
+          --depth;
+          if (depth == buildingDepth){
+            buildingDepth = -1;
+          }
+        }
+      }
+
+      if (xml.hasError()){
+        LOG(Error, "Could not parse '" << toString(path) << "': " << toString(xml.errorString()));
+        return boost::none;
+      }
+    }
+
+    openstudio::model::Model model;
+    model.setFastNaming(true);
+
+    translateUnits(rootElement);
+
+    translateLibrary(rootElement, libraryDoc, model);
+
+    OS_ASSERT(numCampuses == 1);
+    OS_ASSERT(numBuildings == 1);
+
+    model.getUniqueModelObject<openstudio::model::Facility>();
+
+    translateBuildingName(buildingElement, model);
+
+    // remaining passes translate one element at a time, in the same order as the DOM path
+    if (m_progressBar){
+      m_progressBar->setWindowTitle(toString("Translating Building Stories"));
+      m_progressBar->setMinimum(0);
+      m_progressBar->setMaximum(numStories);
+      m_progressBar->setValue(0);
+    }
+
+    streamElements(path, "BuildingStorey", [&](const QDomElement& element, const QDomDocument& doc){
+      boost::optional<model::ModelObject> story = translateBuildingStory(element, doc, model);
+      OS_ASSERT(story);
+
+      if (m_progressBar){
+        m_progressBar->setValue(m_progressBar->value() + 1);
+      }
+    });
+
+    if (m_progressBar){
+      m_progressBar->setWindowTitle(toString("Translating Spaces"));
+      m_progressBar->setMinimum(0);
+      m_progressBar->setMaximum(numSpaces);
+      m_progressBar->setValue(0);
+    }
+
+    streamElements(path, "Space", [&](const QDomElement& element, const QDomDocument& doc){
+      boost::optional<model::ModelObject> space = translateSpace(element, doc, model);
+      OS_ASSERT(space);
+
+      if (m_progressBar){
+        m_progressBar->setValue(m_progressBar->value() + 1);
+      }
+    });
+
+    if (m_progressBar){
+      m_progressBar->setWindowTitle(toString("Translating Surfaces"));
+      m_progressBar->setMinimum(0);
+      m_progressBar->setMaximum(numSurfaces);
+      m_progressBar->setValue(0);
+    }
+
+    streamElements(path, "Surface", [&](const QDomElement& element, const QDomDocument& doc){
+      try {
+        boost::optional<model::ModelObject> surface = translateSurface(element, doc, model);
+      }catch(const std::exception&){
+        LOG(Error, "Could not translate surface " << element);
+      }
+
+      if (m_progressBar){
+        m_progressBar->setValue(m_progressBar->value() + 1);
+      }
+    });
+
+    model.setFastNaming(false);
+
+    return model;
+  }
+
+  bool ReverseTranslator::streamElements(const openstudio::path& path, const QString& tagName,
+                                         const std::function<void (const QDomElement&, const QDomDocument&)>& callback)
+  {
+    QFile file(toQString(path));
+    if (!file.open(QFile::ReadOnly)){
+      return false;
+    }
+
+    QXmlStreamReader xml(&file);
+    while (!xml.atEnd()){
+      xml.readNext();
+      if (xml.isStartElement() && xml.qualifiedName() == tagName){
+        // each element gets its own document so memory is released before the next one is read
+        QDomDocument doc;
+        QDomElement element = readElementFragment(xml, doc);
+        doc.appendChild(element);
+        callback(element, doc);
+      }
+    }
+
+    if (xml.hasError()){
+      LOG(Error, "Could not parse '" << toString(path) << "': " << toString(xml.errorString()));
+      return false;
+    }
+
+    return true;
+  }
+
   std::vector<LogMessage> ReverseTranslator::warnings() const
   {
     std::vector<LogMessage> result;
@@ -171,6 +397,23 @@ namespace gbxml {
     openstudio::model::Model model;
     model.setFastNaming(true);
 
+    translateUnits(element);
+
+    translateLibrary(element, doc, model);
+
+    QDomNodeList campusElements = element.elementsByTagName("Campus");
+    OS_ASSERT(campusElements.count() == 1);
+    QDomElement campusElement = campusElements.at(0).toElement();
+    boost::optional<model::ModelObject> facility = translateCampus(campusElement, doc, model);
+    OS_ASSERT(facility); // Krishnan, what type of error handling do you want?
+
+    model.setFastNaming(false);
+
+    return model;
+  }
+
+  void ReverseTranslator::translateUnits(const QDomElement& element)
+  {
     // gbXML attributes not mapped directly to IDF, but needed to map
 
     // {F, C, K, R}
@@ -235,7 +478,10 @@ namespace gbxml {
     }else{
       m_useSIUnitsForResults = true;
     }
+  }
 
+  void ReverseTranslator::translateLibrary(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model)
+  {
     // do materials before constructions
     QDomNodeList materialElements = element.elementsByTagName("Material");
     if (m_progressBar){
@@ -331,16 +577,6 @@ namespace gbxml {
         m_progressBar->setValue(m_progressBar->value() + 1);
       }
     }
-
-    QDomNodeList campusElements = element.elementsByTagName("Campus");
-    OS_ASSERT(campusElements.count() == 1);
-    QDomElement campusElement = campusElements.at(0).toElement();
-    boost::optional<model::ModelObject> facility = translateCampus(campusElement, doc, model);
-    OS_ASSERT(facility); // Krishnan, what type of error handling do you want?
-
-    model.setFastNaming(false);
-
-    return model;
   }
 
   boost::optional<model::ModelObject> ReverseTranslator::translateCampus(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model)
@@ -377,7 +613,7 @@ namespace gbxml {
     return facility;
   }
 
-  boost::optional<model::ModelObject> ReverseTranslator::translateBuilding(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model)
+  openstudio::model::Building ReverseTranslator::translateBuildingName(const QDomElement& element, openstudio::model::Model& model)
   {
     openstudio::model::Building building = model.getUniqueModelObject<openstudio::model::Building>();
 
@@ -387,6 +623,13 @@ namespace gbxml {
     QString name = element.firstChildElement("Name").toElement().text();
     building.setName(escapeName(id, name));
 
+    return building;
+  }
+
+  boost::optional<model::ModelObject> ReverseTranslator::translateBuilding(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model)
+  {
+    openstudio::model::Building building = translateBuildingName(element, model);
+
     QDomNodeList storyElements = element.elementsByTagName("BuildingStorey");
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Building Stories"));
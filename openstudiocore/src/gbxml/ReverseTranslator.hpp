@@ -41,9 +41,12 @@
 
 #include "../utilities/units/Unit.hpp"
 
+#include <functional>
+
 class QDomDocument;
 class QDomElement;
 class QDomNodeList;
+class QString;
 
 namespace openstudio {
 
@@ -52,6 +55,7 @@ namespace openstudio {
 namespace model {
   class Model;
   class ModelObject;
+  class Building;
   class Surface;
 }
 
@@ -66,6 +70,10 @@ namespace gbxml {
 
     boost::optional<openstudio::model::Model> loadModel(const openstudio::path& path, ProgressBar* progressBar = nullptr);
 
+    /** Same result as loadModel, but reads the file with a stream reader in several passes so that only
+     *  one building element (e.g. a Space or Surface) is held in memory at a time. Use for large files. */
+    boost::optional<openstudio::model::Model> loadModelStreaming(const openstudio::path& path, ProgressBar* progressBar = nullptr);
+
     /** Get warning messages generated by the last translation. */
     std::vector<LogMessage> warnings() const;
 
@@ -90,6 +98,9 @@ namespace gbxml {
 
     boost::optional<openstudio::model::Model> convert(const QDomDocument& doc);
     boost::optional<openstudio::model::Model> translateGBXML(const QDomElement& element, const QDomDocument& doc);
+    void translateUnits(const QDomElement& element);
+    void translateLibrary(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
+    openstudio::model::Building translateBuildingName(const QDomElement& element, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateCampus(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateBuilding(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateBuildingStory(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
@@ -105,6 +116,10 @@ namespace gbxml {
     boost::optional<openstudio::model::ModelObject> translateSubSurface(const QDomElement& element, const QDomDocument& doc, openstudio::model::Surface& surface);
     boost::optional<openstudio::model::ModelObject> translateCADObjectId(const QDomElement& element, const QDomDocument& doc, openstudio::model::ModelObject& modelObject);
 
+    // stream path and call callback with each element named tagName, each in its own document
+    bool streamElements(const openstudio::path& path, const QString& tagName,
+                        const std::function<void (const QDomElement&, const QDomDocument&)>& callback);
+
     StringStreamLogSink m_logSink;
 
     ProgressBar* m_progressBar;
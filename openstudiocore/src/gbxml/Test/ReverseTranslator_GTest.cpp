@@ -52,6 +52,8 @@
 #include "../../model/SubSurface_Impl.hpp"
 #include "../../model/StandardOpaqueMaterial.hpp"
 #include "../../model/StandardOpaqueMaterial_Impl.hpp"
+#include "../../model/ConstructionBase.hpp"
+#include "../../model/ConstructionBase_Impl.hpp"
 
 #include "../../utilities/idf/Workspace.hpp"
 #include "../../utilities/core/Optional.hpp"
@@ -517,3 +519,50 @@ TEST_F(gbXMLFixture, ReverseTranslator_TwoStoryOffice_Trane)
   bool test = forwardTranslator.modelToGbXML(*model, outputPath);
   EXPECT_TRUE(test);
 }
+
+TEST_F(gbXMLFixture, ReverseTranslator_Streaming)
+{
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("gbxml/TestCube.xml");
+
+  openstudio::gbxml::ReverseTranslator reverseTranslator;
+  boost::optional<openstudio::model::Model> model = reverseTranslator.loadModel(inputPath);
+  ASSERT_TRUE(model);
+
+  openstudio::gbxml::ReverseTranslator streamingTranslator;
+  boost::optional<openstudio::model::Model> streamedModel = streamingTranslator.loadModelStreaming(inputPath);
+  ASSERT_TRUE(streamedModel);
+
+  EXPECT_EQ(model->numObjects(), streamedModel->numObjects());
+  EXPECT_EQ(model->getModelObjects<Space>().size(), streamedModel->getModelObjects<Space>().size());
+  EXPECT_EQ(model->getModelObjects<ThermalZone>().size(), streamedModel->getModelObjects<ThermalZone>().size());
+  EXPECT_EQ(model->getModelObjects<SubSurface>().size(), streamedModel->getModelObjects<SubSurface>().size());
+  EXPECT_EQ(model->getModelObjects<StandardOpaqueMaterial>().size(), streamedModel->getModelObjects<StandardOpaqueMaterial>().size());
+  EXPECT_EQ(model->getUniqueModelObject<Building>().name().get(), streamedModel->getUniqueModelObject<Building>().name().get());
+
+  std::vector<Surface> surfaces = model->getModelObjects<Surface>();
+  EXPECT_EQ(surfaces.size(), streamedModel->getModelObjects<Surface>().size());
+  for (const Surface& surface : surfaces){
+    boost::optional<Surface> streamedSurface = streamedModel->getModelObjectByName<Surface>(surface.name().get());
+    ASSERT_TRUE(streamedSurface);
+    EXPECT_EQ(surface.outsideBoundaryCondition(), streamedSurface->outsideBoundaryCondition());
+    EXPECT_EQ(surface.vertices().size(), streamedSurface->vertices().size());
+    ASSERT_TRUE(surface.space());
+    ASSERT_TRUE(streamedSurface->space());
+    EXPECT_EQ(surface.space()->name().get(), streamedSurface->space()->name().get());
+    boost::optional<ConstructionBase> construction = surface.construction();
+    boost::optional<ConstructionBase> streamedConstruction = streamedSurface->construction();
+    ASSERT_EQ(construction.is_initialized(), streamedConstruction.is_initialized());
+    if (construction){
+      EXPECT_EQ(construction->name().get(), streamedConstruction->name().get());
+    }
+  }
+
+  EXPECT_EQ(reverseTranslator.errors().size(), streamingTranslator.errors().size());
+  EXPECT_EQ(reverseTranslator.warnings().size(), streamingTranslator.warnings().size());
+}
+
+TEST_F(gbXMLFixture, ReverseTranslator_Streaming_MissingFile)
+{
+  openstudio::gbxml::ReverseTranslator reverseTranslator;
+  EXPECT_FALSE(reverseTranslator.loadModelStreaming(resourcesPath() / openstudio::toPath("gbxml/DoesNotExist.xml")));
+}
@@ -31,6 +31,8 @@
 // #endif
 
 %ignore openstudio::isomodel::mult;
+%ignore openstudio::isomodel::simulate;
+%ignore openstudio::isomodel::UserModel::simulate;
 
 %rename("terrainClass=") openstudio::isomodel::UserModel::setTerrainClass(double value);
 %rename("floorArea=") openstudio::isomodel::UserModel::setFloorArea(double value);
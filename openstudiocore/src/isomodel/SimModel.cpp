@@ -29,6 +29,10 @@
 
 #include "SimModel.hpp"
 
+#include "../utilities/core/ParallelFor.hpp"
+
+#include <algorithm>
+
 #if _DEBUG || (__GNUC__ && !NDEBUG)
 #define DEBUG_ISO_MODEL_SIMULATION
 #endif
@@ -56,6 +60,21 @@ namespace isomodel {
   }
 
 
+  std::vector<ISOResults> simulate(const std::vector<SimModel>& simModels)
+  {
+    std::vector<ISOResults> results(simModels.size());
+    if (simModels.empty()) {
+      return results;
+    }
+
+    // each model is evaluated independently
+    parallelFor(simModels.size(), [&](size_t i) {
+      results[i] = simModels[i].simulate();
+    });
+
+    return results;
+  }
+
   void SimModel::printVector(const char* vecName, const Vector &vec){
 #ifdef DEBUG_ISO_MODEL_SIMULATION
     std::stringstream ss;
@@ -366,8 +385,8 @@ namespace isomodel {
     Vector& v_Tdbt_nt) const
   {
 
-    Matrix m_mhEgh = location->weather()->mhEgh();
-    Matrix m_mhdbt = location->weather()->mhdbt();
+    const Matrix& m_mhEgh = location->weather()->mhEgh();
+    const Matrix& m_mhdbt = location->weather()->mhdbt();
 
     Vector v_Tdbt_Day = prod(m_mhdbt,clockHourOccupied);
     v_Tdbt_Day /= sum(clockHourOccupied);
@@ -249,6 +249,13 @@ namespace isomodel {
     static void printVector(const char* vecName, const Vector &vec);
     static void printMatrix(const char* matName, const Matrix &mat);
   };
+
+  /*
+   *  Runs simulate() for each of the simModels, spreading the models over the available cores.
+   *  Models built from the same UserModel share its weather data, which is only ever read.
+   *  returns one ISOResults per SimModel, in the same order and identical to calling simulate() on each
+   */
+  ISOMODEL_API std::vector<ISOResults> simulate(const std::vector<SimModel>& simModels);
 } // isomodel
 } // openstudio
 
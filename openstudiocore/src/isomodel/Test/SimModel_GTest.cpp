@@ -331,3 +331,38 @@ TEST_F(ISOModelFixture, SimModel)
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[10].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems) );
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[11].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems) );
 }
+
+TEST_F(ISOModelFixture, SimModel_Sweep)
+{
+  UserModel baseModel;
+  baseModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(baseModel.valid());
+
+  std::vector<UserModel> userModels;
+  for (unsigned i = 0; i < 8; ++i) {
+    UserModel userModel = baseModel;
+    userModel.setCoolingSystemCOP(baseModel.coolingSystemCOP() * (1.0 + 0.1 * i));
+    userModel.setLightingPowerIntensityOccupied(baseModel.lightingPowerIntensityOccupied() * (1.0 - 0.05 * i));
+    userModels.push_back(userModel);
+  }
+
+  std::vector<ISOResults> sweepResults = UserModel::simulate(userModels);
+  ASSERT_EQ(userModels.size(), sweepResults.size());
+
+  for (unsigned i = 0; i < userModels.size(); ++i) {
+    ISOResults results = userModels[i].toSimModel().simulate();
+    ASSERT_EQ(results.monthlyResults.size(), sweepResults[i].monthlyResults.size());
+    for (unsigned month = 0; month < results.monthlyResults.size(); ++month) {
+      for (const EndUseFuelType& fuelType : EndUses::fuelTypes()) {
+        for (const EndUseCategoryType& category : EndUses::categories()) {
+          EXPECT_DOUBLE_EQ(results.monthlyResults[month].getEndUse(fuelType, category),
+                           sweepResults[i].monthlyResults[month].getEndUse(fuelType, category));
+        }
+      }
+    }
+    EXPECT_DOUBLE_EQ(results.totalEnergyUse(), sweepResults[i].totalEnergyUse());
+  }
+
+  // varying the cooling COP has to show up in the results
+  EXPECT_NE(sweepResults.front().totalEnergyUse(), sweepResults.back().totalEnergyUse());
+}
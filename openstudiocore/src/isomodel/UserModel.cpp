@@ -29,11 +29,37 @@
 
 #include "UserModel.hpp"
 
+#include <map>
+
 using namespace std;
 namespace openstudio {
 namespace isomodel {
 
 
+  std::vector<ISOResults> UserModel::simulate(std::vector<UserModel>& userModels)
+  {
+    // read each weather file once and share it between the models that use it
+    std::map<openstudio::path, std::shared_ptr<WeatherData> > weatherByPath;
+    std::vector<SimModel> simModels;
+    simModels.reserve(userModels.size());
+    for (UserModel& userModel : userModels)
+    {
+      openstudio::path key = userModel._dataFile.parent_path() / userModel._weatherFilePath;
+      if (!userModel._weather)
+      {
+        auto it = weatherByPath.find(key);
+        if (it != weatherByPath.end())
+        {
+          userModel._weather = it->second;
+        }
+      }
+      simModels.push_back(userModel.toSimModel());
+      weatherByPath.insert(std::make_pair(key, userModel._weather));
+    }
+
+    return isomodel::simulate(simModels);
+  }
+
   SimModel UserModel::toSimModel()
   {
     _valid = true;
@@ -70,6 +70,14 @@ namespace isomodel {
      */
     SimModel toSimModel();
 
+    /**
+     * Simulates each of the userModels, typically copies of one loaded model with different
+     * parameters. Weather files are read once per distinct file and shared by all models that
+     * use them, then the models are simulated in parallel. Returns one ISOResults per UserModel,
+     * in the same order and identical to userModel.toSimModel().simulate()
+     */
+    static std::vector<ISOResults> simulate(std::vector<UserModel>& userModels);
+
     /**
      * Indicates whether or not the user model loaded in correctly
      * If either the ISO file or the Weather File cannot be found
@@ -0,0 +1,105 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef MODEL_AGGREGATECACHE_HPP
+#define MODEL_AGGREGATECACHE_HPP
+
+namespace openstudio {
+namespace model {
+namespace detail {
+
+  /** Memoizes the aggregate values (floor area, lighting power, ...) that Space_Impl, ThermalZone_Impl
+   *  and Building_Impl compute by walking surfaces and loads. Values stay valid until the owning Model's
+   *  aggregateRevision() changes, which happens whenever an object those aggregates depend on is added,
+   *  removed or changed. */
+  class AggregateCache {
+   public:
+
+    enum Value {
+      FloorArea,
+      ExteriorArea,
+      ExteriorWallArea,
+      Volume,
+      NumberOfPeople,
+      LightingPower,
+      ElectricEquipmentPower,
+      GasEquipmentPower,
+      InfiltrationDesignFlowRate,
+      NumValues
+    };
+
+    AggregateCache()
+      : m_revision(0)
+    {}
+
+    // copies start empty, a cloned object may live in another model
+    AggregateCache(const AggregateCache&)
+      : m_revision(0)
+    {}
+
+    AggregateCache& operator=(const AggregateCache&)
+    {
+      m_revision = 0;
+      return *this;
+    }
+
+    /** Return the cached value if it was computed at revision, otherwise compute and cache it. */
+    template <typename F>
+    double get(unsigned revision, Value value, F compute)
+    {
+      if (revision != m_revision) {
+        for (bool& valid : m_valid) {
+          valid = false;
+        }
+        m_revision = revision;
+      }
+
+      if (!m_valid[value]) {
+        // compute may recursively fill other values at the same revision
+        double result = compute();
+        m_values[value] = result;
+        m_valid[value] = true;
+      }
+
+      return m_values[value];
+    }
+
+   private:
+
+    // 0 is never a model revision
+    unsigned m_revision;
+    bool m_valid[NumValues];
+    double m_values[NumValues];
+  };
+
+} // detail
+} // model
+} // openstudio
+
+#endif // MODEL_AGGREGATECACHE_HPP
@@ -618,14 +618,16 @@ namespace detail {
 
   double Building_Impl::floorArea() const
   {
-    double result = 0;
-    for (const Space& space : spaces()){
-      bool partofTotalFloorArea = space.partofTotalFloorArea();
-      if (partofTotalFloorArea) {
-        result += space.multiplier() * space.floorArea();
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::FloorArea, [this]() {
+      double result = 0;
+      for (const Space& space : spaces()){
+        bool partofTotalFloorArea = space.partofTotalFloorArea();
+        if (partofTotalFloorArea) {
+          result += space.multiplier() * space.floorArea();
+        }
       }
-    }
-    return result;
+      return result;
+    });
   }
 
   boost::optional<double> Building_Impl::conditionedFloorArea() const
@@ -656,41 +658,49 @@ namespace detail {
   }
 
   double Building_Impl::exteriorSurfaceArea() const {
-    double result(0.0);
-    for (const Surface& surface : model().getConcreteModelObjects<Surface>()) {
-      OptionalSpace space = surface.space();
-      std::string outsideBoundaryCondition = surface.outsideBoundaryCondition();
-      if (space && openstudio::istringEqual(outsideBoundaryCondition, "Outdoors")) {
-        result += surface.grossArea() * space->multiplier();
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::ExteriorArea, [this]() {
+      double result(0.0);
+      for (const Surface& surface : model().getConcreteModelObjects<Surface>()) {
+        OptionalSpace space = surface.space();
+        std::string outsideBoundaryCondition = surface.outsideBoundaryCondition();
+        if (space && openstudio::istringEqual(outsideBoundaryCondition, "Outdoors")) {
+          result += surface.grossArea() * space->multiplier();
+        }
       }
-    }
-    return result;
+      return result;
+    });
   }
 
   double Building_Impl::exteriorWallArea() const {
-    double result(0.0);
-    for (const Surface& exteriorWall : exteriorWalls()) {
-      if (OptionalSpace space = exteriorWall.space()) {
-        result += exteriorWall.grossArea() * space->multiplier();
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::ExteriorWallArea, [this]() {
+      double result(0.0);
+      for (const Surface& exteriorWall : exteriorWalls()) {
+        if (OptionalSpace space = exteriorWall.space()) {
+          result += exteriorWall.grossArea() * space->multiplier();
+        }
       }
-    }
-    return result;
+      return result;
+    });
   }
 
   double Building_Impl::airVolume() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.volume() * space.multiplier();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::Volume, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.volume() * space.multiplier();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::numberOfPeople() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.numberOfPeople() * space.multiplier();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::NumberOfPeople, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.numberOfPeople() * space.multiplier();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::peoplePerFloorArea() const {
@@ -718,11 +728,13 @@ namespace detail {
   }
 
   double Building_Impl::lightingPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.multiplier() * space.lightingPower();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::LightingPower, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.multiplier() * space.lightingPower();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::lightingPowerPerFloorArea() const {
@@ -756,11 +768,13 @@ namespace detail {
   }
 
   double Building_Impl::electricEquipmentPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.multiplier() * space.electricEquipmentPower();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::ElectricEquipmentPower, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.multiplier() * space.electricEquipmentPower();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::electricEquipmentPowerPerFloorArea() const {
@@ -794,11 +808,13 @@ namespace detail {
   }
 
   double Building_Impl::gasEquipmentPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.multiplier() * space.gasEquipmentPower();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::GasEquipmentPower, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.multiplier() * space.gasEquipmentPower();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::gasEquipmentPowerPerFloorArea() const {
@@ -832,11 +848,13 @@ namespace detail {
   }
 
   double Building_Impl::infiltrationDesignFlowRate() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.multiplier() * space.infiltrationDesignFlowRate();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::InfiltrationDesignFlowRate, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.multiplier() * space.infiltrationDesignFlowRate();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::infiltrationDesignFlowPerSpaceFloorArea() const {
@@ -31,6 +31,7 @@
 #define MODEL_BUILDING_IMPL_HPP
 
 #include "ParentObject_Impl.hpp"
+#include "AggregateCache.hpp"
 
 #include "../utilities/units/Quantity.hpp"
 
@@ -233,6 +234,8 @@ namespace detail {
    private:
     REGISTER_LOGGER("openstudio.model.Building");
 
+    mutable AggregateCache m_aggregateCache;
+
     openstudio::Quantity northAxis_SI() const;
     openstudio::Quantity northAxis_IP() const;
     bool setNorthAxis(const Quantity& northAxis);
@@ -84,13 +84,16 @@ namespace detail {
 
   // default constructor
   Model_Impl::Model_Impl()
-    : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio)
+    : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio),
+      m_aggregateRevision(1)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
+    connectAggregateDependencies();
   }
 
   Model_Impl::Model_Impl(const IdfFile& idfFile)
-    : Workspace_Impl(idfFile,StrictnessLevel(StrictnessLevel::Draft))
+    : Workspace_Impl(idfFile,StrictnessLevel(StrictnessLevel::Draft)),
+      m_aggregateRevision(1)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
     if (iddFileType() != IddFileType::OpenStudio) {
@@ -98,11 +101,13 @@ namespace detail {
           << "data schema. (Attempted construction from IdfFile with IddFileType "
           << idfFile.iddFileType().valueDescription() << ".)");
     }
+    connectAggregateDependencies();
   }
 
   Model_Impl::Model_Impl(const openstudio::detail::Workspace_Impl& workspace,
                          bool keepHandles)
-    : openstudio::detail::Workspace_Impl(workspace,keepHandles)
+    : openstudio::detail::Workspace_Impl(workspace,keepHandles),
+      m_aggregateRevision(1)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
     if (iddFileType() != IddFileType::OpenStudio) {
@@ -110,16 +115,19 @@ namespace detail {
         << "data schema. (Attempted construction from Workspace with IddFileType "
         << workspace.iddFileType().valueDescription() << ".)");
     }
+    connectAggregateDependencies();
   }
 
   // copy constructor, used for clone
   Model_Impl::Model_Impl(const Model_Impl& other, bool keepHandles)
     : Workspace_Impl(other, keepHandles),
       m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile)),
-      m_workflowJSON(WorkflowJSON(other.m_workflowJSON))
+      m_workflowJSON(WorkflowJSON(other.m_workflowJSON)),
+      m_aggregateRevision(1)
   {
     // notice we are cloning the workflow and sqlfile too, if necessary
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
+    connectAggregateDependencies();
   }
 
   // copy constructor used for cloneSubset
@@ -129,9 +137,11 @@ namespace detail {
                          StrictnessLevel level)
     : Workspace_Impl(other,hs,keepHandles,level),
       m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile)),
-      m_workflowJSON(WorkflowJSON(other.m_workflowJSON))
+      m_workflowJSON(WorkflowJSON(other.m_workflowJSON)),
+      m_aggregateRevision(1)
   {
     // notice we are cloning the workflow and sqlfile too, if necessary
+    connectAggregateDependencies();
   }
   Workspace Model_Impl::clone(bool keepHandles) const {
     // copy everything but objects
@@ -487,6 +497,11 @@ namespace detail {
     return m_cachedWeatherFile;
   }
 
+  unsigned Model_Impl::aggregateRevision() const
+  {
+    return m_aggregateRevision;
+  }
+
   Schedule Model_Impl::alwaysOffDiscreteSchedule() const
   {
     std::string alwaysOffName = this->alwaysOffDiscreteScheduleName();
@@ -978,6 +993,72 @@ namespace detail {
     }
   }
 
+  // types that Space, ThermalZone and Building aggregates are computed from, directly or through
+  // surface constructions (air walls), space types, zone multipliers and plenums
+  static bool isAggregateDependency(const IddObjectType& type)
+  {
+    switch (type.value()) {
+      case IddObjectType::OS_Building:
+      case IddObjectType::OS_BuildingStory:
+      case IddObjectType::OS_Space:
+      case IddObjectType::OS_SpaceType:
+      case IddObjectType::OS_ThermalZone:
+      case IddObjectType::OS_Surface:
+      case IddObjectType::OS_People:
+      case IddObjectType::OS_People_Definition:
+      case IddObjectType::OS_Lights:
+      case IddObjectType::OS_Lights_Definition:
+      case IddObjectType::OS_Luminaire:
+      case IddObjectType::OS_Luminaire_Definition:
+      case IddObjectType::OS_ElectricEquipment:
+      case IddObjectType::OS_ElectricEquipment_Definition:
+      case IddObjectType::OS_GasEquipment:
+      case IddObjectType::OS_GasEquipment_Definition:
+      case IddObjectType::OS_SpaceInfiltration_DesignFlowRate:
+      case IddObjectType::OS_DefaultConstructionSet:
+      case IddObjectType::OS_DefaultSurfaceConstructions:
+      case IddObjectType::OS_Construction:
+      case IddObjectType::OS_Construction_InternalSource:
+      case IddObjectType::OS_Material_AirWall:
+      case IddObjectType::OS_AirLoopHVAC_ReturnPlenum:
+      case IddObjectType::OS_AirLoopHVAC_SupplyPlenum:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  void Model_Impl::connectAggregateDependencies()
+  {
+    this->addWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::aggregateDependencyAdded>(this);
+    this->removeWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::aggregateDependencyRemoved>(this);
+  }
+
+  void Model_Impl::aggregateDependencyAdded(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const IddObjectType& type, const UUID& handle)
+  {
+    if (isAggregateDependency(type)){
+      object.get()->onChange.connect<Model_Impl, &Model_Impl::incrementAggregateRevision>(this);
+      incrementAggregateRevision();
+    }
+  }
+
+  void Model_Impl::aggregateDependencyRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const IddObjectType& type, const UUID& handle)
+  {
+    if (isAggregateDependency(type)){
+      object.get()->onChange.disconnect<Model_Impl, &Model_Impl::incrementAggregateRevision>(this);
+      incrementAggregateRevision();
+    }
+  }
+
+  void Model_Impl::incrementAggregateRevision()
+  {
+    ++m_aggregateRevision;
+    if (m_aggregateRevision == 0){
+      // 0 is reserved for empty caches
+      m_aggregateRevision = 1;
+    }
+  }
+
   void Model_Impl::clearCachedData()
   {
     Handle dummy;
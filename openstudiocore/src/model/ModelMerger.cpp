@@ -63,6 +63,7 @@
 #include "DaylightingControl.hpp"
 #include "DaylightingControl_Impl.hpp"
 #include "AdditionalProperties.hpp"
+#include "ParentObject.hpp"
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Compare.hpp"
@@ -76,6 +77,9 @@
 
 #include <QThread>
 
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
 #include <cmath>
 #include <tuple>
 
@@ -84,6 +88,33 @@ namespace openstudio
   namespace model
   {
 
+    namespace {
+
+      // hash of the fields of an object and its recursive children, handles are skipped since they change on every
+      // round trip, pointer fields contribute the name of their target and children are combined independent of order
+      size_t contentHash(const ParentObject& object)
+      {
+        std::vector<size_t> objectHashes;
+        for (const ModelObject& child : getRecursiveChildren(object)){
+          size_t hash = 0;
+          boost::hash_combine(hash, child.iddObjectType().value());
+          unsigned start = child.iddObject().hasHandleField() ? 1 : 0;
+          for (unsigned i = start; i < child.numFields(); ++i){
+            boost::hash_combine(hash, child.getString(i).get_value_or(""));
+          }
+          objectHashes.push_back(hash);
+        }
+        std::sort(objectHashes.begin(), objectHashes.end());
+
+        size_t result = 0;
+        for (size_t hash : objectHashes){
+          boost::hash_combine(result, hash);
+        }
+        return result;
+      }
+
+    }
+
     ModelMerger::ModelMerger()
     {
       // DLM: TODO expose this to user to give more control over merging?
@@ -880,6 +911,21 @@ namespace openstudio
 
     void ModelMerger::mergeModels(Model& currentModel, const Model& newModel, const std::map<UUID, UUID>& handleMapping)
     {
+      mergeModels(currentModel, newModel, handleMapping, false);
+    }
+
+    void ModelMerger::mergeModelsIncremental(Model& currentModel, const Model& newModel, const std::map<UUID, UUID>& handleMapping)
+    {
+      mergeModels(currentModel, newModel, handleMapping, true);
+    }
+
+    void ModelMerger::mergeModels(Model& currentModel, const Model& newModel, const std::map<UUID, UUID>& handleMapping, bool incremental)
+    {
+      // hashes from a previous merge only apply to the same current model
+      if (!incremental || (m_currentModel != currentModel)){
+        m_spaceContentHashes.clear();
+      }
+
       m_logSink.setThreadId(QThread::currentThread());
       m_logSink.resetStringStream();
 
@@ -905,12 +951,130 @@ namespace openstudio
         }
       }
 
+      // the merge does not change the new model, so each new space is hashed once
+      std::map<UUID, size_t> newSpaceHashes;
+      for (const auto& newSpace : newModel.getConcreteModelObjects<Space>()){
+        newSpaceHashes[newSpace.handle()] = contentHash(newSpace);
+      }
+
+      //** Map spaces which have not changed since the last merge, these are skipped below **//
+      std::set<UUID> reusedSpaces;
+      if (incremental){
+        for (const auto& newSpace : newModel.getConcreteModelObjects<Space>()){
+          if (reuseUnchangedSpace(newSpace, newSpaceHashes[newSpace.handle()])){
+            reusedSpaces.insert(newSpace.handle());
+          }
+        }
+      }
+
       //** Merge objects from new model into curret model **//
       for (const auto& iddObjectType : iddObjectTypesToMerge()){
         for (auto& newObject : newModel.getObjectsByType(iddObjectType)){
           getCurrentModelObject(newObject);
         }
       }
+
+      recordSpaceContentHashes(newSpaceHashes, reusedSpaces);
+    }
+
+    bool ModelMerger::reuseUnchangedSpace(const Space& newSpace, size_t newSpaceHash)
+    {
+      boost::optional<UUID> currentHandle = getCurrentModelHandle(newSpace.handle());
+      if (!currentHandle){
+        return false;
+      }
+
+      auto it = m_spaceContentHashes.find(*currentHandle);
+      if (it == m_spaceContentHashes.end()){
+        return false;
+      }
+
+      boost::optional<Space> currentSpace = m_currentModel.getModelObject<Space>(*currentHandle);
+      if (!currentSpace){
+        return false;
+      }
+
+      if ((newSpaceHash != it->second.first) || (contentHash(*currentSpace) != it->second.second)){
+        return false;
+      }
+
+      // children were cloned from the new model so they can be matched by type and name, this only
+      // works if every key is unique, otherwise the space is merged normally
+      std::map<std::pair<int, std::string>, UUID> currentChildren;
+      std::vector<ModelObject> currentChildObjects = getRecursiveChildren(*currentSpace);
+      for (const ModelObject& currentChild : currentChildObjects){
+        std::string name = currentChild.nameString();
+        if (name.empty()){
+          return false;
+        }
+        if (!currentChildren.insert(std::make_pair(std::make_pair(currentChild.iddObjectType().value(), name), currentChild.handle())).second){
+          return false;
+        }
+      }
+
+      std::vector<ModelObject> newChildObjects = getRecursiveChildren(newSpace);
+      if (newChildObjects.size() != currentChildObjects.size()){
+        return false;
+      }
+
+      std::set<UUID> claimed;
+      std::vector<std::pair<UUID, UUID> > childMapping;
+      for (const ModelObject& newChild : newChildObjects){
+        auto childIt = currentChildren.find(std::make_pair(newChild.iddObjectType().value(), newChild.nameString()));
+        if (childIt == currentChildren.end()){
+          return false;
+        }
+
+        // each current child may only be claimed once and must not already be mapped to a different new object
+        if (!claimed.insert(childIt->second).second){
+          return false;
+        }
+        auto mappedNew = m_currentToNewHandleMapping.find(childIt->second);
+        if ((mappedNew != m_currentToNewHandleMapping.end()) && (mappedNew->second != newChild.handle())){
+          return false;
+        }
+        auto mappedCurrent = m_newToCurrentHandleMapping.find(newChild.handle());
+        if ((mappedCurrent != m_newToCurrentHandleMapping.end()) && (mappedCurrent->second != childIt->second)){
+          return false;
+        }
+
+        childMapping.push_back(std::make_pair(childIt->second, newChild.handle()));
+      }
+
+      for (const auto& handles : childMapping){
+        m_newMergedHandles.insert(handles.second);
+        m_currentToNewHandleMapping[handles.first] = handles.second;
+        m_newToCurrentHandleMapping[handles.second] = handles.first;
+      }
+
+      return true;
+    }
+
+    void ModelMerger::recordSpaceContentHashes(const std::map<UUID, size_t>& newSpaceHashes, const std::set<UUID>& reusedSpaces)
+    {
+      std::map<UUID, std::pair<size_t, size_t> > spaceContentHashes;
+      for (const auto& newSpace : m_newModel.getConcreteModelObjects<Space>()){
+        boost::optional<UUID> currentHandle = getCurrentModelHandle(newSpace.handle());
+        if (!currentHandle){
+          continue;
+        }
+
+        // reused spaces were not touched by the merge, their hashes are still current
+        if (reusedSpaces.find(newSpace.handle()) != reusedSpaces.end()){
+          auto it = m_spaceContentHashes.find(*currentHandle);
+          if (it != m_spaceContentHashes.end()){
+            spaceContentHashes[*currentHandle] = it->second;
+            continue;
+          }
+        }
+
+        boost::optional<Space> currentSpace = m_currentModel.getModelObject<Space>(*currentHandle);
+        auto newHashIt = newSpaceHashes.find(newSpace.handle());
+        if (currentSpace && (newHashIt != newSpaceHashes.end())){
+          spaceContentHashes[*currentHandle] = std::make_pair(newHashIt->second, contentHash(*currentSpace));
+        }
+      }
+      m_spaceContentHashes.swap(spaceContentHashes);
     }
 
     std::vector<IddObjectType> ModelMerger::iddObjectTypesToMerge() const
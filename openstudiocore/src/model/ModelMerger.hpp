@@ -37,6 +37,7 @@
 #include "../utilities/core/StringStreamLogSink.hpp"
 
 #include <map>
+#include <set>
 
 namespace openstudio
 {
@@ -65,6 +66,10 @@ namespace openstudio
       /// Handle mapping is mapping of handles in currentModel (keys) to handles in newModel (values)
       void mergeModels(Model& currentModel, const Model& newModel, const std::map<UUID, UUID>& handleMapping);
 
+      /// Merges changes from newModel into currentModel like mergeModels, but spaces whose content in both models
+      /// is unchanged since the previous merge into currentModel by this ModelMerger are not rebuilt
+      void mergeModelsIncremental(Model& currentModel, const Model& newModel, const std::map<UUID, UUID>& handleMapping);
+
       /// List of IddObjectTypes which are merged
       std::vector<IddObjectType> iddObjectTypesToMerge() const;
 
@@ -87,6 +92,11 @@ namespace openstudio
 
        REGISTER_LOGGER("openstudio.model.ModelMerger");
 
+      void mergeModels(Model& currentModel, const Model& newModel, const std::map<UUID, UUID>& handleMapping, bool incremental);
+
+      bool reuseUnchangedSpace(const Space& newSpace, size_t newSpaceHash);
+      void recordSpaceContentHashes(const std::map<UUID, size_t>& newSpaceHashes, const std::set<UUID>& reusedSpaces);
+
       void mergeSpace(Space& currentSpace, const Space& newSpace);
       void mergeShadingSurfaceGroup(ShadingSurfaceGroup& currentGroup, const ShadingSurfaceGroup& newGroup);
       void mergeThermalZone(ThermalZone& currentThermalZone, const ThermalZone& newThermalZone);
@@ -108,6 +118,9 @@ namespace openstudio
       std::vector<IddObjectType> m_iddObjectTypesToMerge;
       std::map<UUID, UUID> m_currentToNewHandleMapping;
       std::map<UUID, UUID> m_newToCurrentHandleMapping;
+
+      // content hashes of each new space and its current space after the last merge, keyed by current space handle
+      std::map<UUID, std::pair<size_t, size_t> > m_spaceContentHashes;
     };
 
   }
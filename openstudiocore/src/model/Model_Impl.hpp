@@ -180,6 +180,11 @@ namespace detail {
      *  object which can be significantly faster than calling getOptionalUniqueModelObject<WeatherFile>(). */
     boost::optional<WeatherFile> weatherFile() const;
 
+    /** Revision of the objects that Space, ThermalZone and Building aggregates such as floorArea and
+     *  lightingPower are computed from. Incremented whenever one of those objects is added, removed or
+     *  changed, used to invalidate memoized aggregates. Never 0. */
+    unsigned aggregateRevision() const;
+
     Schedule alwaysOnDiscreteSchedule() const;
 
     std::string alwaysOnDiscreteScheduleName() const;
@@ -303,7 +308,14 @@ namespace detail {
     mutable boost::optional<YearDescription> m_cachedYearDescription;
     mutable boost::optional<WeatherFile> m_cachedWeatherFile;
 
+    unsigned m_aggregateRevision;
+
   // private slots:
+    void connectAggregateDependencies();
+    void aggregateDependencyAdded(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const openstudio::IddObjectType& type, const openstudio::UUID& handle);
+    void aggregateDependencyRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const openstudio::IddObjectType& type, const openstudio::UUID& handle);
+    void incrementAggregateRevision();
+
     void clearCachedData();
     void clearCachedBuilding(const Handle& handle);
     void clearCachedFoundationKivaSettings(const Handle& handle);
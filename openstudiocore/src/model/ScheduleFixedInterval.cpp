@@ -50,6 +50,7 @@ namespace detail {
   ScheduleFixedInterval_Impl::ScheduleFixedInterval_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
     : ScheduleInterval_Impl(idfObject,model,keepHandle)
   {
+    this->ScheduleFixedInterval_Impl::onChange.connect<ScheduleFixedInterval_Impl, &ScheduleFixedInterval_Impl::clearCachedVariables>(this);
     OS_ASSERT(idfObject.iddObject().type() == ScheduleFixedInterval::iddObjectType());
   }
 
@@ -58,6 +59,7 @@ namespace detail {
                                                          bool keepHandle)
     : ScheduleInterval_Impl(other,model,keepHandle)
   {
+    this->ScheduleFixedInterval_Impl::onChange.connect<ScheduleFixedInterval_Impl, &ScheduleFixedInterval_Impl::clearCachedVariables>(this);
     OS_ASSERT(other.iddObject().type() == ScheduleFixedInterval::iddObjectType());
   }
 
@@ -65,7 +67,9 @@ namespace detail {
                                                          Model_Impl* model,
                                                          bool keepHandle)
     : ScheduleInterval_Impl(other,model,keepHandle)
-  {}
+  {
+    this->ScheduleFixedInterval_Impl::onChange.connect<ScheduleFixedInterval_Impl, &ScheduleFixedInterval_Impl::clearCachedVariables>(this);
+  }
 
   IddObjectType ScheduleFixedInterval_Impl::iddObjectType() const {
     return ScheduleFixedInterval::iddObjectType();
@@ -98,17 +102,7 @@ namespace detail {
     Date startDate(openstudio::MonthOfYear(this->startMonth()), this->startDay());
     Time intervalLength(0, 0, this->intervalLength());
 
-    Vector values(this->numExtensibleGroups());
-    unsigned i = 0;
-    for (const ModelExtensibleGroup& group : castVector<ModelExtensibleGroup>(extensibleGroups()))
-    {
-      OptionalDouble x = group.getDouble(0);
-      OS_ASSERT(x);
-      values[i] = *x;
-      ++i;
-    }
-
-    TimeSeries result(startDate, intervalLength, values, "");
+    TimeSeries result(startDate, intervalLength, this->values(), "");
     result.setOutOfRangeValue(this->outOfRangeValue());
 
     return result;
@@ -276,6 +270,28 @@ namespace detail {
     OS_ASSERT(result);
   }
 
+  const openstudio::Vector& ScheduleFixedInterval_Impl::values() const
+  {
+    if (!m_cachedValues){
+      Vector values(this->numExtensibleGroups());
+      unsigned i = 0;
+      for (const IdfExtensibleGroup& group : extensibleGroups())
+      {
+        OptionalDouble x = group.getDouble(0);
+        OS_ASSERT(x);
+        values[i] = *x;
+        ++i;
+      }
+      m_cachedValues = values;
+    }
+    return m_cachedValues.get();
+  }
+
+  void ScheduleFixedInterval_Impl::clearCachedVariables()
+  {
+    m_cachedValues.reset();
+  }
+
   void ScheduleFixedInterval_Impl::ensureNoLeapDays()
   {
     boost::optional<int> month;
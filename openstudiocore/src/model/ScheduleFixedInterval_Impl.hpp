@@ -33,6 +33,8 @@
 #include "ModelAPI.hpp"
 #include "ScheduleInterval_Impl.hpp"
 
+#include "../utilities/data/Vector.hpp"
+
 namespace openstudio {
 namespace model {
 
@@ -92,6 +94,10 @@ namespace detail {
 
     int startDay() const;
 
+    /** Returns the interval values as a packed array.  Values are parsed from the extensible groups
+     *  once and cached until the object changes, the reference is invalidated by any change. */
+    const openstudio::Vector& values() const;
+
     //@}
     /** @name Setters */
     //@{
@@ -117,6 +123,10 @@ namespace detail {
    protected:
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleFixedInterval");
+
+    void clearCachedVariables();
+
+    mutable boost::optional<openstudio::Vector> m_cachedValues;
   };
 
 } // detail
@@ -50,6 +50,7 @@ namespace detail {
   ScheduleVariableInterval_Impl::ScheduleVariableInterval_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
     : ScheduleInterval_Impl(idfObject,model,keepHandle)
   {
+    this->ScheduleVariableInterval_Impl::onChange.connect<ScheduleVariableInterval_Impl, &ScheduleVariableInterval_Impl::clearCachedVariables>(this);
     OS_ASSERT(idfObject.iddObject().type() == ScheduleVariableInterval::iddObjectType());
   }
 
@@ -58,6 +59,7 @@ namespace detail {
                                                          bool keepHandle)
     : ScheduleInterval_Impl(other,model,keepHandle)
   {
+    this->ScheduleVariableInterval_Impl::onChange.connect<ScheduleVariableInterval_Impl, &ScheduleVariableInterval_Impl::clearCachedVariables>(this);
     OS_ASSERT(other.iddObject().type() == ScheduleVariableInterval::iddObjectType());
   }
 
@@ -65,7 +67,9 @@ namespace detail {
                                                          Model_Impl* model,
                                                          bool keepHandle)
     : ScheduleInterval_Impl(other,model,keepHandle)
-  {}
+  {
+    this->ScheduleVariableInterval_Impl::onChange.connect<ScheduleVariableInterval_Impl, &ScheduleVariableInterval_Impl::clearCachedVariables>(this);
+  }
 
   IddObjectType ScheduleVariableInterval_Impl::iddObjectType() const {
     return ScheduleVariableInterval::iddObjectType();
@@ -200,9 +204,27 @@ namespace detail {
 
     DateTimeVector dateTimes;
     dateTimes.push_back(DateTime(Date(MonthOfYear(*startMonth), *startDay), Time(0, *startHour, *startMinute)));
-    Vector values(numExtensibleGroups);
+
+    parseValues();
+    dateTimes.insert(dateTimes.end(), m_cachedDateTimes->begin(), m_cachedDateTimes->end());
+
+    TimeSeries result(dateTimes, *m_cachedValues, "");
+    result.setOutOfRangeValue(this->outOfRangeValue());
+
+    return result;
+  }
+
+  void ScheduleVariableInterval_Impl::parseValues() const
+  {
+    if (m_cachedDateTimes && m_cachedValues){
+      return;
+    }
+
+    DateTimeVector dateTimes;
+    Vector values(this->numExtensibleGroups());
+    dateTimes.reserve(values.size());
     unsigned i = 0;
-    for (const ModelExtensibleGroup& group : castVector<ModelExtensibleGroup>(extensibleGroups()))
+    for (const IdfExtensibleGroup& group : extensibleGroups())
     {
       OptionalInt month = group.getInt(0);
       OptionalInt day = group.getInt(1);
@@ -219,10 +241,14 @@ namespace detail {
       ++i;
     }
 
-    TimeSeries result(dateTimes, values, "");
-    result.setOutOfRangeValue(this->outOfRangeValue());
+    m_cachedDateTimes = dateTimes;
+    m_cachedValues = values;
+  }
 
-    return result;
+  void ScheduleVariableInterval_Impl::clearCachedVariables()
+  {
+    m_cachedDateTimes.reset();
+    m_cachedValues.reset();
   }
 
   bool ScheduleVariableInterval_Impl::setTimeSeries(const openstudio::TimeSeries& timeSeries)
@@ -347,4 +373,4 @@ ScheduleVariableInterval::ScheduleVariableInterval(std::shared_ptr<detail::Sched
 
 
 } // model
-} // openstudio
\ No newline at end of file
+} // openstudio
@@ -33,6 +33,9 @@
 #include "ModelAPI.hpp"
 #include "ScheduleInterval_Impl.hpp"
 
+#include "../utilities/data/Vector.hpp"
+#include "../utilities/time/DateTime.hpp"
+
 namespace openstudio {
 namespace model {
 
@@ -121,6 +124,14 @@ namespace detail {
    protected:
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleVariableInterval");
+
+    void clearCachedVariables();
+
+    // report date times and values parsed from the extensible groups, cached until the object changes
+    void parseValues() const;
+
+    mutable boost::optional<openstudio::DateTimeVector> m_cachedDateTimes;
+    mutable boost::optional<openstudio::Vector> m_cachedValues;
   };
 
 } // detail
@@ -128,4 +139,4 @@ namespace detail {
 } // model
 } // openstudio
 
-#endif // MODEL_SCHEDULEVARIABLEINTERVAL_IMPL_HPP
\ No newline at end of file
+#endif // MODEL_SCHEDULEVARIABLEINTERVAL_IMPL_HPP
@@ -893,90 +893,100 @@ namespace detail {
 
   double Space_Impl::floorArea() const
   {
-    double result = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.surfaceType(), "Floor"))
-      {
-        if (surface.isAirWall()){
-          continue;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::FloorArea, [this]() {
+      double result = 0;
+      for (const Surface& surface : this->surfaces()) {
+        if (istringEqual(surface.surfaceType(), "Floor"))
+        {
+          if (surface.isAirWall()){
+            continue;
+          }
+          result += surface.grossArea();
         }
-        result += surface.grossArea();
       }
-    }
-    return result;
+      return result;
+    });
   }
 
   double Space_Impl::exteriorArea() const {
-    double result = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
-      {
-        result += surface.grossArea();
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::ExteriorArea, [this]() {
+      double result = 0;
+      for (const Surface& surface : this->surfaces()) {
+        if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
+        {
+          result += surface.grossArea();
+        }
       }
-    }
-    return result;
+      return result;
+    });
   }
 
   double Space_Impl::exteriorWallArea() const {
-    double result = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
-      {
-        if (istringEqual(surface.surfaceType(), "Wall"))
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::ExteriorWallArea, [this]() {
+      double result = 0;
+      for (const Surface& surface : this->surfaces()) {
+        if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
         {
-          result += surface.grossArea();
+          if (istringEqual(surface.surfaceType(), "Wall"))
+          {
+            result += surface.grossArea();
+          }
         }
       }
-    }
-    return result;
+      return result;
+    });
   }
 
   double Space_Impl::volume() const {
-    double result = 0;
-
-    // TODO: need a better method
-    double roofHeight = 0;
-    int numRoof = 0;
-    double floorHeight = 0;
-    int numFloor = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.surfaceType(), "Floor")){
-        for (const Point3d& point : surface.vertices()) {
-          floorHeight += point.z();
-          ++numFloor;
-        }
-      }else if (istringEqual(surface.surfaceType(), "RoofCeiling")){
-        for (const Point3d& point : surface.vertices()) {
-          roofHeight += point.z();
-          ++numRoof;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::Volume, [this]() {
+      double result = 0;
+
+      // TODO: need a better method
+      double roofHeight = 0;
+      int numRoof = 0;
+      double floorHeight = 0;
+      int numFloor = 0;
+      for (const Surface& surface : this->surfaces()) {
+        if (istringEqual(surface.surfaceType(), "Floor")){
+          for (const Point3d& point : surface.vertices()) {
+            floorHeight += point.z();
+            ++numFloor;
+          }
+        }else if (istringEqual(surface.surfaceType(), "RoofCeiling")){
+          for (const Point3d& point : surface.vertices()) {
+            roofHeight += point.z();
+            ++numRoof;
+          }
         }
       }
-    }
 
-    if ((numRoof > 0) * (numFloor > 0)){
-      roofHeight /= numRoof;
-      floorHeight /= numFloor;
-      result = (roofHeight - floorHeight) * this->floorArea();
-    }
+      if ((numRoof > 0) * (numFloor > 0)){
+        roofHeight /= numRoof;
+        floorHeight /= numFloor;
+        result = (roofHeight - floorHeight) * this->floorArea();
+      }
 
-    return result;
+      return result;
+    });
   }
 
   double Space_Impl::numberOfPeople() const {
-    double result = 0.0;
-    double area = floorArea();
-
-    for (const People& person : this->people()) {
-      result += person.getNumberOfPeople(area);
-    }
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::NumberOfPeople, [this]() {
+      double result = 0.0;
+      double area = floorArea();
 
-    if (OptionalSpaceType st = spaceType()){
-      for (const People& person : st->people()) {
+      for (const People& person : this->people()) {
         result += person.getNumberOfPeople(area);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType st = spaceType()){
+        for (const People& person : st->people()) {
+          result += person.getNumberOfPeople(area);
+        }
+      }
+
+      return result;
+    });
   }
 
   bool Space_Impl::setNumberOfPeople(double numberOfPeople) {
@@ -1184,27 +1194,29 @@ namespace detail {
   }
 
   double Space_Impl::lightingPower() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
-
-    for (const Lights& light : lights()) {
-      result += light.getLightingPower(area,numPeople);
-    }
-    for (const Luminaire& luminaire : luminaires()) {
-      result += luminaire.lightingPower();
-    }
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::LightingPower, [this]() {
+      double result(0.0);
+      double area = floorArea();
+      double numPeople = numberOfPeople();
 
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const Lights& light : spaceType->lights()) {
+      for (const Lights& light : lights()) {
         result += light.getLightingPower(area,numPeople);
       }
-      for (const Luminaire& luminaire : spaceType->luminaires()) {
+      for (const Luminaire& luminaire : luminaires()) {
         result += luminaire.lightingPower();
       }
-    }
 
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const Lights& light : spaceType->lights()) {
+          result += light.getLightingPower(area,numPeople);
+        }
+        for (const Luminaire& luminaire : spaceType->luminaires()) {
+          result += luminaire.lightingPower();
+        }
+      }
+
+      return result;
+    });
   }
 
   bool Space_Impl::setLightingPower(double lightingPower) {
@@ -1465,21 +1477,23 @@ namespace detail {
   }
 
   double Space_Impl::electricEquipmentPower() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
-
-    for (const ElectricEquipment& equipment : electricEquipment()) {
-      result += equipment.getDesignLevel(area,numPeople);
-    }
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::ElectricEquipmentPower, [this]() {
+      double result(0.0);
+      double area = floorArea();
+      double numPeople = numberOfPeople();
 
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const ElectricEquipment& equipment : spaceType->electricEquipment()) {
+      for (const ElectricEquipment& equipment : electricEquipment()) {
         result += equipment.getDesignLevel(area,numPeople);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const ElectricEquipment& equipment : spaceType->electricEquipment()) {
+          result += equipment.getDesignLevel(area,numPeople);
+        }
+      }
+
+      return result;
+    });
   }
 
   bool Space_Impl::setElectricEquipmentPower(double electricEquipmentPower) {
@@ -1710,21 +1724,23 @@ namespace detail {
   }
 
   double Space_Impl::gasEquipmentPower() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::GasEquipmentPower, [this]() {
+      double result(0.0);
+      double area = floorArea();
+      double numPeople = numberOfPeople();
 
-    for (const GasEquipment& equipment : gasEquipment()) {
-      result += equipment.getDesignLevel(area,numPeople);
-    }
-
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const GasEquipment& equipment : spaceType->gasEquipment()) {
+      for (const GasEquipment& equipment : gasEquipment()) {
         result += equipment.getDesignLevel(area,numPeople);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const GasEquipment& equipment : spaceType->gasEquipment()) {
+          result += equipment.getDesignLevel(area,numPeople);
+        }
+      }
+
+      return result;
+    });
   }
 
   bool Space_Impl::setGasEquipmentPower(double gasEquipmentPower) {
@@ -1955,29 +1971,31 @@ namespace detail {
   }
 
   double Space_Impl::infiltrationDesignFlowRate() const {
-    double result(0.0);
-    double floorArea = this->floorArea();
-    double exteriorSurfaceArea = this->exteriorArea();
-    double exteriorWallArea = this->exteriorWallArea();
-    double airVolume = volume();
-
-    for (const SpaceInfiltrationDesignFlowRate& idfr : spaceInfiltrationDesignFlowRates()) {
-      result += idfr.getDesignFlowRate(floorArea,
-                                       exteriorSurfaceArea,
-                                       exteriorWallArea,
-                                       airVolume);
-    }
-
-    if (OptionalSpaceType st = spaceType()) {
-      for (const SpaceInfiltrationDesignFlowRate& idfr : st->spaceInfiltrationDesignFlowRates()) {
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::InfiltrationDesignFlowRate, [this]() {
+      double result(0.0);
+      double floorArea = this->floorArea();
+      double exteriorSurfaceArea = this->exteriorArea();
+      double exteriorWallArea = this->exteriorWallArea();
+      double airVolume = volume();
+
+      for (const SpaceInfiltrationDesignFlowRate& idfr : spaceInfiltrationDesignFlowRates()) {
         result += idfr.getDesignFlowRate(floorArea,
                                          exteriorSurfaceArea,
                                          exteriorWallArea,
                                          airVolume);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType st = spaceType()) {
+        for (const SpaceInfiltrationDesignFlowRate& idfr : st->spaceInfiltrationDesignFlowRates()) {
+          result += idfr.getDesignFlowRate(floorArea,
+                                           exteriorSurfaceArea,
+                                           exteriorWallArea,
+                                           airVolume);
+        }
+      }
+
+      return result;
+    });
   }
 
   double Space_Impl::infiltrationDesignFlowPerSpaceFloorArea() const {
@@ -32,6 +32,7 @@
 
 #include "ModelAPI.hpp"
 #include "PlanarSurfaceGroup_Impl.hpp"
+#include "AggregateCache.hpp"
 
 #include "../utilities/units/Quantity.hpp"
 
@@ -479,6 +480,8 @@ namespace detail {
    private:
     REGISTER_LOGGER("openstudio.model.Space");
 
+    mutable AggregateCache m_aggregateCache;
+
     openstudio::Quantity directionofRelativeNorth_SI() const;
     openstudio::Quantity directionofRelativeNorth_IP() const;
     bool setDirectionofRelativeNorth(const Quantity& directionofRelativeNorth);
@@ -998,43 +998,53 @@ namespace detail {
   }
 
   double ThermalZone_Impl::floorArea() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.floorArea();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::FloorArea, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.floorArea();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::exteriorSurfaceArea() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.exteriorArea();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::ExteriorArea, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.exteriorArea();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::exteriorWallArea() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.exteriorWallArea();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::ExteriorWallArea, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.exteriorWallArea();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::airVolume() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.volume();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::Volume, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.volume();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::numberOfPeople() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.numberOfPeople();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::NumberOfPeople, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.numberOfPeople();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::peoplePerFloorArea() const {
@@ -1065,11 +1075,13 @@ namespace detail {
   }
 
   double ThermalZone_Impl::lightingPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.lightingPower();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::LightingPower, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.lightingPower();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::lightingPowerPerFloorArea() const {
@@ -1103,11 +1115,13 @@ namespace detail {
   }
 
   double ThermalZone_Impl::electricEquipmentPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.electricEquipmentPower();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::ElectricEquipmentPower, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.electricEquipmentPower();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::electricEquipmentPowerPerFloorArea() const {
@@ -1141,11 +1155,13 @@ namespace detail {
   }
 
   double ThermalZone_Impl::gasEquipmentPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.gasEquipmentPower();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::GasEquipmentPower, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.gasEquipmentPower();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::gasEquipmentPowerPerFloorArea() const {
@@ -1179,11 +1195,13 @@ namespace detail {
   }
 
   double ThermalZone_Impl::infiltrationDesignFlowRate() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.infiltrationDesignFlowRate();
-    }
-    return result;
+    return m_aggregateCache.get(model().getImpl<Model_Impl>()->aggregateRevision(), AggregateCache::InfiltrationDesignFlowRate, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.infiltrationDesignFlowRate();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::infiltrationDesignFlowPerSpaceFloorArea() const {
@@ -32,6 +32,7 @@
 
 #include "ModelAPI.hpp"
 #include "HVACComponent_Impl.hpp"
+#include "AggregateCache.hpp"
 
 #include "../utilities/units/Quantity.hpp"
 #include "../utilities/units/OSOptionalQuantity.hpp"
@@ -439,6 +440,8 @@ namespace detail {
    private:
     REGISTER_LOGGER("openstudio.model.ThermalZone");
 
+    mutable AggregateCache m_aggregateCache;
+
     openstudio::OSOptionalQuantity ceilingHeight_SI() const;
     openstudio::OSOptionalQuantity ceilingHeight_IP() const;
     openstudio::OSOptionalQuantity volume_SI() const;
@@ -59,6 +59,7 @@
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Compare.hpp"
+#include "../utilities/core/ParallelFor.hpp"
 #include "../utilities/geometry/Point3d.hpp"
 #include "../utilities/geometry/Plane.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
@@ -68,6 +69,7 @@
 
 #include <QThread>
 
+#include <algorithm>
 #include <cmath>
 
 namespace openstudio
@@ -290,48 +292,109 @@ namespace openstudio
       }
     }
 
-    void makeGeometries(const PlanarSurface& planarSurface, std::vector<ThreeGeometry>& geometries, std::vector<ThreeUserData>& userDatas, bool triangulateSurfaces)
+    /// model data needed to build the geometry of one surface, gathered on the calling thread
+    struct SurfaceGeometryInput
     {
-      std::string name = planarSurface.nameString();
-      boost::optional<Surface> surface = planarSurface.optionalCast<Surface>();
-      boost::optional<PlanarSurfaceGroup> planarSurfaceGroup = planarSurface.planarSurfaceGroup();
+      std::string handle;
+      std::string name;
+      Transformation siteTransformation;
+      Point3dVector vertices;
+      Point3dVectorVector subSurfaceVertices;
+      ThreeUserData userData;
+    };
+
+    /// geometry built from a SurfaceGeometryInput, does not touch the model
+    struct SurfaceGeometryOutput
+    {
+      bool success = false;
+      std::vector<double> vertices;
+      std::vector<size_t> faces;
+    };
+
+    SurfaceGeometryInput makeGeometryInput(const PlanarSurface& planarSurface)
+    {
+      SurfaceGeometryInput input;
+      input.handle = toThreeUUID(toString(planarSurface.handle()));
+      input.name = planarSurface.nameString();
 
       // get the transformation to site coordinates
-      Transformation siteTransformation;
+      boost::optional<PlanarSurfaceGroup> planarSurfaceGroup = planarSurface.planarSurfaceGroup();
       if (planarSurfaceGroup){
-        siteTransformation = planarSurfaceGroup->siteTransformation();
+        input.siteTransformation = planarSurfaceGroup->siteTransformation();
       }
 
       // get the vertices
-      Point3dVector vertices = planarSurface.vertices();
-      Transformation t = Transformation::alignFace(vertices);
-      //Transformation r = t.rotationMatrix();
-      Transformation tInv = t.inverse();
-      Point3dVector faceVertices = reverse(tInv*vertices);
+      input.vertices = planarSurface.vertices();
 
       // get vertices of all sub surfaces
-      Point3dVectorVector faceSubVertices;
+      boost::optional<Surface> surface = planarSurface.optionalCast<Surface>();
       if (surface){
         for (const auto& subSurface : surface->subSurfaces()){
-          faceSubVertices.push_back(reverse(tInv*subSurface.vertices()));
+          input.subSurfaceVertices.push_back(subSurface.vertices());
+        }
+      }
+
+      updateUserData(input.userData, planarSurface);
+
+      // check if the adjacent surface is truly adjacent
+      // this controls display only, not energy model
+      if (!input.userData.outsideBoundaryConditionObjectHandle().empty()){
+
+        UUID adjacentHandle = toUUID(fromThreeUUID(input.userData.outsideBoundaryConditionObjectHandle()));
+        boost::optional<PlanarSurface> adjacentPlanarSurface = planarSurface.model().getModelObject<PlanarSurface>(adjacentHandle);
+        OS_ASSERT(adjacentPlanarSurface);
+
+        Transformation otherSiteTransformation;
+        if (adjacentPlanarSurface->planarSurfaceGroup()){
+          otherSiteTransformation = adjacentPlanarSurface->planarSurfaceGroup()->siteTransformation();
+        }
+
+        Point3dVector otherVertices = otherSiteTransformation*adjacentPlanarSurface->vertices();
+        if (circularEqual(input.siteTransformation*input.vertices, reverse(otherVertices))){
+          input.userData.setCoincidentWithOutsideObject(true);
+        } else{
+          input.userData.setCoincidentWithOutsideObject(false);
         }
       }
 
+      return input;
+    }
+
+    SurfaceGeometryOutput makeGeometryOutput(const SurfaceGeometryInput& input, bool triangulateSurfaces)
+    {
+      SurfaceGeometryOutput output;
+
+      Transformation t = Transformation::alignFace(input.vertices);
+      //Transformation r = t.rotationMatrix();
+      Transformation tInv = t.inverse();
+      Point3dVector faceVertices = reverse(tInv*input.vertices);
+
+      Point3dVectorVector faceSubVertices;
+      for (const auto& subSurfaceVertices : input.subSurfaceVertices){
+        faceSubVertices.push_back(reverse(tInv*subSurfaceVertices));
+      }
+
       Point3dVectorVector finalFaceVertices;
       if (triangulateSurfaces){
         finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
         if (finalFaceVertices.empty()){
-          LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << name << " with " << faceSubVertices.size() << " sub surfaces");
-          return;
+          return output;
         }
       } else{
         finalFaceVertices.push_back(faceVertices);
       }
 
+      // move every face of this surface to site coordinates with one pass over all of their vertices
+      Point3dVector faceVerticesToSite;
+      for (const auto& finalFaceVerts : finalFaceVertices) {
+        faceVerticesToSite.insert(faceVerticesToSite.end(), finalFaceVerts.begin(), finalFaceVerts.end());
+      }
+      faceVerticesToSite = (input.siteTransformation*t)*faceVerticesToSite;
+
       Point3dVector allVertices;
-      std::vector<size_t> faceIndices;
+      Point3dVector::const_iterator faceBegin = faceVerticesToSite.begin();
       for (const auto& finalFaceVerts : finalFaceVertices) {
-        Point3dVector finalVerts = siteTransformation*t*finalFaceVerts;
+        Point3dVector::const_iterator faceEnd = faceBegin + finalFaceVerts.size();
         //normal = siteTransformation.rotationMatrix*r*z
 
         // https://github.com/mrdoob/three.js/wiki/JSON-Model-format-3
@@ -344,51 +407,37 @@ namespace openstudio
         // 1024 - OpenStudio format, all vertices belong to single face
 
         if (triangulateSurfaces){
-          faceIndices.push_back(0);
+          output.faces.push_back(0);
         } else{
-          faceIndices.push_back(openstudioFaceFormatId());
+          output.faces.push_back(openstudioFaceFormatId());
         }
 
-        Point3dVector::reverse_iterator it = finalVerts.rbegin();
-        Point3dVector::reverse_iterator itend = finalVerts.rend();
+        Point3dVector::const_reverse_iterator it(faceEnd);
+        Point3dVector::const_reverse_iterator itend(faceBegin);
         for (; it != itend; ++it){
-          faceIndices.push_back(getVertexIndex(*it, allVertices));
+          output.faces.push_back(getVertexIndex(*it, allVertices));
         }
+        faceBegin = faceEnd;
 
         // convert to 1 based indices
         //face_indices.each_index {|i| face_indices[i] = face_indices[i] + 1}
       }
 
-      ThreeGeometryData geometryData(toThreeVector(allVertices), faceIndices);
-
-      ThreeGeometry geometry(toThreeUUID(toString(planarSurface.handle())), "Geometry", geometryData);
-      geometries.push_back(geometry);
-
-      ThreeUserData userData;
-      updateUserData(userData, planarSurface);
-
-      // check if the adjacent surface is truly adjacent
-      // this controls display only, not energy model
-      if (!userData.outsideBoundaryConditionObjectHandle().empty()){
-
-        UUID adjacentHandle = toUUID(fromThreeUUID(userData.outsideBoundaryConditionObjectHandle()));
-        boost::optional<PlanarSurface> adjacentPlanarSurface = planarSurface.model().getModelObject<PlanarSurface>(adjacentHandle);
-        OS_ASSERT(adjacentPlanarSurface);
+      output.vertices = toThreeVector(allVertices);
+      output.success = true;
+      return output;
+    }
 
-        Transformation otherSiteTransformation;
-        if (adjacentPlanarSurface->planarSurfaceGroup()){
-          otherSiteTransformation = adjacentPlanarSurface->planarSurfaceGroup()->siteTransformation();
-        }
+    /// builds the geometry of each input, spread over the available cores, results are in input order
+    std::vector<SurfaceGeometryOutput> makeGeometryOutputs(const std::vector<SurfaceGeometryInput>& inputs, bool triangulateSurfaces)
+    {
+      std::vector<SurfaceGeometryOutput> outputs(inputs.size());
 
-        Point3dVector otherVertices = otherSiteTransformation*adjacentPlanarSurface->vertices();
-        if (circularEqual(siteTransformation*vertices, reverse(otherVertices))){
-          userData.setCoincidentWithOutsideObject(true);
-        } else{
-          userData.setCoincidentWithOutsideObject(false);
-        }
-      }
+      parallelFor(inputs.size(), [&](size_t i) {
+        outputs[i] = makeGeometryOutput(inputs[i], triangulateSurfaces);
+      });
 
-      userDatas.push_back(userData);
+      return outputs;
     }
 
 
@@ -466,29 +515,41 @@ namespace openstudio
       double n = 0;
       double N = planarSurfaces.size() + planarSurfaceGroups.size() + buildingStories.size() + buildingUnits.size() + thermalZones.size() + spaceTypes.size() + defaultConstructionSets.size() + 1;
 
-      // loop over all surfaces
+      // gather the model data for all surfaces, the model is only accessed from this thread
+      std::vector<SurfaceGeometryInput> geometryInputs;
+      geometryInputs.reserve(planarSurfaces.size());
       for (const auto& planarSurface : planarSurfaces)
       {
-        std::vector<ThreeGeometry> geometries;
-        std::vector<ThreeUserData> userDatas;
-        makeGeometries(planarSurface, geometries, userDatas, triangulateSurfaces);
-        OS_ASSERT(geometries.size() == userDatas.size());
+        geometryInputs.push_back(makeGeometryInput(planarSurface));
 
-        size_t n = geometries.size();
-        for (size_t i = 0; i < n; ++i){
+        n += 1;
+        updatePercentage(100.0*n / N);
+      }
 
-         allGeometries.push_back(geometries[i]);
+      // alignment, triangulation and vertex merging are independent for each surface
+      std::vector<SurfaceGeometryOutput> geometryOutputs = makeGeometryOutputs(geometryInputs, triangulateSurfaces);
+      OS_ASSERT(geometryInputs.size() == geometryOutputs.size());
 
-         std::string thisUUID(toThreeUUID(toString(createUUID())));
-         std::string thisName(userDatas[i].name());
-         std::string thisMaterialId = getThreeMaterialId(userDatas[i].surfaceTypeMaterialName(), materialMap);
+      allGeometries.reserve(geometryInputs.size());
+      sceneChildren.reserve(geometryInputs.size());
+      for (size_t i = 0; i < geometryInputs.size(); ++i){
+        const SurfaceGeometryInput& input = geometryInputs[i];
+        const SurfaceGeometryOutput& output = geometryOutputs[i];
 
-         ThreeSceneChild sceneChild(thisUUID, thisName, "Mesh", geometries[i].uuid(), thisMaterialId, userDatas[i]);
-           sceneChildren.push_back(sceneChild);
+        if (!output.success){
+          LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << input.name << " with " << input.subSurfaceVertices.size() << " sub surfaces");
+          continue;
         }
 
-        n += 1;
-        updatePercentage(100.0*n / N);
+        ThreeGeometryData geometryData(output.vertices, output.faces);
+        allGeometries.push_back(ThreeGeometry(input.handle, "Geometry", geometryData));
+
+        std::string thisUUID(toThreeUUID(toString(createUUID())));
+        std::string thisName(input.userData.name());
+        std::string thisMaterialId = getThreeMaterialId(input.userData.surfaceTypeMaterialName(), materialMap);
+
+        ThreeSceneChild sceneChild(thisUUID, thisName, "Mesh", input.handle, thisMaterialId, input.userData);
+        sceneChildren.push_back(sceneChild);
       }
 
       ThreeSceneObject sceneObject(toThreeUUID(toString(openstudio::createUUID())), sceneChildren);
@@ -59,11 +59,13 @@
 #include "../PeopleDefinition.hpp"
 #include "../Schedule.hpp"
 #include "../LifeCycleCost.hpp"
+#include "../Model_Impl.hpp"
 
 #include "../../utilities/data/Attribute.hpp"
 #include "../../utilities/geometry/Geometry.hpp"
 
 #include <math.h>
+#include <chrono>
 
 using namespace openstudio::model;
 using namespace openstudio;
@@ -457,4 +459,118 @@ TEST_F(ModelFixture, Building_Rotations)
   EXPECT_NEAR(1, spaceGroup.buildingTransformation().matrix()(0, 0), 0.0001);
   EXPECT_NEAR(cos(degToRad(degrees)), spaceGroup.siteTransformation().matrix()(0, 0), 0.0001);
 
-}
\ No newline at end of file
+}
+TEST_F(ModelFixture, Building_AggregateMemoization)
+{
+  Model model;
+
+  Building building = model.getUniqueModelObject<Building>();
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 10, 0));
+  points.push_back(Point3d(10, 10, 0));
+  points.push_back(Point3d(10, 0, 0));
+  points.push_back(Point3d(0, 0, 0));
+  boost::optional<Space> space = Space::fromFloorPrint(points, 3.0, model);
+  ASSERT_TRUE(space);
+
+  ThermalZone thermalZone(model);
+  EXPECT_TRUE(space->setThermalZone(thermalZone));
+
+  EXPECT_NEAR(100, space->floorArea(), 0.0001);
+  EXPECT_NEAR(100, thermalZone.floorArea(), 0.0001);
+  EXPECT_NEAR(100, building.floorArea(), 0.0001);
+  EXPECT_NEAR(300, building.airVolume(), 0.0001);
+
+  // changing vertices invalidates the cached areas
+  boost::optional<Surface> floor;
+  for (const Surface& surface : space->surfaces()) {
+    if (istringEqual("Floor", surface.surfaceType())) {
+      floor = surface;
+    }
+  }
+  ASSERT_TRUE(floor);
+  Point3dVector smallerPoints;
+  smallerPoints.push_back(Point3d(0, 5, 0));
+  smallerPoints.push_back(Point3d(10, 5, 0));
+  smallerPoints.push_back(Point3d(10, 0, 0));
+  smallerPoints.push_back(Point3d(0, 0, 0));
+  EXPECT_TRUE(floor->setVertices(smallerPoints));
+  EXPECT_NEAR(50, space->floorArea(), 0.0001);
+  EXPECT_NEAR(50, thermalZone.floorArea(), 0.0001);
+  EXPECT_NEAR(50, building.floorArea(), 0.0001);
+
+  // so does the zone multiplier
+  EXPECT_TRUE(thermalZone.setMultiplier(3));
+  EXPECT_NEAR(150, building.floorArea(), 0.0001);
+
+  // and loads added through the space type
+  SpaceType spaceType(model);
+  EXPECT_TRUE(space->setSpaceType(spaceType));
+  LightsDefinition lightsDefinition(model);
+  EXPECT_TRUE(lightsDefinition.setWattsperSpaceFloorArea(10));
+  Lights lights(lightsDefinition);
+  EXPECT_TRUE(lights.setSpaceType(spaceType));
+  EXPECT_NEAR(500, space->lightingPower(), 0.0001);
+  EXPECT_NEAR(1500, building.lightingPower(), 0.0001);
+  EXPECT_TRUE(lightsDefinition.setWattsperSpaceFloorArea(20));
+  EXPECT_NEAR(3000, building.lightingPower(), 0.0001);
+
+  // and removing the floor
+  floor->remove();
+  EXPECT_NEAR(0, space->floorArea(), 0.0001);
+  EXPECT_NEAR(0, building.floorArea(), 0.0001);
+
+  // unrelated changes keep the cache
+  unsigned revision = model.getImpl<detail::Model_Impl>()->aggregateRevision();
+  ScheduleCompact schedule(model);
+  EXPECT_TRUE(schedule.setName("Unrelated Schedule"));
+  EXPECT_EQ(revision, model.getImpl<detail::Model_Impl>()->aggregateRevision());
+}
+
+// Not a strict performance assertion, reports the cost of repeated aggregate queries on a larger model
+TEST_F(ModelFixture, DISABLED_Building_AggregateMemoization_Benchmark)
+{
+  Model model;
+
+  Building building = model.getUniqueModelObject<Building>();
+
+  SpaceType spaceType(model);
+  LightsDefinition lightsDefinition(model);
+  EXPECT_TRUE(lightsDefinition.setWattsperSpaceFloorArea(10));
+  Lights lights(lightsDefinition);
+  EXPECT_TRUE(lights.setSpaceType(spaceType));
+  PeopleDefinition peopleDefinition(model);
+  EXPECT_TRUE(peopleDefinition.setPeopleperSpaceFloorArea(0.05));
+  People people(peopleDefinition);
+  EXPECT_TRUE(people.setSpaceType(spaceType));
+  EXPECT_TRUE(building.setSpaceType(spaceType));
+
+  for (int i = 0; i < 20; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      Point3dVector points;
+      points.push_back(Point3d(10 * i, 10 * j + 10, 0));
+      points.push_back(Point3d(10 * i + 10, 10 * j + 10, 0));
+      points.push_back(Point3d(10 * i + 10, 10 * j, 0));
+      points.push_back(Point3d(10 * i, 10 * j, 0));
+      ASSERT_TRUE(Space::fromFloorPrint(points, 3.0, model));
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  double first = building.lightingPowerPerFloorArea() + building.peoplePerFloorArea();
+  auto afterFirst = std::chrono::steady_clock::now();
+  double repeated = 0;
+  for (int i = 0; i < 100; ++i) {
+    repeated = building.lightingPowerPerFloorArea() + building.peoplePerFloorArea();
+  }
+  auto afterRepeated = std::chrono::steady_clock::now();
+
+  EXPECT_DOUBLE_EQ(first, repeated);
+  EXPECT_NEAR(10.05, first, 0.0001);
+
+  std::cout << "first query: "
+            << std::chrono::duration_cast<std::chrono::microseconds>(afterFirst - start).count() << " us, "
+            << "100 repeated queries: "
+            << std::chrono::duration_cast<std::chrono::microseconds>(afterRepeated - afterFirst).count() << " us" << std::endl;
+}
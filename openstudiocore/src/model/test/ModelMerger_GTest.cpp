@@ -42,6 +42,10 @@
 #include "../ThermalZone.hpp"
 #include "../ThermalZone_Impl.hpp"
 
+#include <chrono>
+#include <cmath>
+#include <set>
+
 using namespace openstudio;
 using namespace openstudio::model;
 
@@ -58,6 +62,33 @@ unsigned setWWR(Space& space, double wwr){
   return windowsAdded;
 }
 
+void addGridSpaces(Model& model, unsigned n){
+  unsigned nx = static_cast<unsigned>(std::ceil(std::sqrt(n)));
+  for (unsigned i = 0; i < n; ++i){
+    double x = 6.0 * (i % nx);
+    double y = 6.0 * (i / nx);
+    std::vector<Point3d> floorprint;
+    floorprint.push_back(Point3d(x, y + 5, 0));
+    floorprint.push_back(Point3d(x + 5, y + 5, 0));
+    floorprint.push_back(Point3d(x + 5, y, 0));
+    floorprint.push_back(Point3d(x, y, 0));
+    boost::optional<Space> space = Space::fromFloorPrint(floorprint, 3, model);
+    ASSERT_TRUE(space);
+    space->setName("Space " + std::to_string(i));
+  }
+}
+
+std::set<UUID> surfaceHandles(const Model& model, const std::string& spaceName){
+  std::set<UUID> result;
+  boost::optional<Space> space = model.getConcreteModelObjectByName<Space>(spaceName);
+  if (space){
+    for (const auto& surface : space->surfaces()){
+      result.insert(surface.handle());
+    }
+  }
+  return result;
+}
+
 TEST_F(ModelFixture, ModelMerger_Initial) {
 
   Model model1;
@@ -668,4 +699,131 @@ TEST_F(ModelFixture, ModelMerger_SuggestMapping_ExampleModel) {
     ASSERT_TRUE(model2.getObject(mapPair.second));
     EXPECT_EQ(model1.getObject(mapPair.first)->nameString(), model2.getObject(mapPair.second)->nameString());
   }
-}
\ No newline at end of file
+}
+
+TEST_F(ModelFixture, ModelMerger_Incremental) {
+  Model model1;
+  Model model2;
+  addGridSpaces(model2, 3);
+
+  ModelMerger merger;
+  merger.mergeModels(model1, model2, std::map<UUID, UUID>());
+  EXPECT_EQ(3u, model1.getConcreteModelObjects<Space>().size());
+  EXPECT_EQ(18u, model1.getConcreteModelObjects<Surface>().size());
+  EXPECT_EQ(0u, model1.getConcreteModelObjects<SubSurface>().size());
+
+  std::set<UUID> space0Surfaces = surfaceHandles(model1, "Space 0");
+  std::set<UUID> space1Surfaces = surfaceHandles(model1, "Space 1");
+  std::set<UUID> space2Surfaces = surfaceHandles(model1, "Space 2");
+  EXPECT_EQ(6u, space0Surfaces.size());
+
+  // edit one space in the new model, only that space is rebuilt
+  boost::optional<Space> editedSpace = model2.getConcreteModelObjectByName<Space>("Space 1");
+  ASSERT_TRUE(editedSpace);
+  EXPECT_EQ(4u, setWWR(*editedSpace, 0.3));
+
+  merger.mergeModelsIncremental(model1, model2, merger.suggestHandleMapping(model1, model2));
+  EXPECT_EQ(3u, model1.getConcreteModelObjects<Space>().size());
+  EXPECT_EQ(18u, model1.getConcreteModelObjects<Surface>().size());
+  EXPECT_EQ(4u, model1.getConcreteModelObjects<SubSurface>().size());
+
+  EXPECT_EQ(space0Surfaces, surfaceHandles(model1, "Space 0"));
+  EXPECT_NE(space1Surfaces, surfaceHandles(model1, "Space 1"));
+  EXPECT_EQ(space2Surfaces, surfaceHandles(model1, "Space 2"));
+
+  // an edit to the current model is also detected, the space is merged again
+  boost::optional<Space> currentSpace = model1.getConcreteModelObjectByName<Space>("Space 0");
+  ASSERT_TRUE(currentSpace);
+  EXPECT_TRUE(currentSpace->setXOrigin(10.0));
+
+  merger.mergeModelsIncremental(model1, model2, merger.suggestHandleMapping(model1, model2));
+  EXPECT_EQ(0.0, currentSpace->xOrigin());
+  EXPECT_NE(space0Surfaces, surfaceHandles(model1, "Space 0"));
+  EXPECT_EQ(space2Surfaces, surfaceHandles(model1, "Space 2"));
+  EXPECT_EQ(18u, model1.getConcreteModelObjects<Surface>().size());
+  EXPECT_EQ(4u, model1.getConcreteModelObjects<SubSurface>().size());
+}
+
+TEST_F(ModelFixture, ModelMerger_Incremental_AmbiguousNames) {
+  Model model1;
+  Model model2;
+  addGridSpaces(model2, 3);
+
+  // allow names that a draft model would make unique
+  EXPECT_TRUE(model2.setStrictnessLevel(StrictnessLevel::None));
+
+  boost::optional<Space> space0 = model2.getConcreteModelObjectByName<Space>("Space 0");
+  boost::optional<Space> space1 = model2.getConcreteModelObjectByName<Space>("Space 1");
+  boost::optional<Space> space2 = model2.getConcreteModelObjectByName<Space>("Space 2");
+  ASSERT_TRUE(space0);
+  ASSERT_TRUE(space1);
+  ASSERT_TRUE(space2);
+
+  // duplicate names in space 0, an empty name in space 1, unique names in space 2
+  for (auto& surface : space0->surfaces()){
+    surface.setName("Duplicate");
+  }
+  space1->surfaces()[0].setName("");
+  unsigned i = 0;
+  for (auto& surface : space2->surfaces()){
+    surface.setName("Unique " + std::to_string(i++));
+  }
+
+  ModelMerger merger;
+  merger.mergeModels(model1, model2, std::map<UUID, UUID>());
+  EXPECT_EQ(3u, model1.getConcreteModelObjects<Space>().size());
+  EXPECT_EQ(18u, model1.getConcreteModelObjects<Surface>().size());
+
+  std::set<UUID> space0Surfaces = surfaceHandles(model1, "Space 0");
+  std::set<UUID> space1Surfaces = surfaceHandles(model1, "Space 1");
+  std::set<UUID> space2Surfaces = surfaceHandles(model1, "Space 2");
+  EXPECT_EQ(6u, space0Surfaces.size());
+  EXPECT_EQ(6u, space1Surfaces.size());
+  EXPECT_EQ(6u, space2Surfaces.size());
+
+  // nothing changed, but children of spaces 0 and 1 cannot be matched one to one by name so they are merged again
+  merger.mergeModelsIncremental(model1, model2, merger.suggestHandleMapping(model1, model2));
+  EXPECT_EQ(3u, model1.getConcreteModelObjects<Space>().size());
+  EXPECT_EQ(18u, model1.getConcreteModelObjects<Surface>().size());
+
+  EXPECT_NE(space0Surfaces, surfaceHandles(model1, "Space 0"));
+  EXPECT_NE(space1Surfaces, surfaceHandles(model1, "Space 1"));
+  EXPECT_EQ(space2Surfaces, surfaceHandles(model1, "Space 2"));
+  EXPECT_EQ(6u, surfaceHandles(model1, "Space 0").size());
+  EXPECT_EQ(6u, surfaceHandles(model1, "Space 1").size());
+}
+
+TEST_F(ModelFixture, DISABLED_ModelMerger_Incremental_Benchmark) {
+  const unsigned n = 1500;
+
+  Model newModel;
+  addGridSpaces(newModel, n);
+
+  // two current models brought up to date with the same new model
+  Model fullModel;
+  Model incrementalModel;
+  ModelMerger fullMerger;
+  ModelMerger incrementalMerger;
+  fullMerger.mergeModels(fullModel, newModel, std::map<UUID, UUID>());
+  incrementalMerger.mergeModels(incrementalModel, newModel, std::map<UUID, UUID>());
+
+  // edit one space
+  boost::optional<Space> editedSpace = newModel.getConcreteModelObjectByName<Space>("Space 0");
+  ASSERT_TRUE(editedSpace);
+  EXPECT_EQ(4u, setWWR(*editedSpace, 0.3));
+
+  auto start = std::chrono::steady_clock::now();
+  fullMerger.mergeModels(fullModel, newModel, fullMerger.suggestHandleMapping(fullModel, newModel));
+  auto afterFull = std::chrono::steady_clock::now();
+  incrementalMerger.mergeModelsIncremental(incrementalModel, newModel, incrementalMerger.suggestHandleMapping(incrementalModel, newModel));
+  auto afterIncremental = std::chrono::steady_clock::now();
+
+  EXPECT_EQ(fullModel.getConcreteModelObjects<Space>().size(), incrementalModel.getConcreteModelObjects<Space>().size());
+  EXPECT_EQ(fullModel.getConcreteModelObjects<Surface>().size(), incrementalModel.getConcreteModelObjects<Surface>().size());
+  EXPECT_EQ(4u, fullModel.getConcreteModelObjects<SubSurface>().size());
+  EXPECT_EQ(4u, incrementalModel.getConcreteModelObjects<SubSurface>().size());
+
+  std::cout << "Merged one space edit on a " << n << " space model, full: "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(afterFull - start).count() << " ms, incremental: "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(afterIncremental - afterFull).count() << " ms" << std::endl;
+}
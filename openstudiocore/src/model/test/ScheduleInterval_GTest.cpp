@@ -42,6 +42,7 @@
 #include "../ScheduleTypeLimits_Impl.hpp"
 
 #include "../../utilities/data/TimeSeries.hpp"
+#include "../../utilities/idf/IdfExtensibleGroup.hpp"
 
 using namespace openstudio::model;
 using namespace openstudio;
@@ -112,6 +113,38 @@ TEST_F(ModelFixture, Schedule_FixedInterval_NaN_Infinity)
 
 }
 
+TEST_F(ModelFixture, Schedule_FixedInterval_CachedValues)
+{
+  Model model;
+  ScheduleFixedInterval schedule(model);
+  EXPECT_EQ(0u, schedule.timeSeries().values().size());
+
+  Date startDate(MonthOfYear::Jan, 1);
+  Time intervalLength(0, 1);
+  Vector values(24, 1.0);
+  EXPECT_TRUE(schedule.setTimeSeries(TimeSeries(startDate, intervalLength, values, "")));
+  ASSERT_EQ(24u, schedule.timeSeries().values().size());
+  EXPECT_DOUBLE_EQ(1.0, schedule.timeSeries().values()[0]);
+
+  // setting a new time series replaces the cached values
+  values[0] = 2.0;
+  EXPECT_TRUE(schedule.setTimeSeries(TimeSeries(startDate, intervalLength, values, "")));
+  EXPECT_DOUBLE_EQ(2.0, schedule.timeSeries().values()[0]);
+  EXPECT_DOUBLE_EQ(2.0, schedule.getImpl<detail::ScheduleFixedInterval_Impl>()->values()[0]);
+
+  // editing the extensible groups directly also clears the cached values
+  std::vector<IdfExtensibleGroup> groups = schedule.extensibleGroups();
+  ASSERT_EQ(24u, groups.size());
+  EXPECT_TRUE(groups[0].setDouble(0, 3.0));
+  EXPECT_DOUBLE_EQ(3.0, schedule.timeSeries().values()[0]);
+
+  EXPECT_FALSE(schedule.pushExtensibleGroup(std::vector<std::string>(1, "4.0")).empty());
+  ASSERT_EQ(25u, schedule.timeSeries().values().size());
+  EXPECT_DOUBLE_EQ(4.0, schedule.timeSeries().values()[24]);
+
+  schedule.clearExtensibleGroups();
+  EXPECT_EQ(0u, schedule.timeSeries().values().size());
+}
 
 TEST_F(ModelFixture, Schedule_VariableInterval)
 {
@@ -152,6 +185,36 @@ TEST_F(ModelFixture, Schedule_VariableInterval)
   EXPECT_TRUE(schedule.optionalCast<ScheduleVariableInterval>());
 }
 
+TEST_F(ModelFixture, Schedule_VariableInterval_CachedValues)
+{
+  Model model;
+  ScheduleVariableInterval schedule(model);
+
+  Date startDate(MonthOfYear::Jan, 1);
+  std::vector<DateTime> dateTimes;
+  Vector values(24, 1.0);
+  for (unsigned i = 0; i < values.size(); ++i){
+    dateTimes.push_back(DateTime(startDate, Time(0, i + 1)));
+  }
+  EXPECT_TRUE(schedule.setTimeSeries(TimeSeries(dateTimes, values, "")));
+  ASSERT_EQ(24u, schedule.timeSeries().values().size());
+  EXPECT_DOUBLE_EQ(1.0, schedule.timeSeries().values()[0]);
+
+  // setting a new time series replaces the cached values
+  values[0] = 2.0;
+  EXPECT_TRUE(schedule.setTimeSeries(TimeSeries(dateTimes, values, "")));
+  EXPECT_DOUBLE_EQ(2.0, schedule.timeSeries().values()[0]);
+
+  // editing the extensible groups directly also clears the cached values
+  std::vector<IdfExtensibleGroup> groups = schedule.extensibleGroups();
+  ASSERT_EQ(24u, groups.size());
+  EXPECT_TRUE(groups[0].setDouble(4, 3.0));
+  EXPECT_DOUBLE_EQ(3.0, schedule.timeSeries().values()[0]);
+
+  schedule.clearExtensibleGroups();
+  EXPECT_EQ(0u, schedule.timeSeries().values().size());
+}
+
 TEST_F(ModelFixture, Schedule_VariableInterval2)
 {
   Model model;
@@ -112,10 +112,13 @@
 #include <QDesktopServices>
 #include <QDialog>
 #include <QDir>
+#include <QEventLoop>
 #include <QFile>
 #include <QFileDialog>
 #include <QFileOpenEvent>
+#include <QMenuBar>
 #include <QMessageBox>
+#include <QProgressDialog>
 #include <QStringList>
 #include <QThread>
 #include <QTimer>
@@ -127,6 +130,8 @@
 
 #include <OpenStudio.hxx>
 #include <utilities/idd/IddEnums.hxx>
+#include <algorithm>
+#include <atomic>
 #include <sstream>
 #include <cstdlib>
 
@@ -227,7 +232,8 @@ void OpenStudioApp::onMeasureManagerAndLibraryReady() {
       osversion::VersionTranslator versionTranslator;
       versionTranslator.setAllowNewerVersions(false);
 
-      boost::optional<openstudio::model::Model> model = versionTranslator.loadModel(toPath(fileName));
+      bool canceled = false;
+      boost::optional<openstudio::model::Model> model = loadModelInBackground(fileName, versionTranslator, canceled);
       if( model ){
 
         m_osDocument = std::shared_ptr<OSDocument>( new OSDocument(componentLibrary(),
@@ -251,7 +257,7 @@ void OpenStudioApp::onMeasureManagerAndLibraryReady() {
 
         versionUpdateMessageBox(versionTranslator, true, fileName, openstudio::toPath(m_osDocument->modelTempDir()));
 
-      }else{
+      }else if (!canceled){
         LOG_FREE(Warn, "OpenStudio", "Could not open file at " << toString(fileName));
 
         versionUpdateMessageBox(versionTranslator, false, fileName, openstudio::path());
@@ -274,7 +280,8 @@ bool OpenStudioApp::openFile(const QString& fileName, bool restoreTabs)
     osversion::VersionTranslator versionTranslator;
     versionTranslator.setAllowNewerVersions(false);
 
-    boost::optional<openstudio::model::Model> temp = versionTranslator.loadModel(toPath(fileName));
+    bool canceled = false;
+    boost::optional<openstudio::model::Model> temp = loadModelInBackground(fileName, versionTranslator, canceled);
 
     if (temp) {
       model::Model model = temp.get();
@@ -318,7 +325,7 @@ bool OpenStudioApp::openFile(const QString& fileName, bool restoreTabs)
       this->setQuitOnLastWindowClosed(wasQuitOnLastWindowClosed);
 
       return true;
-    }else{
+    }else if (!canceled){
       LOG_FREE(Warn, "OpenStudio", "Could not open file at " << toString(fileName));
 
       versionUpdateMessageBox(versionTranslator, false, fileName, openstudio::path());
@@ -327,6 +334,78 @@ bool OpenStudioApp::openFile(const QString& fileName, bool restoreTabs)
   return false;
 }
 
+boost::optional<model::Model> OpenStudioApp::loadModelInBackground(const QString& fileName, osversion::VersionTranslator& versionTranslator, bool& canceled)
+{
+  MainWindow * parent = nullptr;
+  if( this->currentDocument() ){
+    parent = this->currentDocument()->mainWindow();
+  }
+
+  QProgressDialog progressDialog(tr("Opening ") + QFileInfo(fileName).fileName(), tr("Cancel"), 0, 100, parent);
+  progressDialog.setWindowModality(Qt::ApplicationModal);
+  progressDialog.setMinimumDuration(500);
+  progressDialog.setValue(0);
+
+  // percentage is written by the worker thread and read by the progress timer, cancelRequested is set by the
+  // cancel button and read by the worker thread at each stage of the translation
+  std::atomic<int> percentage(0);
+  std::atomic<bool> cancelRequested(false);
+
+  versionTranslator.setProgressCallback([&percentage, &cancelRequested](double fraction) {
+    percentage = static_cast<int>(100.0 * fraction);
+    return !cancelRequested;
+  });
+
+  connect(&progressDialog, &QProgressDialog::canceled, [&cancelRequested]() { cancelRequested = true; });
+
+  QTimer progressTimer;
+  progressTimer.setInterval(100);
+  connect(&progressTimer, &QTimer::timeout, [&progressDialog, &percentage]() {
+    progressDialog.setValue(std::min(static_cast<int>(percentage), 99));
+  });
+
+  QEventLoop eventLoop;
+  QFutureWatcher<boost::optional<model::Model> > watcher;
+  connect(&watcher, &QFutureWatcherBase::finished, &eventLoop, &QEventLoop::quit);
+
+  openstudio::path path = toPath(fileName);
+  watcher.setFuture(QtConcurrent::run([&versionTranslator, path]() {
+    return versionTranslator.loadModel(path);
+  }));
+
+  // input events must reach the progress dialog so that the load can be canceled, the open document is
+  // disabled instead, the dialog is not shown at all for quick loads
+  if (parent) {
+    parent->centralWidget()->setEnabled(false);
+    parent->menuBar()->setEnabled(false);
+  }
+
+  // keep the interface responsive while the model is parsed, translated and built
+  progressTimer.start();
+  if (!watcher.isFinished()) {
+    eventLoop.exec();
+  }
+  watcher.waitForFinished();
+  progressTimer.stop();
+
+  if (parent) {
+    parent->centralWidget()->setEnabled(true);
+    parent->menuBar()->setEnabled(true);
+  }
+
+  versionTranslator.setProgressCallback(std::function<bool (double)>());
+
+  // the worker may finish before it sees the request, the result is abandoned either way
+  canceled = cancelRequested || versionTranslator.canceled();
+  if (canceled) {
+    return boost::none;
+  }
+
+  progressDialog.setValue(100);
+
+  return watcher.result();
+}
+
 std::vector<std::string> OpenStudioApp::buildCompLibraries()
 {
   std::vector<std::string> failed;
@@ -451,6 +530,7 @@ void OpenStudioApp::importIdf()
         Workspace workspace(_idfFile);
 
         energyplus::ReverseTranslator trans;
+        trans.setBulkTranslation(true);
         model::Model model = trans.translateWorkspace(workspace);
 
         bool wasQuitOnLastWindowClosed = this->quitOnLastWindowClosed();
@@ -867,8 +947,8 @@ void OpenStudioApp::reloadFile(const QString& osmPath, bool modified, bool saveC
   QFileInfo info(osmPath); // handles windows links and "\"
   QString fileName = info.absoluteFilePath();
   osversion::VersionTranslator versionTranslator;
-  openstudio::path path = toPath(fileName);
-  boost::optional<openstudio::model::Model> model = versionTranslator.loadModel(path);
+  bool canceled = false;
+  boost::optional<openstudio::model::Model> model = loadModelInBackground(fileName, versionTranslator, canceled);
   if (model){
 
     bool wasQuitOnLastWindowClosed = this->quitOnLastWindowClosed();
@@ -887,7 +967,7 @@ void OpenStudioApp::reloadFile(const QString& osmPath, bool modified, bool saveC
 
     this->setQuitOnLastWindowClosed(wasQuitOnLastWindowClosed);
 
-  }else{
+  }else if (!canceled){
     QMessageBox::warning (m_osDocument->mainWindow(), QString("Failed to load model"), QString("Failed to load model"));
   }
 
@@ -203,6 +203,10 @@ class OpenStudioApp : public OSAppBase
 
   bool openFile(const QString& fileName, bool restoreTabs = false);
 
+  // Load and version translate a model on a worker thread while the event loop keeps running and a progress
+  // dialog is shown, returns none if loading failed or was canceled, canceled is set if the user canceled
+  boost::optional<model::Model> loadModelInBackground(const QString& fileName, osversion::VersionTranslator& versionTranslator, bool& canceled);
+
   void versionUpdateMessageBox(const osversion::VersionTranslator& translator, bool successful, const QString& fileName,
       const openstudio::path &tempModelDir);
 
@@ -95,6 +95,9 @@ namespace openstudio {
   {
     m_scrollLayout->addWidget(gridView, 0, Qt::AlignTop);
 
+    // models may have thousands of rows, only build the ones scrolled into view
+    gridView->setVirtualized(true);
+
     connect(gridView, &OSGridView::dropZoneItemClicked, this, &GridViewSubTab::onDropZoneItemClicked);
 
     connect(this, &GridViewSubTab::selectionCleared, gridView, &OSGridView::onSelectionCleared);
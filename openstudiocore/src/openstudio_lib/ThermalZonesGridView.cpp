@@ -145,6 +145,9 @@ struct ModelObjectNameSorter{
 
     gridView->m_dropZone->hide();
 
+    // models may have thousands of zones, only build the rows scrolled into view
+    gridView->setVirtualized(true);
+
     layout->addWidget(gridView, 0, Qt::AlignTop);
 
     layout->addStretch(1);
@@ -0,0 +1,234 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../DesignDayGridView.hpp"
+#include "../SpacesSurfacesGridView.hpp"
+
+#include "../../shared_gui_components/OSGridView.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/DesignDay.hpp"
+#include "../../model/Space.hpp"
+#include "../../model/Surface.hpp"
+
+#include "../../utilities/geometry/Point3d.hpp"
+
+#include <QCoreApplication>
+#include <QScrollArea>
+#include <QScrollBar>
+
+#include <chrono>
+
+using namespace openstudio;
+
+namespace {
+
+  // show a design day grid in a scroll area and run the queued refreshes, returns the number of cells built
+  int openDesignDayGrid(const model::Model& model, bool virtualized, QScrollArea& scrollArea, OSGridView*& gridView)
+  {
+    scrollArea.setWidgetResizable(true);
+    scrollArea.resize(1024, 768);
+
+    auto designDayGridView = new DesignDayGridView(true, model);
+    gridView = designDayGridView->findChild<OSGridView *>();
+    if (!gridView) {
+      return 0;
+    }
+    gridView->setVirtualized(virtualized);
+
+    scrollArea.setWidget(designDayGridView);
+    scrollArea.show();
+
+    for (unsigned i = 0; i < 10; ++i) {
+      QCoreApplication::processEvents();
+    }
+
+    return gridView->findChildren<QWidget *>("TableCell").size();
+  }
+
+  void processEvents()
+  {
+    for (unsigned i = 0; i < 10; ++i) {
+      QCoreApplication::processEvents();
+    }
+  }
+
+  // number of widgets in all cells, including the widgets of each subrow
+  int numCellWidgets(const OSGridView * gridView)
+  {
+    int result = 0;
+    for (const QWidget * cell : gridView->findChildren<QWidget *>("TableCell")) {
+      result += 1 + cell->findChildren<QWidget *>().size();
+    }
+    return result;
+  }
+
+  // show a grid of spaces with a subrow for each surface, returns the number of widgets in its cells
+  int openSpacesSurfacesGrid(const model::Model& model, QScrollArea& scrollArea, OSGridView*& gridView)
+  {
+    scrollArea.setWidgetResizable(true);
+    scrollArea.resize(1024, 768);
+
+    auto spacesSurfacesGridView = new SpacesSurfacesGridView(true, model);
+    gridView = spacesSurfacesGridView->findChild<OSGridView *>();
+    if (!gridView) {
+      return 0;
+    }
+
+    scrollArea.setWidget(spacesSurfacesGridView);
+    scrollArea.show();
+    processEvents();
+
+    return numCellWidgets(gridView);
+  }
+
+  void addSurfaces(model::Space& space, unsigned numSurfaces)
+  {
+    for (unsigned i = 0; i < numSurfaces; ++i) {
+      std::vector<Point3d> vertices;
+      vertices.push_back(Point3d(i, 1, 0));
+      vertices.push_back(Point3d(i, 0, 0));
+      vertices.push_back(Point3d(i + 1, 0, 0));
+      vertices.push_back(Point3d(i + 1, 1, 0));
+      model::Surface surface(vertices, space.model());
+      surface.setSpace(space);
+    }
+  }
+
+  // the number of widgets in the cells of a grid built from scratch for the model
+  int numFreshCellWidgets(const model::Model& model)
+  {
+    QScrollArea scrollArea;
+    OSGridView * gridView = nullptr;
+    return openSpacesSurfacesGrid(model, scrollArea, gridView);
+  }
+
+}
+
+TEST_F(OpenStudioLibFixture, OSGridView_Virtualized)
+{
+  model::Model model;
+  for (unsigned i = 0; i < 500; ++i) {
+    model::DesignDay designDay(model);
+  }
+
+  QScrollArea fullScrollArea;
+  OSGridView * fullGridView = nullptr;
+  int numFullCells = openDesignDayGrid(model, false, fullScrollArea, fullGridView);
+  ASSERT_TRUE(fullGridView);
+  EXPECT_LT(0, numFullCells);
+
+  QScrollArea scrollArea;
+  OSGridView * gridView = nullptr;
+  int numCells = openDesignDayGrid(model, true, scrollArea, gridView);
+  ASSERT_TRUE(gridView);
+  EXPECT_LT(0, numCells);
+  EXPECT_LT(numCells, numFullCells);
+
+  // scrolling to the bottom builds more rows
+  scrollArea.verticalScrollBar()->setValue(scrollArea.verticalScrollBar()->maximum());
+  for (unsigned i = 0; i < 10; ++i) {
+    QCoreApplication::processEvents();
+  }
+  int numScrolledCells = gridView->findChildren<QWidget *>("TableCell").size();
+  EXPECT_LT(numCells, numScrolledCells);
+
+  // turning virtualization off builds everything
+  gridView->setVirtualized(false);
+  EXPECT_EQ(numFullCells, gridView->findChildren<QWidget *>("TableCell").size());
+}
+
+TEST_F(OpenStudioLibFixture, OSGridView_AddRemoveRowWithSubrows)
+{
+  model::Model model;
+  model::Space space1(model);
+  space1.setName("Space 1");
+  addSurfaces(space1, 2);
+  model::Space space3(model);
+  space3.setName("Space 3");
+  addSurfaces(space3, 1);
+
+  QScrollArea scrollArea;
+  OSGridView * gridView = nullptr;
+  int numInitialWidgets = openSpacesSurfacesGrid(model, scrollArea, gridView);
+  ASSERT_TRUE(gridView);
+  EXPECT_LT(0, numInitialWidgets);
+
+  // a new row between the existing ones, the rows after it shift down
+  model::Space space2(model);
+  space2.setName("Space 2");
+  processEvents();
+  int numAddedRowWidgets = numCellWidgets(gridView);
+  EXPECT_LT(numInitialWidgets, numAddedRowWidgets);
+  EXPECT_EQ(numFreshCellWidgets(model), numAddedRowWidgets);
+
+  // subrows for the new row
+  addSurfaces(space2, 3);
+  processEvents();
+  int numAddedSubrowWidgets = numCellWidgets(gridView);
+  EXPECT_LT(numAddedRowWidgets, numAddedSubrowWidgets);
+  EXPECT_EQ(numFreshCellWidgets(model), numAddedSubrowWidgets);
+
+  // removing the row removes its subrows, the rows after it shift back up
+  space2.remove();
+  processEvents();
+  EXPECT_EQ(numInitialWidgets, numCellWidgets(gridView));
+  EXPECT_EQ(numFreshCellWidgets(model), numCellWidgets(gridView));
+
+  // removing the last row
+  space3.remove();
+  processEvents();
+  EXPECT_LT(numCellWidgets(gridView), numInitialWidgets);
+  EXPECT_EQ(numFreshCellWidgets(model), numCellWidgets(gridView));
+}
+
+TEST_F(OpenStudioLibFixture, DISABLED_OSGridView_Virtualized_Benchmark)
+{
+  model::Model model;
+  for (unsigned i = 0; i < 2000; ++i) {
+    model::DesignDay designDay(model);
+  }
+
+  for (bool virtualized : {false, true}) {
+    QScrollArea scrollArea;
+    OSGridView * gridView = nullptr;
+
+    auto start = std::chrono::steady_clock::now();
+    int numCells = openDesignDayGrid(model, virtualized, scrollArea, gridView);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    ASSERT_TRUE(gridView);
+    std::cout << "Open grid with 2000 rows, virtualized = " << virtualized << ": "
+              << numCells << " cells in " << elapsed.count() << " ms" << std::endl;
+  }
+}
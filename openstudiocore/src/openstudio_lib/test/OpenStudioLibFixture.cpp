@@ -32,6 +32,8 @@
 #include "../../utilities/core/Application.hpp"
 #include "../../utilities/core/Path.hpp"
 
+#include <QtGlobal>
+
 void OpenStudioLibFixture::SetUp() {
   openstudio::Application::instance().application(true);
 }
@@ -39,6 +41,11 @@ void OpenStudioLibFixture::SetUp() {
 void OpenStudioLibFixture::TearDown() {}
 
 void OpenStudioLibFixture::SetUpTestCase() {
+  // run headless unless a platform was requested
+  if (qgetenv("QT_QPA_PLATFORM").isEmpty()) {
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  }
+
   // set up logging
   logFile = openstudio::FileLogSink(openstudio::toPath("./OpenStudioLibFixture.log"));
   logFile->setLogLevel(Debug);
@@ -74,7 +74,8 @@ namespace osversion {
 
 VersionTranslator::VersionTranslator()
   : m_originalVersion("0.0.0"),
-    m_allowNewerVersions(true)
+    m_allowNewerVersions(true),
+    m_canceled(false)
 {
   m_logSink.setLogLevel(Warn);
   m_logSink.setChannelRegex(boost::regex("openstudio\\.osversion\\.VersionTranslator"));
@@ -383,6 +384,26 @@ void VersionTranslator::setAllowNewerVersions(bool allowNewerVersions)
   m_allowNewerVersions = allowNewerVersions;
 }
 
+void VersionTranslator::setProgressCallback(const std::function<bool (double)>& progressCallback)
+{
+  m_progressCallback = progressCallback;
+}
+
+bool VersionTranslator::canceled() const
+{
+  return m_canceled;
+}
+
+bool VersionTranslator::reportProgress(double fraction)
+{
+  if (m_progressCallback && !m_progressCallback(fraction)) {
+    LOG(Info,"Version translation canceled.");
+    m_canceled = true;
+    return false;
+  }
+  return true;
+}
+
 boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
                                                                bool isComponent,
                                                                ProgressBar* progressBar) {
@@ -398,6 +419,12 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
   m_nObjectsFinalIdf = 0;
   m_nObjectsFinalModel = 0;
   m_isComponent = isComponent;
+  m_canceled = false;
+
+  // parsing the file, updating versions and building the final model each take roughly a third of the time
+  if (!reportProgress(0.0)) {
+    return boost::none;
+  }
 
   initializeMap(is);
   OS_ASSERT(m_map.size() < 2u);
@@ -405,16 +432,26 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
     return boost::none;
   }
 
+  if (!reportProgress(0.3)) {
+    return boost::none;
+  }
+
   if (progressBar){
     progressBar->setMinimum(0);
     progressBar->setMaximum(m_startVersions.size());
   }
+  unsigned numUpdated = 0;
   for (const VersionString& startVersion : m_startVersions) {
     if (progressBar){
       progressBar->setWindowTitle("Upgrading from " + startVersion.str());
       progressBar->setValue(progressBar->value()+1);
     }
     update(startVersion); // does nothing if no map entry
+
+    ++numUpdated;
+    if (!reportProgress(0.3 + 0.3 * numUpdated / m_startVersions.size())) {
+      return boost::none;
+    }
   }
   if (progressBar){
     progressBar->setValue(m_startVersions.size());
@@ -436,6 +473,10 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
     numExpectedObjects = m_nObjectsFinalIdf;
   }
 
+  if (!reportProgress(0.6)) {
+    return boost::none;
+  }
+
   // validity checking
   Workspace finalWorkspace(finalModel);
   model::Model tempModel(finalWorkspace); // None-level strictness!
@@ -453,6 +494,10 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
   OS_ASSERT(test);
   fixInterobjectIssuesStage2(tempModel,issueInfo);
 
+  if (!reportProgress(0.8)) {
+    return boost::none;
+  }
+
   if (isComponent) {
     try {
       result = model::Component(tempModel.toIdfFile()); // includes name conflict fixes
@@ -473,6 +518,11 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
       return boost::none;
     }
   }
+
+  if (!reportProgress(1.0)) {
+    return boost::none;
+  }
+
   return result;
 }
 
@@ -44,6 +44,7 @@
 
 #include <boost/functional.hpp>
 
+#include <functional>
 #include <map>
 
 namespace openstudio {
@@ -158,6 +159,13 @@ class OSVERSION_API VersionTranslator {
   /** Set whether or not loading newer versions is allowed. */
   void setAllowNewerVersions(bool allowNewerVersions);
 
+  /** Set a function that is called with the fraction of the translation completed, on the thread
+   *  calling loadModel or loadComponent. Returning false from the function cancels the translation. */
+  void setProgressCallback(const std::function<bool (double)>& progressCallback);
+
+  /** Returns true if the last translation was canceled by the progress callback. */
+  bool canceled() const;
+
   //@}
  private:
   REGISTER_LOGGER("openstudio.osversion.VersionTranslator");
@@ -168,6 +176,8 @@ class OSVERSION_API VersionTranslator {
 
   VersionString m_originalVersion;
   bool m_allowNewerVersions;
+  std::function<bool (double)> m_progressCallback;
+  bool m_canceled;
   std::map<VersionString, IdfFile> m_map;
   StringStreamLogSink m_logSink;
   std::vector<IdfObject> m_deprecated, m_untranslated, m_new;
@@ -178,6 +188,9 @@ class OSVERSION_API VersionTranslator {
   bool m_isComponent;
   std::vector<IdfObject> m_cbeccSizingObjects;
 
+  // calls the progress callback, returns false if the translation should be canceled
+  bool reportProgress(double fraction);
+
   boost::optional<model::Model> updateVersion(std::istream& is,
                                               bool isComponent,
                                               ProgressBar* progressBar = nullptr);
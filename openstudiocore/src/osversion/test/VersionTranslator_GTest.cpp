@@ -461,6 +461,40 @@ TEST_F(OSVersionFixture,ModelLoading_PreserveHandles) {
   EXPECT_TRUE(buildingHandle1 == buildingHandle2);
 }
 
+TEST_F(OSVersionFixture,ModelLoading_ProgressAndCancel) {
+  openstudio::path modelPath = exampleModelPath(VersionString("0.7.4"));
+
+  std::vector<double> fractions;
+  osversion::VersionTranslator translator;
+  translator.setProgressCallback([&fractions](double fraction) {
+    fractions.push_back(fraction);
+    return true;
+  });
+  model::OptionalModel oModel = translator.loadModel(modelPath);
+  ASSERT_TRUE(oModel);
+  EXPECT_FALSE(translator.canceled());
+  ASSERT_FALSE(fractions.empty());
+  EXPECT_DOUBLE_EQ(0.0, fractions.front());
+  EXPECT_DOUBLE_EQ(1.0, fractions.back());
+  for (unsigned i = 1; i < fractions.size(); ++i) {
+    EXPECT_LE(fractions[i-1], fractions[i]);
+  }
+
+  // cancel once the version map is built
+  translator.setProgressCallback([](double fraction) {
+    return fraction < 0.3;
+  });
+  oModel = translator.loadModel(modelPath);
+  EXPECT_FALSE(oModel);
+  EXPECT_TRUE(translator.canceled());
+
+  // canceled state is reset on the next load
+  translator.setProgressCallback(std::function<bool (double)>());
+  oModel = translator.loadModel(modelPath);
+  EXPECT_TRUE(oModel);
+  EXPECT_FALSE(translator.canceled());
+}
+
 TEST_F(OSVersionFixture,Profile_ComponentLoading_LatestVersion) {
   VersionString thisVersion(openStudioVersion());
   openstudio::path componentPath = exampleComponentPath(thisVersion);
@@ -0,0 +1,717 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "DaylightCoefficients.hpp"
+
+#include "../utilities/filetypes/EpwFile.hpp"
+#include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Checksum.hpp"
+#include "../utilities/core/FilesystemHelpers.hpp"
+#include "../utilities/core/ParallelFor.hpp"
+#include "../utilities/core/PathHelpers.hpp"
+
+#include <boost/lexical_cast.hpp>
+#include <boost/math/constants/constants.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace openstudio{
+namespace radiance{
+
+  namespace {
+
+    // number of Tregenza patches in each row from the horizon up, the last row is the zenith cap
+    const unsigned tregenzaRowPatches[] = {30, 30, 24, 24, 18, 12, 6, 1};
+    const unsigned numTregenzaRows = 8;
+    const double tregenzaRowDegrees = 12.0;
+
+    // Radiance luminous weights of the red, green and blue channels
+    const double luminousWeights[] = {0.265, 0.670, 0.065};
+
+    // luminous efficacy used by Radiance to convert radiance to luminance
+    const double radianceLuminousEfficacy = 179.0;
+
+    double degToRad(double degrees)
+    {
+      return degrees * boost::math::constants::pi<double>() / 180.0;
+    }
+
+    bool isLittleEndian()
+    {
+      const unsigned one = 1;
+      unsigned char firstByte;
+      std::memcpy(&firstByte, &one, 1);
+      return firstByte == 1;
+    }
+
+    template<typename T>
+    T swapBytes(T t)
+    {
+      unsigned char bytes[sizeof(T)];
+      std::memcpy(bytes, &t, sizeof(T));
+      std::reverse(bytes, bytes + sizeof(T));
+      std::memcpy(&t, bytes, sizeof(T));
+      return t;
+    }
+
+    template<typename T>
+    bool readBinaryValues(std::istream& is, bool swap, std::vector<double>& values)
+    {
+      for (double& value : values){
+        T t;
+        if (!is.read(reinterpret_cast<char*>(&t), sizeof(T))){
+          return false;
+        }
+        if (swap){
+          t = swapBytes(t);
+        }
+        value = t;
+      }
+      return true;
+    }
+
+    /// reads a Radiance matrix file, color channels are combined with the luminous weights, empty if the file cannot be read
+    boost::optional<openstudio::Matrix> readRadianceMatrix(const openstudio::path& path, std::string& error)
+    {
+      openstudio::filesystem::ifstream file(path, std::ios_base::binary);
+      if (!file.is_open()){
+        error = "Cannot open file '" + toString(path) + "' for reading";
+        return boost::none;
+      }
+
+      std::string line;
+      if (!std::getline(file, line) || line.compare(0, 10, "#?RADIANCE") != 0){
+        error = "File '" + toString(path) + "' does not start with a Radiance header";
+        return boost::none;
+      }
+
+      unsigned numRows = 0;
+      unsigned numCols = 0;
+      unsigned numComp = 1;
+      std::string format = "ascii";
+      bool swap = false;
+      try{
+        while (std::getline(file, line) && !line.empty()){
+          if (line.compare(0, 6, "NROWS=") == 0){
+            numRows = boost::lexical_cast<unsigned>(line.substr(6));
+          } else if (line.compare(0, 6, "NCOLS=") == 0){
+            numCols = boost::lexical_cast<unsigned>(line.substr(6));
+          } else if (line.compare(0, 6, "NCOMP=") == 0){
+            numComp = boost::lexical_cast<unsigned>(line.substr(6));
+          } else if (line.compare(0, 7, "FORMAT=") == 0){
+            format = line.substr(7);
+          } else if (line.compare(0, 10, "BYTEORDER=") == 0){
+            swap = ((line.substr(10) == "LittleEndian") != isLittleEndian());
+          }
+        }
+      } catch (const boost::bad_lexical_cast&){
+        error = "Cannot read matrix size in header of '" + toString(path) + "'";
+        return boost::none;
+      }
+
+      if (numRows == 0 || numCols == 0){
+        error = "Header of '" + toString(path) + "' does not give the matrix size";
+        return boost::none;
+      }
+      if (numComp != 1 && numComp != 3){
+        error = "Matrix '" + toString(path) + "' has " + boost::lexical_cast<std::string>(numComp) + " components, expected 1 or 3";
+        return boost::none;
+      }
+
+      std::vector<double> values(static_cast<size_t>(numRows) * numCols * numComp);
+      bool ok = false;
+      if (format == "ascii"){
+        ok = true;
+        for (double& value : values){
+          if (!(file >> value)){
+            ok = false;
+            break;
+          }
+        }
+      } else if (format == "float"){
+        ok = readBinaryValues<float>(file, swap, values);
+      } else if (format == "double"){
+        ok = readBinaryValues<double>(file, swap, values);
+      } else{
+        error = "Matrix '" + toString(path) + "' has unsupported format '" + format + "'";
+        return boost::none;
+      }
+      if (!ok){
+        error = "Matrix '" + toString(path) + "' ends before " + boost::lexical_cast<std::string>(values.size()) + " values";
+        return boost::none;
+      }
+
+      openstudio::Matrix result(numRows, numCols);
+      auto it = values.begin();
+      for (unsigned i = 0; i < numRows; ++i){
+        for (unsigned j = 0; j < numCols; ++j){
+          if (numComp == 3){
+            result(i, j) = luminousWeights[0] * it[0] + luminousWeights[1] * it[1] + luminousWeights[2] * it[2];
+          } else{
+            result(i, j) = *it;
+          }
+          it += numComp;
+        }
+      }
+
+      return result;
+    }
+
+  }
+
+  SkyVectors::SkyVectors(const std::vector<openstudio::DateTime>& dateTimes, const openstudio::Matrix& values)
+    : m_dateTimes(dateTimes), m_values(values)
+  {
+    if (m_values.size1() != m_dateTimes.size()){
+      LOG_AND_THROW("Sky vectors have " << m_values.size1() << " rows for " << m_dateTimes.size() << " timesteps");
+    }
+    if (m_values.size2() != numPatches()){
+      LOG_AND_THROW("Sky vectors have " << m_values.size2() << " patches, expected " << numPatches());
+    }
+  }
+
+  SkyVectors SkyVectors::fromEpwFile(openstudio::EpwFile& epwFile, double groundReflectance)
+  {
+    const double pi = boost::math::constants::pi<double>();
+    const double latitude = degToRad(epwFile.latitude());
+    const double hoursPerRecord = 1.0 / std::max(1, epwFile.recordsPerHour());
+
+    std::vector<EpwDataPoint> data = epwFile.data();
+
+    std::vector<openstudio::DateTime> dateTimes;
+    dateTimes.reserve(data.size());
+    openstudio::Matrix values(data.size(), numPatches());
+
+    for (size_t i = 0; i < data.size(); ++i){
+      const EpwDataPoint& dataPoint = data[i];
+      dateTimes.push_back(dataPoint.dateTime());
+
+      for (unsigned patch = 0; patch < numPatches(); ++patch){
+        values(i, patch) = 0.0;
+      }
+
+      double directNormal = std::max(0.0, dataPoint.directNormalIlluminance().get_value_or(0.0));
+      double diffuseHorizontal = std::max(0.0, dataPoint.diffuseHorizontalIlluminance().get_value_or(0.0));
+
+      // solar position at the middle of the record, records end at the given hour and minute
+      double dayAngle = 2.0 * pi * (dataPoint.date().dayOfYear() - 1) / 365.0;
+      double declination = 0.006918 - 0.399912 * std::cos(dayAngle) + 0.070257 * std::sin(dayAngle)
+        - 0.006758 * std::cos(2 * dayAngle) + 0.000907 * std::sin(2 * dayAngle)
+        - 0.002697 * std::cos(3 * dayAngle) + 0.00148 * std::sin(3 * dayAngle);
+      double equationOfTime = 229.18 * (0.000075 + 0.001868 * std::cos(dayAngle) - 0.032077 * std::sin(dayAngle)
+        - 0.014615 * std::cos(2 * dayAngle) - 0.04089 * std::sin(2 * dayAngle));
+
+      int minute = dataPoint.minute();
+      double recordEnd = dataPoint.hour() - 1 + ((minute > 0 && minute < 60) ? minute : 60) / 60.0;
+      double solarTime = recordEnd - 0.5 * hoursPerRecord + equationOfTime / 60.0 + (epwFile.longitude() - 15.0 * epwFile.timeZone()) / 15.0;
+      double hourAngle = degToRad(15.0 * (solarTime - 12.0));
+
+      // x is east, y is north, z is up
+      openstudio::Vector3d sun(-std::cos(declination) * std::sin(hourAngle),
+                               std::sin(declination) * std::cos(latitude) - std::cos(declination) * std::sin(latitude) * std::cos(hourAngle),
+                               std::sin(declination) * std::sin(latitude) + std::cos(declination) * std::cos(latitude) * std::cos(hourAngle));
+
+      if (sun.z() <= 0.0){
+        directNormal = 0.0;
+      }
+
+      // uniform sky, horizontal illuminance is pi times the luminance
+      double skyRadiance = diffuseHorizontal / pi / radianceLuminousEfficacy;
+      for (unsigned patch = 1; patch < numPatches(); ++patch){
+        values(i, patch) = skyRadiance;
+      }
+
+      // sun spread over the patch that contains it
+      if (directNormal > 0.0){
+        unsigned sunPatch = patchIndex(sun);
+        values(i, sunPatch) += directNormal / radianceLuminousEfficacy / patchSolidAngle(sunPatch);
+      }
+
+      double globalHorizontal = diffuseHorizontal + directNormal * std::max(0.0, sun.z());
+      values(i, 0) = groundReflectance * globalHorizontal / pi / radianceLuminousEfficacy;
+    }
+
+    return SkyVectors(dateTimes, values);
+  }
+
+  boost::optional<SkyVectors> SkyVectors::load(const openstudio::path& path)
+  {
+    std::string error;
+    boost::optional<openstudio::Matrix> matrix = readRadianceMatrix(path, error);
+    if (!matrix){
+      LOG(Error, error);
+      return boost::none;
+    }
+
+    if (matrix->size1() != numPatches()){
+      LOG(Error, "Sky matrix '" << toString(path) << "' has " << matrix->size1() << " patches, expected " << numPatches());
+      return boost::none;
+    }
+
+    std::vector<openstudio::DateTime> dateTimes;
+    openstudio::DateTime start(openstudio::Date(MonthOfYear::Jan, 1));
+    for (unsigned j = 0; j < matrix->size2(); ++j){
+      dateTimes.push_back(start + openstudio::Time(0, j + 1));
+    }
+
+    return SkyVectors(dateTimes, openstudio::Matrix(boost::numeric::ublas::trans(*matrix)));
+  }
+
+  unsigned SkyVectors::numPatches()
+  {
+    return 146;
+  }
+
+  openstudio::Vector3d SkyVectors::patchDirection(unsigned patch)
+  {
+    OS_ASSERT(patch < numPatches());
+
+    if (patch == 0){
+      return openstudio::Vector3d(0, 0, -1);
+    }
+
+    unsigned index = patch - 1;
+    unsigned row = 0;
+    while (index >= tregenzaRowPatches[row]){
+      index -= tregenzaRowPatches[row];
+      ++row;
+    }
+
+    if (row == numTregenzaRows - 1){
+      return openstudio::Vector3d(0, 0, 1);
+    }
+
+    double altitude = degToRad((row + 0.5) * tregenzaRowDegrees);
+    double azimuth = degToRad(360.0 * index / tregenzaRowPatches[row]);
+    return openstudio::Vector3d(std::sin(azimuth) * std::cos(altitude), std::cos(azimuth) * std::cos(altitude), std::sin(altitude));
+  }
+
+  double SkyVectors::patchSolidAngle(unsigned patch)
+  {
+    OS_ASSERT(patch < numPatches());
+
+    const double pi = boost::math::constants::pi<double>();
+
+    if (patch == 0){
+      return 2.0 * pi;
+    }
+
+    unsigned index = patch - 1;
+    unsigned row = 0;
+    while (index >= tregenzaRowPatches[row]){
+      index -= tregenzaRowPatches[row];
+      ++row;
+    }
+
+    double lower = std::sin(degToRad(row * tregenzaRowDegrees));
+    double upper = 1.0;
+    if (row < numTregenzaRows - 1){
+      upper = std::sin(degToRad((row + 1) * tregenzaRowDegrees));
+    }
+
+    return 2.0 * pi * (upper - lower) / tregenzaRowPatches[row];
+  }
+
+  unsigned SkyVectors::patchIndex(const openstudio::Vector3d& direction)
+  {
+    double length = direction.length();
+    if (length <= 0.0 || direction.z() < 0.0){
+      return 0;
+    }
+
+    double altitude = std::asin(std::min(1.0, direction.z() / length)) * 180.0 / boost::math::constants::pi<double>();
+    unsigned row = std::min(static_cast<unsigned>(altitude / tregenzaRowDegrees), numTregenzaRows - 1);
+
+    unsigned patch = 1;
+    for (unsigned i = 0; i < row; ++i){
+      patch += tregenzaRowPatches[i];
+    }
+
+    double azimuth = std::atan2(direction.x(), direction.y()) * 180.0 / boost::math::constants::pi<double>();
+    if (azimuth < 0.0){
+      azimuth += 360.0;
+    }
+    unsigned n = tregenzaRowPatches[row];
+    unsigned index = static_cast<unsigned>(std::floor(azimuth * n / 360.0 + 0.5)) % n;
+
+    return patch + index;
+  }
+
+  std::vector<openstudio::DateTime> SkyVectors::dateTimes() const
+  {
+    return m_dateTimes;
+  }
+
+  const openstudio::Matrix& SkyVectors::values() const
+  {
+    return m_values;
+  }
+
+  DaylightCoefficientMatrix::DaylightCoefficientMatrix()
+  {}
+
+  DaylightCoefficientMatrix::DaylightCoefficientMatrix(const openstudio::Matrix& coefficients)
+    : m_coefficients(coefficients)
+  {}
+
+  boost::optional<DaylightCoefficientMatrix> DaylightCoefficientMatrix::load(const openstudio::path& path)
+  {
+    std::string error;
+    boost::optional<openstudio::Matrix> matrix = readRadianceMatrix(path, error);
+    if (!matrix){
+      LOG(Error, error);
+      return boost::none;
+    }
+    return DaylightCoefficientMatrix(*matrix);
+  }
+
+  bool DaylightCoefficientMatrix::save(const openstudio::path& path) const
+  {
+    openstudio::filesystem::ofstream file(path, std::ios_base::binary | std::ios_base::trunc);
+    if (!file.is_open()){
+      LOG(Error, "Cannot open file '" << toString(path) << "' for writing");
+      return false;
+    }
+
+    file << "#?RADIANCE\n";
+    file << "NROWS=" << m_coefficients.size1() << "\n";
+    file << "NCOLS=" << m_coefficients.size2() << "\n";
+    file << "NCOMP=1\n";
+    file << "FORMAT=double\n";
+    file << "BYTEORDER=" << (isLittleEndian() ? "LittleEndian" : "BigEndian") << "\n";
+    file << "\n";
+
+    // ublas matrices are row major
+    if (m_coefficients.data().size() > 0){
+      file.write(reinterpret_cast<const char*>(&m_coefficients.data()[0]), m_coefficients.data().size() * sizeof(double));
+    }
+
+    return file.good();
+  }
+
+  unsigned DaylightCoefficientMatrix::numSensors() const
+  {
+    return m_coefficients.size1();
+  }
+
+  unsigned DaylightCoefficientMatrix::numPatches() const
+  {
+    return m_coefficients.size2();
+  }
+
+  const openstudio::Matrix& DaylightCoefficientMatrix::coefficients() const
+  {
+    return m_coefficients;
+  }
+
+  DaylightCoefficients::DaylightCoefficients(const openstudio::path& radDir, const openstudio::path& cacheDir)
+    : m_radDir(radDir), m_cacheDir(cacheDir)
+  {
+    // everything written by ForwardTranslator that affects the coefficients, in a stable order
+    std::vector<openstudio::path> files;
+    if (openstudio::filesystem::is_directory(m_radDir)){
+      for (const openstudio::path& file : openstudio::filesystem::recursive_directory_files(m_radDir)){
+        std::string top = toString(*file.begin());
+        if (top == "scene" || top == "materials" || top == "numeric" || top == "options" || top == "bsdf" || top == "skies" || top == "model.rad"){
+          files.push_back(file);
+        }
+      }
+    }
+    std::sort(files.begin(), files.end());
+
+    std::stringstream ss;
+    for (const openstudio::path& file : files){
+      ss << toString(file) << " " << checksum(m_radDir / file) << "\n";
+    }
+    m_geometryHash = checksum(ss.str());
+
+    // window groups and shaded window groups written by ForwardTranslator::buildingSpaces
+    const openstudio::path glazingDir = m_radDir / toPath("scene/glazing");
+    const openstudio::path shadesDir = m_radDir / toPath("scene/shades");
+    if (openstudio::filesystem::is_directory(glazingDir)){
+      for (const openstudio::path& file : openstudio::filesystem::directory_files(glazingDir)){
+        if (file.extension() == toPath(".rad")){
+          m_windowGroupNames.push_back(toString(file.stem()));
+        }
+      }
+    }
+    if (openstudio::filesystem::is_directory(shadesDir)){
+      for (const openstudio::path& file : openstudio::filesystem::directory_files(shadesDir)){
+        if (file.extension() == toPath(".rad")){
+          m_windowGroupNames.push_back(toString(file.stem()));
+        }
+      }
+    }
+    std::sort(m_windowGroupNames.begin(), m_windowGroupNames.end());
+  }
+
+  std::string DaylightCoefficients::geometryHash() const
+  {
+    return m_geometryHash;
+  }
+
+  std::vector<std::string> DaylightCoefficients::windowGroupNames() const
+  {
+    return m_windowGroupNames;
+  }
+
+  openstudio::path DaylightCoefficients::cachePath(const std::string& name) const
+  {
+    return m_cacheDir / toPath(m_geometryHash) / toPath(name + ".dmx");
+  }
+
+  bool DaylightCoefficients::loadCachedMatrix(const std::string& name)
+  {
+    if (!isWindowGroup(name)){
+      LOG(Error, "'" << name << "' is not a window group exported to '" << toString(m_radDir) << "'");
+      return false;
+    }
+
+    openstudio::path path = cachePath(name);
+    if (!openstudio::filesystem::exists(path)){
+      return false;
+    }
+
+    boost::optional<DaylightCoefficientMatrix> matrix = DaylightCoefficientMatrix::load(path);
+    if (!matrix){
+      return false;
+    }
+
+    if (!checkSize(name, *matrix)){
+      LOG(Warn, "Ignoring cached matrix '" << toString(path) << "'");
+      return false;
+    }
+
+    m_matrices[name] = *matrix;
+    return true;
+  }
+
+  bool DaylightCoefficients::loadWindowGroupMatrix(const std::string& name)
+  {
+    if (!isWindowGroup(name)){
+      LOG(Error, "'" << name << "' is not a window group exported to '" << toString(m_radDir) << "'");
+      return false;
+    }
+
+    if (loadCachedMatrix(name)){
+      return true;
+    }
+
+    // the shaded state shares the view and daylight matrices of its window group, only the transmission differs
+    const std::string shadeSuffix = "_SHADE";
+    std::string windowGroup = name;
+    if (windowGroup.size() > shadeSuffix.size() && windowGroup.compare(windowGroup.size() - shadeSuffix.size(), shadeSuffix.size(), shadeSuffix) == 0){
+      windowGroup = windowGroup.substr(0, windowGroup.size() - shadeSuffix.size());
+    }
+
+    const openstudio::path dcDir = m_radDir / toPath("output/dc");
+    const openstudio::path vmxPath = dcDir / toPath(windowGroup + ".vmx");
+    const openstudio::path dmxPath = dcDir / toPath(windowGroup + ".dmx");
+    const openstudio::path tmxPath = dcDir / toPath(name + ".tmx");
+
+    if (!openstudio::filesystem::exists(vmxPath) || !openstudio::filesystem::exists(dmxPath)){
+      LOG(Error, "Window group '" << name << "' needs '" << toString(vmxPath) << "' and '" << toString(dmxPath) << "', run rfluxmtx first");
+      return false;
+    }
+
+    boost::optional<DaylightCoefficientMatrix> view = DaylightCoefficientMatrix::load(vmxPath);
+    boost::optional<DaylightCoefficientMatrix> daylight = DaylightCoefficientMatrix::load(dmxPath);
+    if (!view || !daylight){
+      return false;
+    }
+
+    openstudio::Matrix coefficients;
+    if (openstudio::filesystem::exists(tmxPath)){
+      boost::optional<DaylightCoefficientMatrix> transmission = DaylightCoefficientMatrix::load(tmxPath);
+      if (!transmission){
+        return false;
+      }
+      if (view->numPatches() != transmission->numSensors() || transmission->numPatches() != daylight->numSensors()){
+        LOG(Error, "Window group '" << name << "' has a " << view->numSensors() << "x" << view->numPatches() << " view matrix, a "
+          << transmission->numSensors() << "x" << transmission->numPatches() << " transmission matrix and a "
+          << daylight->numSensors() << "x" << daylight->numPatches() << " daylight matrix");
+        return false;
+      }
+      openstudio::Matrix viewTransmission = boost::numeric::ublas::prod(view->coefficients(), transmission->coefficients());
+      coefficients = boost::numeric::ublas::prod(viewTransmission, daylight->coefficients());
+    } else{
+      if (view->numPatches() != daylight->numSensors()){
+        LOG(Error, "Window group '" << name << "' has a " << view->numSensors() << "x" << view->numPatches() << " view matrix and a "
+          << daylight->numSensors() << "x" << daylight->numPatches() << " daylight matrix");
+        return false;
+      }
+      coefficients = boost::numeric::ublas::prod(view->coefficients(), daylight->coefficients());
+    }
+
+    return addMatrix(name, DaylightCoefficientMatrix(coefficients));
+  }
+
+  bool DaylightCoefficients::loadWindowGroupMatrices()
+  {
+    bool result = true;
+    for (const std::string& name : m_windowGroupNames){
+      if (!loadWindowGroupMatrix(name)){
+        result = false;
+      }
+    }
+    return result;
+  }
+
+  bool DaylightCoefficients::addMatrix(const std::string& name, const DaylightCoefficientMatrix& matrix)
+  {
+    if (!isWindowGroup(name)){
+      LOG(Error, "'" << name << "' is not a window group exported to '" << toString(m_radDir) << "'");
+      return false;
+    }
+
+    if (!checkSize(name, matrix)){
+      return false;
+    }
+
+    m_matrices[name] = matrix;
+
+    openstudio::path path = cachePath(name);
+    try{
+      openstudio::filesystem::create_directories(path.parent_path());
+    } catch (const std::exception& e){
+      LOG(Error, "Cannot create cache directory '" << toString(path.parent_path()) << "': " << e.what());
+      return false;
+    }
+
+    return matrix.save(path);
+  }
+
+  bool DaylightCoefficients::isWindowGroup(const std::string& name) const
+  {
+    return std::binary_search(m_windowGroupNames.begin(), m_windowGroupNames.end(), name);
+  }
+
+  bool DaylightCoefficients::checkSize(const std::string& name, const DaylightCoefficientMatrix& matrix) const
+  {
+    // matrices of other window groups may be replaced
+    for (const auto& other : m_matrices){
+      if (other.first == name){
+        continue;
+      }
+      if (matrix.numSensors() != other.second.numSensors() || matrix.numPatches() != other.second.numPatches()){
+        LOG(Error, "Matrix '" << name << "' has " << matrix.numSensors() << " sensors and " << matrix.numPatches()
+          << " patches, expected " << other.second.numSensors() << " and " << other.second.numPatches());
+        return false;
+      }
+      break;
+    }
+    return true;
+  }
+
+  std::vector<std::string> DaylightCoefficients::names() const
+  {
+    std::vector<std::string> result;
+    for (const auto& matrix : m_matrices){
+      result.push_back(matrix.first);
+    }
+    return result;
+  }
+
+  openstudio::Matrix DaylightCoefficients::illuminance(const SkyVectors& skyVectors,
+                                                      const std::map<std::string, std::vector<bool> >& shadeSchedules) const
+  {
+    const openstudio::Matrix& sky = skyVectors.values();
+    const size_t numTimesteps = sky.size1();
+    const size_t numPatches = sky.size2();
+
+    if (m_matrices.empty()){
+      return openstudio::Matrix(0, numTimesteps);
+    }
+
+    const size_t numSensors = m_matrices.begin()->second.numSensors();
+    if (m_matrices.begin()->second.numPatches() != numPatches){
+      LOG_AND_THROW("Daylight coefficients have " << m_matrices.begin()->second.numPatches() << " patches, sky vectors have " << numPatches);
+    }
+
+    // each window group contributes its unshaded or shaded coefficients at every timestep
+    struct Contribution
+    {
+      const openstudio::Matrix* unshaded;
+      const openstudio::Matrix* shaded;
+      const std::vector<bool>* schedule;
+    };
+
+    std::vector<Contribution> contributions;
+    const std::string shadeSuffix = "_SHADE";
+    for (const auto& matrix : m_matrices){
+      const std::string& name = matrix.first;
+      if (name.size() > shadeSuffix.size() && name.compare(name.size() - shadeSuffix.size(), shadeSuffix.size(), shadeSuffix) == 0){
+        continue;
+      }
+
+      Contribution contribution = {&matrix.second.coefficients(), nullptr, nullptr};
+
+      auto shaded = m_matrices.find(name + shadeSuffix);
+      auto schedule = shadeSchedules.find(name);
+      if (shaded != m_matrices.end() && schedule != shadeSchedules.end()){
+        if (schedule->second.size() != numTimesteps){
+          LOG_AND_THROW("Shade schedule of window group '" << name << "' has " << schedule->second.size() << " values for " << numTimesteps << " timesteps");
+        }
+        contribution.shaded = &shaded->second.coefficients();
+        contribution.schedule = &schedule->second;
+      }
+
+      contributions.push_back(contribution);
+    }
+
+    // ublas matrices are row major, so sensor rows and sky vectors are contiguous
+    openstudio::Matrix result(numSensors, numTimesteps);
+    parallelFor(numTimesteps, [&](size_t t) {
+      const double* skyVector = &sky.data()[t * numPatches];
+      for (size_t i = 0; i < numSensors; ++i){
+        double sum = 0.0;
+        for (const Contribution& contribution : contributions){
+          const openstudio::Matrix* coefficients = contribution.unshaded;
+          if (contribution.schedule && (*contribution.schedule)[t]){
+            coefficients = contribution.shaded;
+          }
+
+          const double* row = &coefficients->data()[i * numPatches];
+          for (size_t p = 0; p < numPatches; ++p){
+            sum += row[p] * skyVector[p];
+          }
+        }
+        result(i, t) = radianceLuminousEfficacy * sum;
+      }
+    });
+
+    return result;
+  }
+
+} // radiance
+} // openstudio
@@ -0,0 +1,205 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef RADIANCE_DAYLIGHTCOEFFICIENTS_HPP
+#define RADIANCE_DAYLIGHTCOEFFICIENTS_HPP
+
+#include "RadianceAPI.hpp"
+
+#include "../utilities/data/Matrix.hpp"
+#include "../utilities/geometry/Vector3d.hpp"
+#include "../utilities/time/DateTime.hpp"
+#include "../utilities/core/Logger.hpp"
+#include "../utilities/core/Path.hpp"
+
+#include <boost/optional.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace openstudio{
+
+  class EpwFile;
+
+namespace radiance{
+
+  /** SkyVectors holds the radiance of each sky patch for a series of timesteps.  Patches follow the Tregenza
+   *  subdivision used by skies/dc_sky.rad and options/treg.opt: patch 0 is the ground, patches 1 to 145 are
+   *  the sky in rows of 30, 30, 24, 24, 18, 12 and 6 patches from the horizon up, followed by the zenith
+   *  cap.  Within a row the first patch is centered on north (+y) and patches proceed toward east (+x).
+   *  Values are radiance in Radiance units, luminance in cd/m^2 is 179 times the value.
+   */
+  class RADIANCE_API SkyVectors
+  {
+    public:
+
+      /// constructor from values with one row per timestep and one column per patch, will throw if sizes do not match
+      SkyVectors(const std::vector<openstudio::DateTime>& dateTimes, const openstudio::Matrix& values);
+
+      /// build sky vectors from the direct normal and diffuse horizontal illuminance of each weather record,
+      /// the diffuse sky is uniform and the sun is placed in the patch containing the solar position at the
+      /// middle of the record, the ground reflects the global horizontal illuminance diffusely
+      static SkyVectors fromEpwFile(openstudio::EpwFile& epwFile, double groundReflectance = 0.2);
+
+      /// load a sky matrix written by gendaymtx, rows are patches and columns are timesteps,
+      /// color channels are combined with the Radiance luminous weights, timesteps are taken as hourly
+      /// records ending at 1:00 on January 1 and onward
+      static boost::optional<SkyVectors> load(const openstudio::path& path);
+
+      /// number of patches, including the ground
+      static unsigned numPatches();
+
+      /// direction to the center of a patch
+      static openstudio::Vector3d patchDirection(unsigned patch);
+
+      /// solid angle of a patch in steradians
+      static double patchSolidAngle(unsigned patch);
+
+      /// patch containing a direction
+      static unsigned patchIndex(const openstudio::Vector3d& direction);
+
+      std::vector<openstudio::DateTime> dateTimes() const;
+
+      /// one row per timestep and one column per patch
+      const openstudio::Matrix& values() const;
+
+    private:
+
+      REGISTER_LOGGER("openstudio.radiance.SkyVectors");
+
+      std::vector<openstudio::DateTime> m_dateTimes;
+      openstudio::Matrix m_values;
+  };
+
+  /** DaylightCoefficientMatrix relates the radiance of each sky patch to the illuminance at a set of sensor
+   *  points, one row per sensor and one column per patch.  Matrices are read from the Radiance matrix files
+   *  written by rfluxmtx, rcontrib or rmtxop, color channels are combined with the Radiance luminous weights.
+   */
+  class RADIANCE_API DaylightCoefficientMatrix
+  {
+    public:
+
+      /// default constructor, no sensors
+      DaylightCoefficientMatrix();
+
+      /// constructor from coefficients
+      DaylightCoefficientMatrix(const openstudio::Matrix& coefficients);
+
+      /// load a Radiance matrix file in ascii, float or double format
+      static boost::optional<DaylightCoefficientMatrix> load(const openstudio::path& path);
+
+      /// save as a Radiance matrix file in double format, returns false if the file could not be written
+      bool save(const openstudio::path& path) const;
+
+      unsigned numSensors() const;
+
+      unsigned numPatches() const;
+
+      const openstudio::Matrix& coefficients() const;
+
+    private:
+
+      REGISTER_LOGGER("openstudio.radiance.DaylightCoefficientMatrix");
+
+      openstudio::Matrix m_coefficients;
+  };
+
+  /** DaylightCoefficients combines the coefficient matrices of the window groups of a translated Radiance model
+   *  into annual illuminance.  Matrices are cached on disk under the geometry hash of the model, so a new weather
+   *  file or shade schedule only needs a sky vector multiply.  The matrix of a window group with its shade deployed
+   *  is named after the window group with a "_SHADE" suffix, as the shade files written by ForwardTranslator.
+   *
+   *  Matrices are only accepted for the window groups exported by ForwardTranslator.  Uncached matrices are built
+   *  from the rfluxmtx outputs named in the window group annotations, the view matrix output/dc/<window group>.vmx
+   *  (sensors by window patches) and the daylight matrix output/dc/<window group>.dmx (window patches by sky
+   *  patches).  Radiance itself is not run, the outputs have to be computed before calling loadWindowGroupMatrix.
+   */
+  class RADIANCE_API DaylightCoefficients
+  {
+    public:
+
+      /// constructor with the output directory of ForwardTranslator::translateModel and a cache directory,
+      /// the cache directory should not be inside the model directory as translation clears it
+      DaylightCoefficients(const openstudio::path& radDir, const openstudio::path& cacheDir);
+
+      /// checksum of the scene, material, sensor, option and bsdf files of the model
+      std::string geometryHash() const;
+
+      /// names of the window groups exported to scene/glazing and of the shaded window groups exported to scene/shades
+      std::vector<std::string> windowGroupNames() const;
+
+      /// path at which the matrix of a window group is cached for the current geometry
+      openstudio::path cachePath(const std::string& name) const;
+
+      /// load the matrix of a window group from the cache, returns false if it has to be computed
+      /// or if name is not an exported window group
+      bool loadCachedMatrix(const std::string& name);
+
+      /// load the matrix of a window group from the cache, or else compute it from the view and daylight matrices
+      /// of the window group in output/dc, the transmission between them is output/dc/<name>.tmx if it exists
+      /// (e.g. a Klems BSDF written with rmtxop) and is otherwise taken to be the identity,
+      /// returns false if name is not an exported window group or the outputs are missing or do not match
+      bool loadWindowGroupMatrix(const std::string& name);
+
+      /// load the matrices of all exported window groups, returns false if any could not be loaded
+      bool loadWindowGroupMatrices();
+
+      /// add the matrix of a window group and write it to the cache, returns false if name is not an exported window group,
+      /// the number of sensors or patches does not match the other matrices or the cache could not be written
+      bool addMatrix(const std::string& name, const DaylightCoefficientMatrix& matrix);
+
+      /// names of the matrices added or loaded so far
+      std::vector<std::string> names() const;
+
+      /// illuminance in lux, one row per sensor and one column per timestep, computed on all available cores,
+      /// the shade schedule of a window group tells whether its shade is deployed for each timestep,
+      /// window groups without a schedule or without a shade matrix are never shaded, will throw if sizes do not match
+      openstudio::Matrix illuminance(const SkyVectors& skyVectors,
+                                     const std::map<std::string, std::vector<bool> >& shadeSchedules = std::map<std::string, std::vector<bool> >()) const;
+
+    private:
+
+      REGISTER_LOGGER("openstudio.radiance.DaylightCoefficients");
+
+      bool isWindowGroup(const std::string& name) const;
+
+      bool checkSize(const std::string& name, const DaylightCoefficientMatrix& matrix) const;
+
+      openstudio::path m_radDir;
+      openstudio::path m_cacheDir;
+      std::string m_geometryHash;
+      std::vector<std::string> m_windowGroupNames;
+      std::map<std::string, DaylightCoefficientMatrix> m_matrices;
+  };
+
+} // radiance
+} // openstudio
+
+#endif //RADIANCE_DAYLIGHTCOEFFICIENTS_HPP
@@ -80,6 +80,7 @@
 #include "../utilities/time/DateTime.hpp"
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/Transformation.hpp"
+#include "../utilities/core/ParallelFor.hpp"
 #include "../utilities/bcl/BCL.hpp"
 #include "../utilities/bcl/RemoteBCL.hpp"
 #include "../utilities/bcl/LocalBCL.hpp"
@@ -174,7 +175,8 @@ namespace radiance {
 
   // basic constructor
   ForwardTranslator::ForwardTranslator()
-    : m_windowGroupId(1) // m_windowGroupId is reserved for uncontrolled
+    : m_windowGroupId(1), // m_windowGroupId is reserved for uncontrolled
+      m_parallelExport(false)
   {
     m_logSink.setLogLevel(Warn);
     m_logSink.setChannelRegex(boost::regex("openstudio\\.radiance\\.ForwardTranslator"));
@@ -470,6 +472,11 @@ namespace radiance {
     return outfiles;
   }
 
+  void ForwardTranslator::setParallelExport(bool parallelExport)
+  {
+    m_parallelExport = parallelExport;
+  }
+
   std::vector<LogMessage> ForwardTranslator::warnings() const
   {
     std::vector<LogMessage> result;
@@ -496,55 +503,132 @@ namespace radiance {
     return result;
   }
 
-  openstudio::Point3dVector ForwardTranslator::getPolygon(const openstudio::model::Surface& surface)
-  {
-    openstudio::Point3dVector result;
+  namespace {
 
-    Transformation buildingTransformation;
-    OptionalBuilding building = surface.model().getOptionalUniqueModelObject<Building>();
-    if (building){
-      buildingTransformation = building->transformation();
-    }
+    /// model data needed to compute the polygon of one surface, gathered on the calling thread
+    struct SurfacePolygonInput
+    {
+      Transformation transformation;
+      Point3dVector vertices;
+      std::vector<Point3dVector> subSurfaceVertices;
+    };
 
-    Transformation spaceTransformation;
-    OptionalSpace space = surface.space();
-    if (space){
-      spaceTransformation = space->transformation();
-    }
+    /// surface polygon with sub surfaces subtracted in absolute coordinates, does not touch the model
+    struct SurfacePolygonOutput
+    {
+      Point3dVector polygon;
+      std::vector<std::string> warnings;
+    };
+
+    /// file written by buildingSpaces
+    struct PendingFile
+    {
+      PendingFile(const openstudio::path& t_path, const std::string& t_contents, bool t_sceneFile)
+        : path(t_path), contents(t_contents), sceneFile(t_sceneFile), written(false)
+      {}
 
-    // transformation from space coordinates to face coordinates
-    Transformation alignFace = Transformation::alignFace(surface.vertices());
+      openstudio::path path;
+      std::string contents;
+      bool sceneFile;
+      bool written;
+    };
 
-    // get the current vertices and convert to face coordinates
-    Point3dVector surfaceFaceVertices = alignFace.inverse()*surface.vertices();
+    SurfacePolygonInput makePolygonInput(const Surface& surface)
+    {
+      SurfacePolygonInput input;
+
+      Transformation buildingTransformation;
+      OptionalBuilding building = surface.model().getOptionalUniqueModelObject<Building>();
+      if (building){
+        buildingTransformation = building->transformation();
+      }
 
-    // subtract sub surface polygons from surface polygon
-    QPolygonF outer;
-    for (const Point3d& point : surfaceFaceVertices){
-      if (std::abs(point.z()) > 0.001){
-        LOG(Warn, "Surface point z not on plane, z =" << point.z());
+      Transformation spaceTransformation;
+      OptionalSpace space = surface.space();
+      if (space){
+        spaceTransformation = space->transformation();
       }
-      outer << QPointF(point.x(),point.y());
+
+      input.transformation = buildingTransformation*spaceTransformation;
+      input.vertices = surface.vertices();
+      for (const SubSurface& subSurface : surface.subSurfaces()){
+        input.subSurfaceVertices.push_back(subSurface.vertices());
+      }
+
+      return input;
     }
 
-    for (const SubSurface& subSurface : surface.subSurfaces()){
-      Point3dVector subsurfaceFaceVertices = alignFace.inverse()*subSurface.vertices();
-      QPolygonF inner;
-      for (const Point3d& point : subsurfaceFaceVertices){
+    SurfacePolygonOutput makePolygonOutput(const SurfacePolygonInput& input)
+    {
+      SurfacePolygonOutput output;
+
+      // air walls are not translated
+      if (input.vertices.empty()){
+        return output;
+      }
+
+      // transformation from space coordinates to face coordinates
+      Transformation alignFace = Transformation::alignFace(input.vertices);
+      Transformation alignFaceInverse = alignFace.inverse();
+
+      // get the current vertices and convert to face coordinates
+      Point3dVector surfaceFaceVertices = alignFaceInverse*input.vertices;
+
+      // subtract sub surface polygons from surface polygon
+      QPolygonF outer;
+      for (const Point3d& point : surfaceFaceVertices){
         if (std::abs(point.z()) > 0.001){
-          LOG(Warn, "Subsurface point z not on plane, z =" << point.z());
+          std::stringstream ss;
+          ss << "Surface point z not on plane, z =" << point.z();
+          output.warnings.push_back(ss.str());
+        }
+        outer << QPointF(point.x(),point.y());
+      }
+
+      for (const Point3dVector& subSurfaceVertices : input.subSurfaceVertices){
+        Point3dVector subsurfaceFaceVertices = alignFaceInverse*subSurfaceVertices;
+        QPolygonF inner;
+        for (const Point3d& point : subsurfaceFaceVertices){
+          if (std::abs(point.z()) > 0.001){
+            std::stringstream ss;
+            ss << "Subsurface point z not on plane, z =" << point.z();
+            output.warnings.push_back(ss.str());
+          }
+          inner << QPointF(point.x(),point.y());
         }
-        inner << QPointF(point.x(),point.y());
+        outer = outer.subtracted(inner);
+      }
+
+      Point3dVector result;
+      for (const QPointF& point : outer){
+        result.push_back(openstudio::Point3d(point.x(),point.y(), 0));
       }
-      outer = outer.subtracted(inner);
 
+      output.polygon = input.transformation*alignFace*result;
+      return output;
     }
 
-    for (const QPointF& point : outer){
-      result.push_back(openstudio::Point3d(point.x(),point.y(), 0));
+    /// writes the files, sets written if the file could be opened
+    void writeFiles(std::vector<PendingFile>& files, bool parallel)
+    {
+      parallelFor(files.size(), [&files](size_t i) {
+        OFSTREAM file(files[i].path);
+        if (file.is_open()){
+          file << files[i].contents;
+          files[i].written = true;
+        }
+      }, parallel);
     }
 
-    return buildingTransformation*spaceTransformation*alignFace*result;
+  }
+
+  openstudio::Point3dVector ForwardTranslator::getPolygon(const openstudio::model::Surface& surface)
+  {
+    SurfacePolygonOutput output = makePolygonOutput(makePolygonInput(surface));
+    for (const std::string& warning : output.warnings){
+      LOG(Warn, warning);
+    }
+    return output.polygon;
   }
 
   openstudio::Point3dVector ForwardTranslator::getPolygon(const openstudio::model::SubSurface& subSurface)
@@ -1076,25 +1160,65 @@ namespace radiance {
   void ForwardTranslator::buildingSpaces(const openstudio::path &t_radDir, const std::vector<openstudio::model::Space> &t_spaces,
       std::vector<openstudio::path> &t_outfiles)
   {
-    std::vector<std::string> space_names;
+    if (t_spaces.empty()){
+      return;
+    }
 
+    // files are queued as the spaces are processed and written out together at the end,
+    // a file queued more than once keeps its last contents
+    std::vector<PendingFile> pendingFiles;
+    std::map<openstudio::path, size_t> pendingFileIndices;
+    auto queueFile = [&pendingFiles, &pendingFileIndices](const openstudio::path& path, const std::string& contents, bool sceneFile) {
+      auto it = pendingFileIndices.find(path);
+      if (it == pendingFileIndices.end()){
+        pendingFileIndices[path] = pendingFiles.size();
+        pendingFiles.push_back(PendingFile(path, contents, sceneFile));
+      } else{
+        pendingFiles[it->second].contents = contents;
+      }
+    };
 
+    // gather the vertices of all surfaces, the model is only accessed from this thread
+    std::vector<std::vector<openstudio::model::Surface> > spaceSurfaces;
+    std::vector<SurfacePolygonInput> polygonInputs;
     for (const auto & space : t_spaces)
     {
+      spaceSurfaces.push_back(space.surfaces());
+      for (const auto & surface : spaceSurfaces.back())
+      {
+        if (surface.isAirWall()){
+          polygonInputs.push_back(SurfacePolygonInput());
+        } else{
+          polygonInputs.push_back(makePolygonInput(surface));
+        }
+      }
+    }
+
+    // subtracting sub surfaces is independent for each surface
+    std::vector<SurfacePolygonOutput> polygonOutputs(polygonInputs.size());
+    parallelFor(polygonInputs.size(), [&polygonInputs, &polygonOutputs](size_t i) {
+      polygonOutputs[i] = makePolygonOutput(polygonInputs[i]);
+    }, m_parallelExport);
+    size_t polygonIndex = 0;
+
+    for (size_t spaceIndex = 0; spaceIndex < t_spaces.size(); ++spaceIndex)
+    {
+      const openstudio::model::Space& space = t_spaces[spaceIndex];
       std::string space_name = cleanName(space.name().get());
 
-      space_names.push_back(space_name);
       LOG(Debug, "Processing space: " << space_name);
 
       // split model into zone-based Radiance .rad files
-      m_radSpaces[space_name] = "#\n# geometry file for space: " + space_name + "\n#\n\n";
+      std::string& spaceGeometry = m_radSpaces[space_name];
+      spaceGeometry = "#\n# geometry file for space: " + space_name + "\n#\n\n";
 
       // loop over surfaces in space
 
-      std::vector<openstudio::model::Surface> surfaces = space.surfaces();
+      const std::vector<openstudio::model::Surface>& surfaces = spaceSurfaces[spaceIndex];
 
       for (const auto & surface : surfaces)
       {
+        const SurfacePolygonOutput& polygonOutput = polygonOutputs[polygonIndex++];
 
         // skip if air wall
         if (surface.isAirWall()){
@@ -1104,11 +1228,11 @@ namespace radiance {
         std::string surface_name = cleanName(surface.name().get());
 
         // add surface to space geometry
-        m_radSpaces[space_name] += "# surface: " + surface_name + "\n";
+        spaceGeometry += "# surface: " + surface_name + "\n";
 
         // set construction of surface
         std::string constructionName = surface.getString(2).get();
-        m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+        spaceGeometry += "# construction: " + constructionName + "\n";
 
         // get reflectances
         double interiorVisibleReflectance = 0.5; // default for space surfaces
@@ -1123,14 +1247,17 @@ namespace radiance {
         }
 
         // create polygon object
-        openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(surface);
+        for (const std::string& warning : polygonOutput.warnings){
+          LOG(Warn, warning);
+        }
+        openstudio::Point3dVector polygon = polygonOutput.polygon;
 
 
         if (!surface.adjacentSurface()){
           // 2-sided material
 
           // header
-          m_radSpaces[space_name] += "# reflectance (int) = " + formatString(interiorVisibleReflectance, 3) + \
+          spaceGeometry += "# reflectance (int) = " + formatString(interiorVisibleReflectance, 3) + \
           "\n# reflectance (ext) = " + formatString(exteriorVisibleReflectance, 3) + "\n";
 
           // material definition
@@ -1152,14 +1279,14 @@ namespace radiance {
               "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
 
           // polygon reference
-          m_radSpaces[space_name] += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
+          spaceGeometry += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
               "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3) + " polygon " + \
               surface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
         }else{
           // interior-only material
 
           // header
-          m_radSpaces[space_name] += "# reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+          spaceGeometry += "# reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
 
           // material definition
           m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3)
@@ -1168,7 +1295,7 @@ namespace radiance {
             + " " + formatString(interiorVisibleReflectance, 3) + " 0 0\n");
 
           // polygon reference
-          m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3)
+          spaceGeometry += "refl_" + formatString(interiorVisibleReflectance, 3)
           + " polygon " + surface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
 
         };
@@ -1177,11 +1304,11 @@ namespace radiance {
         // add polygon vertices
         for (const auto & vertex : polygon)
         {
-          m_radSpaces[space_name] += formatString(vertex.x()) + " "
+          spaceGeometry += formatString(vertex.x()) + " "
             + formatString(vertex.y()) + " "
             + formatString(vertex.z()) + "\n";
         }
-        m_radSpaces[space_name] += "\n";
+        spaceGeometry += "\n";
 
         // end(surface)
 
@@ -1429,20 +1556,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  spaceGeometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  spaceGeometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
                                         formatString(exteriorVisibleReflectance, 3) + " " + \
                                         formatString(exteriorVisibleReflectance, 3) + " " + \
                                         formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] += "refl_" + formatString(exteriorVisibleReflectance, 3) + " polygon outside_reveal_" + subSurface_name + formatString(i, 0) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  spaceGeometry += "refl_" + formatString(exteriorVisibleReflectance, 3) + " polygon outside_reveal_" + subSurface_name + formatString(i, 0) + "\n";
+                  spaceGeometry += "0\n0\n" + formatString(4 * 3) + "\n";
+                  spaceGeometry += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
 
                 // make interior sill/reveal surfaces
@@ -1459,20 +1586,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  spaceGeometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  spaceGeometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
                                         formatString(interiorVisibleReflectance, 3) + " " + \
                                         formatString(interiorVisibleReflectance, 3) + " " + \
                                         formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_reveal_" + subSurface_name + formatString(i, 0) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  spaceGeometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_reveal_" + subSurface_name + formatString(i, 0) + "\n";
+                  spaceGeometry += "0\n0\n" + formatString(4 * 3) + "\n";
+                  spaceGeometry += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
 
                 if (insideSillDepth && (*insideSillDepth > 0.0)){
@@ -1488,20 +1615,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  spaceGeometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  spaceGeometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
                                         formatString(interiorVisibleReflectance, 3) + " " + \
                                         formatString(interiorVisibleReflectance, 3) + " " + \
                                         formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_sill_" + subSurface_name + formatString(i, 0) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  spaceGeometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_sill_" + subSurface_name + formatString(i, 0) + "\n";
+                  spaceGeometry += "0\n0\n" + formatString(4 * 3) + "\n";
+                  spaceGeometry += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
               }
             }
@@ -1544,23 +1671,11 @@ namespace radiance {
 									switchableGroup_wgMats = "void " + rMaterial + " " + windowGroup_name + "\n" + matString + "\n";
 									
 									openstudio::path filename = t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + "_clear.mat");
-									OFSTREAM file(filename);
-									if (file.is_open()){
-										t_outfiles.push_back(filename);
-										file << switchableGroup_wgMats;
-									} else{
-										LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-									}
+									queueFile(filename, switchableGroup_wgMats, false);
 
 									switchableGroup_wgMats = "void " + rMaterial + " " + windowGroup_name + "_TINTED\n" + matStringTinted + "\n\nvoid alias " + windowGroup_name + " " + windowGroup_name + "_TINTED " + "\n\n";
 									openstudio::path filename2 = t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + "_tinted.mat");
-									OFSTREAM file2(filename2);
-									if (file2.is_open()){
-										t_outfiles.push_back(filename2);
-										file2 << switchableGroup_wgMats;
-									} else{
-										LOG(Error, "Cannot open file '" << toString(filename2) << "' for writing");
-									}				
+									queueFile(filename2, switchableGroup_wgMats, false);
 									
 								} else {
 								
@@ -1568,13 +1683,7 @@ namespace radiance {
 									std::string wgMat = "";
 									wgMat = "void " + rMaterial + " " + windowGroup_name + "\n" + matString + "\n\n";
 									openstudio::path wgSingleFilename = t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + ".mat");					
-									OFSTREAM wgSingleFile(wgSingleFilename);
-									if (wgSingleFile.is_open()){
-										t_outfiles.push_back(wgSingleFilename);
-										wgSingleFile << wgMat;
-									} else{
-										LOG(Error, "Cannot open file '" << toString(wgSingleFilename) << "' for writing");
-									}				
+									queueFile(wgSingleFilename, wgMat, false);
 								
 								}
 								
@@ -1649,13 +1758,7 @@ namespace radiance {
 									std::string wgShadeMat = "";
 									wgShadeMat = "void " + rMaterial + " " + windowGroup_name + "_SHADE\n" + matString + "\n\n";
 									openstudio::path wgSingleFilename = t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + "_SHADE.mat");					
-									OFSTREAM wgSingleFile(wgSingleFilename);
-									if (wgSingleFile.is_open()){
-										t_outfiles.push_back(wgSingleFilename);
-										wgSingleFile << wgShadeMat;
-									} else{
-										LOG(Error, "Cannot open file '" << toString(wgSingleFilename) << "' for writing");
-									}				
+									queueFile(wgSingleFilename, wgShadeMat, false);
 
 									
 									
@@ -1763,20 +1866,20 @@ namespace radiance {
             double interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
             double exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
             //polygon header
-            m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-            m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+            spaceGeometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+            spaceGeometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
             // write material
             m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
               formatString(interiorVisibleReflectance, 3) + " " + \
               formatString(interiorVisibleReflectance, 3) + " " + \
               formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
             // write polygon
-            m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
-            m_radSpaces[space_name] += "0\n0\n" + formatString(polygon.size() * 3) + "\n\n";
+            spaceGeometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
+            spaceGeometry += "0\n0\n" + formatString(polygon.size() * 3) + "\n\n";
 
             for (const auto & vertex : polygon)
             {
-              m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+              spaceGeometry += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
             }
 
           } else if (subSurfaceUpCase == "TUBULARDAYLIGHTDOME") {
@@ -1804,11 +1907,11 @@ namespace radiance {
           std::string shadingSurface_name = cleanName(shadingSurface.name().get());
 
           // add surface to zone geometry
-          m_radSpaces[space_name] += "# surface: " + shadingSurface_name + "\n";
+          spaceGeometry += "# surface: " + shadingSurface_name + "\n";
 
           // set construction of space shadingSurface
           std::string constructionName = shadingSurface.getString(2).get();
-          m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+          spaceGeometry += "# construction: " + constructionName + "\n";
 
           // get reflectance
           double interiorVisibleReflectance = 0.25; // default for space shading surfaces
@@ -1840,21 +1943,21 @@ namespace radiance {
               "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
 
           // polygon header
-          m_radSpaces[space_name] += "# exterior visible reflectance: " + formatString(exteriorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "# interior visible reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+          spaceGeometry += "# exterior visible reflectance: " + formatString(exteriorVisibleReflectance, 3) + "\n";
+          spaceGeometry += "# interior visible reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
 
           // get / write surface polygon
 
           openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(shadingSurface);
-          m_radSpaces[space_name] += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
+          spaceGeometry += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
               "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3) + " polygon " + \
           shadingSurface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
 
           for (const auto & vertex : polygon)
           {
-            m_radSpaces[space_name] += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
+            spaceGeometry += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
           }
-          m_radSpaces[space_name] += "\n";
+          spaceGeometry += "\n";
 
         }
       } // end shading surfaces
@@ -1883,11 +1986,11 @@ namespace radiance {
 
           // add surface to zone geometry
 
-          m_radSpaces[space_name] += "# surface: " + interiorPartitionSurface_name + "\n";
+          spaceGeometry += "# surface: " + interiorPartitionSurface_name + "\n";
 
           // set construction of interiorPartitionSurface
           std::string constructionName = interiorPartitionSurface.getString(1).get();
-          m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+          spaceGeometry += "# construction: " + constructionName + "\n";
 
          // get reflectance
           double interiorVisibleReflectance = 0.5; // set some default
@@ -1908,16 +2011,16 @@ namespace radiance {
             formatString(interiorVisibleReflectance, 3) + " " + \
             formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
           // polygon header
-          m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+          spaceGeometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+          spaceGeometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
           // get / write surface polygon
 
           openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(interiorPartitionSurface);
-          m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + \
+          spaceGeometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + \
           interiorPartitionSurface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
           for (const auto & vertex : polygon)
           {
-            m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+            spaceGeometry += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
           }
         }
       } // end interior partitions
@@ -1950,13 +2053,7 @@ namespace radiance {
 
         // write daylighting controls
         openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(space_name + ".sns");
-        OFSTREAM file(filename);
-        if (file.is_open()){
-          t_outfiles.push_back(filename);
-          file << m_radSensors[space_name];
-        } else{
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        queueFile(filename, m_radSensors[space_name], false);
 
         // write daylighting control view file
         m_radSensorViews[space_name] = "";
@@ -1971,13 +2068,7 @@ namespace radiance {
         " -vu 0 1 0 -vh 180 -vv 180 -vo 0 -vs 0 -vl 0\n";
 
         filename = t_radDir / openstudio::toPath("views") / openstudio::toPath(space_name + "_dc.vfh");
-        OFSTREAM file2(filename);
-        if (file2.is_open()){
-          t_outfiles.push_back(filename);
-          file2 << m_radSensorViews[space_name];
-        } else{
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        queueFile(filename, m_radSensorViews[space_name], false);
 
         LOG(Debug, "Wrote " << space_name << "_dc.vfh");
 
@@ -2040,37 +2131,19 @@ namespace radiance {
 
         // write glare sensors
         openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(space_name + "_" + sensor_name + ".glr");
-        OFSTREAM file(filename);
-        if (file.is_open()){
-          t_outfiles.push_back(filename);
-          file << m_radGlareSensors[space_name];
-        } else{
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        queueFile(filename, m_radGlareSensors[space_name], false);
 
         LOG(Debug, "Wrote " << space_name << ".glr");
 
         // write glare sensor views (perspective)
         filename = t_radDir / openstudio::toPath("views") / openstudio::toPath(space_name + "_" + sensor_name + "_gs.vfv");
-        OFSTREAM file2(filename);
-        if (file2.is_open()){
-          t_outfiles.push_back(filename);
-          file2 << m_radGlareSensorViewsVTV[space_name];
-        } else{
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        queueFile(filename, m_radGlareSensorViewsVTV[space_name], false);
 
         LOG(Debug, "Wrote " << space_name << "_" << sensor_name << "_gs.vfv");
 
         // write glare sensor views (fisheye)
         filename = t_radDir / openstudio::toPath("views") / openstudio::toPath(space_name + "_" + sensor_name + "_gs.vfh");
-        OFSTREAM file3(filename);
-        if (file3.is_open()){
-          t_outfiles.push_back(filename);
-          file3 << m_radGlareSensorViewsVTA[space_name];
-        } else{
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        queueFile(filename, m_radGlareSensorViewsVTA[space_name], false);
 
         LOG(Debug, "Wrote " << space_name << "_" << sensor_name << "_gs.vfh");
 
@@ -2085,189 +2158,139 @@ namespace radiance {
         m_radMaps[space_name] = "";
         m_radMapHandles[space_name] = map.handle();
 
+        std::vector<Point3d> referencePoints = openstudio::radiance::ForwardTranslator::getReferencePoints(map);
+        for (const auto & point : referencePoints)
+        {
+          m_radMaps[space_name] += "" + formatString(point.x(), 3) + " " + formatString(point.y(), 3) + " " + formatString(point.z(), 3) + " 0.000 0.000 1.000\n";
+        }
+
         // write map file
         openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(space_name + ".map");
-        OFSTREAM file(filename);
-        if (file.is_open()){
-          t_outfiles.push_back(filename);
-
-          std::vector<Point3d> referencePoints = openstudio::radiance::ForwardTranslator::getReferencePoints(map);
-          for (const auto & point : referencePoints)
-          {
-            m_radMaps[space_name] += "" + formatString(point.x(), 3) + " " + formatString(point.y(), 3) + " " + formatString(point.z(), 3) + " 0.000 0.000 1.000\n";
-          }
-          file << m_radMaps[space_name];
-        } else{
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        queueFile(filename, m_radMaps[space_name], false);
 
         LOG(Debug, "wrote " << space_name << ".map");
       } //end illuminance map
 
 
       // write geometry
-      openstudio::path filename = t_radDir / openstudio::toPath("scene") / openstudio::toPath(space_name + ".rad");
-      OFSTREAM file(filename);
-      if (file.is_open()){
-        t_outfiles.push_back(filename);
-        m_radSceneFiles.push_back(filename);
-        file << m_radSpaces[space_name];
-      } else{
-        LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-      }
+      queueFile(t_radDir / openstudio::toPath("scene") / openstudio::toPath(space_name + ".rad"), spaceGeometry, true);
 
-      for (const auto & windowGroup : m_windowGroups)
-      {
-        std::string windowGroup_name = windowGroup.name();
+    } // end spaces
 
-        //write windows (and glazed doors)
-        if (m_radWindowGroups.find(windowGroup_name) != m_radWindowGroups.end())
-        {
+    // get the Radiance parameters... so we have them.
+    openstudio::model::RadianceParameters radianceParameters = m_model.getUniqueModelObject<openstudio::model::RadianceParameters>();
 
-          // get the Radiance parameters... so we have them.
-          openstudio::model::RadianceParameters radianceParameters = m_model.getUniqueModelObject<openstudio::model::RadianceParameters>();
-          if(windowGroup_name != "WG0"){
-						if (radianceParameters.skyDiscretizationResolution() == "146"){
-							LOG(Info, "writing out window group '" + windowGroup_name + "', using Klems sampling basis.");
-						} else if (radianceParameters.skyDiscretizationResolution() == "578"){
-							LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
-						} else if (radianceParameters.skyDiscretizationResolution() == "2306"){
-							LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
-						}
-					}
-
-          openstudio::path glazefilename = t_radDir / openstudio::toPath("scene/glazing") / openstudio::toPath(windowGroup_name + ".rad");
-          OFSTREAM glazefile(glazefilename);
-          if (glazefile.is_open()){
-            t_outfiles.push_back(glazefilename);
-            m_radSceneFiles.push_back(glazefilename);
-            glazefile << m_radWindowGroups[windowGroup_name];
-          } else{
-            LOG(Error, "Cannot open file '" << toString(glazefilename) << "' for writing");
-          }
+    for (const auto & windowGroup : m_windowGroups)
+    {
+      std::string windowGroup_name = windowGroup.name();
 
-          if(windowGroup_name != "WG0" && !m_radWindowGroupShades[windowGroup_name].empty()){
-            openstudio::path shadefilename = t_radDir / openstudio::toPath("scene/shades") / openstudio::toPath(windowGroup_name + "_SHADE.rad");
-            OFSTREAM shadefile(shadefilename);
-            if (shadefile.is_open()){
-              t_outfiles.push_back(shadefilename);
-              m_radSceneFiles.push_back(shadefilename);
-              shadefile << m_radWindowGroupShades[windowGroup_name];
-            } else{
-              LOG(Error, "Cannot open file '" << toString(shadefilename) << "' for writing");
-            }
-          }
+      //write windows (and glazed doors)
+      if (m_radWindowGroups.find(windowGroup_name) != m_radWindowGroups.end())
+      {
 
-          // write window group control points
-          // only write for controlled window groups
-          if(windowGroup_name != "WG0"){
-            openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(windowGroup_name + ".pts");
-            OFSTREAM file(filename);
-            if (file.is_open()){
-              t_outfiles.push_back(filename);
-              file << windowGroup.windowGroupPoints();
-            } else{
-              LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-            }
+        if(windowGroup_name != "WG0"){
+          if (radianceParameters.skyDiscretizationResolution() == "146"){
+            LOG(Info, "writing out window group '" + windowGroup_name + "', using Klems sampling basis.");
+          } else if (radianceParameters.skyDiscretizationResolution() == "578"){
+            LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
+          } else if (radianceParameters.skyDiscretizationResolution() == "2306"){
+            LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
           }
         }
-      }
 
-      // write radiance materials file
-      m_radMaterials.insert("# OpenStudio Materials File\n\n");
-      openstudio::path materialsfilename = t_radDir / openstudio::toPath("materials/materials.rad");
-      OFSTREAM materialsfile(materialsfilename);
-      if (materialsfile.is_open()){
-        t_outfiles.push_back(materialsfilename);
-        for (const auto & line : m_radMaterials)
-        {
-          materialsfile << line;
-        };
-        for (const auto & line : m_radMixMaterials)
-        {
-          materialsfile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materialsfilename) << "' for writing");
-      }
+        queueFile(t_radDir / openstudio::toPath("scene/glazing") / openstudio::toPath(windowGroup_name + ".rad"), m_radWindowGroups[windowGroup_name], true);
 
+        if(windowGroup_name != "WG0" && !m_radWindowGroupShades[windowGroup_name].empty()){
+          queueFile(t_radDir / openstudio::toPath("scene/shades") / openstudio::toPath(windowGroup_name + "_SHADE.rad"), m_radWindowGroupShades[windowGroup_name], true);
+        }
 
-      // write radiance DC vmx materials (lights) file
-      m_radMaterialsDC.insert("# OpenStudio \"vmx\" Materials File\n# controlled windows: material=\"light\", black out all others.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
-      openstudio::path materials_vmxfilename = t_radDir / openstudio::toPath("materials/materials_vmx.rad");
-      OFSTREAM materials_vmxfile(materials_vmxfilename);
-      if (materials_vmxfile.is_open()){
-        t_outfiles.push_back(materials_vmxfilename);
-        for (const auto & line : m_radMaterialsDC)
-        {
-          materials_vmxfile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_vmxfilename) << "' for writing");
-      }
-
-
-      // write radiance WG0 vmx materials file (blacks out controlled window groups)
-      m_radMaterialsWG0.insert("# OpenStudio \"WG0\" Materials File\n# black out all controlled window groups.\n");
-      openstudio::path materials_WG0filename = t_radDir / openstudio::toPath("materials/materials_WG0.rad");
-      OFSTREAM materials_WG0file(materials_WG0filename);
-      if (materials_WG0file.is_open()){
-        t_outfiles.push_back(materials_WG0filename);
-        for (const auto & line : m_radMaterialsWG0)
-        {
-          materials_WG0file << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_WG0filename) << "' for writing");
-      }
-
-      // write radiance blackout materials file (blacks out everything)
-      m_radMaterialsSwitchableBase.insert("# OpenStudio Blackout Materials File\n# black out all window and shade materials.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
-      openstudio::path materials_SwitchableBasefilename = t_radDir / openstudio::toPath("materials/materials_blackout.rad");
-      OFSTREAM materials_SwitchableBasefile(materials_SwitchableBasefilename);
-      if (materials_SwitchableBasefile.is_open()){
-        t_outfiles.push_back(materials_SwitchableBasefilename);
-        for (const auto & line : m_radMaterialsSwitchableBase)
-        {
-          materials_SwitchableBasefile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_SwitchableBasefilename) << "' for writing");
+        // write window group control points
+        // only write for controlled window groups
+        if(windowGroup_name != "WG0"){
+          queueFile(t_radDir / openstudio::toPath("numeric") / openstudio::toPath(windowGroup_name + ".pts"), windowGroup.windowGroupPoints(), false);
+        }
       }
+    }
 
+    // write radiance materials file
+    m_radMaterials.insert("# OpenStudio Materials File\n\n");
+    std::string materials;
+    for (const auto & line : m_radMaterials)
+    {
+      materials += line;
+    };
+    for (const auto & line : m_radMixMaterials)
+    {
+      materials += line;
+    };
+    queueFile(t_radDir / openstudio::toPath("materials/materials.rad"), materials, false);
+
+    // write radiance DC vmx materials (lights) file
+    m_radMaterialsDC.insert("# OpenStudio \"vmx\" Materials File\n# controlled windows: material=\"light\", black out all others.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
+    std::string materials_vmx;
+    for (const auto & line : m_radMaterialsDC)
+    {
+      materials_vmx += line;
+    };
+    queueFile(t_radDir / openstudio::toPath("materials/materials_vmx.rad"), materials_vmx, false);
+
+    // write radiance WG0 vmx materials file (blacks out controlled window groups)
+    m_radMaterialsWG0.insert("# OpenStudio \"WG0\" Materials File\n# black out all controlled window groups.\n");
+    std::string materials_WG0;
+    for (const auto & line : m_radMaterialsWG0)
+    {
+      materials_WG0 += line;
+    };
+    queueFile(t_radDir / openstudio::toPath("materials/materials_WG0.rad"), materials_WG0, false);
+
+    // write radiance blackout materials file (blacks out everything)
+    m_radMaterialsSwitchableBase.insert("# OpenStudio Blackout Materials File\n# black out all window and shade materials.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
+    std::string materials_SwitchableBase;
+    for (const auto & line : m_radMaterialsSwitchableBase)
+    {
+      materials_SwitchableBase += line;
+    };
+    queueFile(t_radDir / openstudio::toPath("materials/materials_blackout.rad"), materials_SwitchableBase, false);
+
+    // write radiance vmx materials list
+    // format of this file is: window group, bsdf, bsdf
+    m_radDCmats.insert("# OpenStudio windowGroup->BSDF \"Mapping\" File\n# windowGroup,inwardNormal,shade control type,shade control setpoint,unshaded bsdf,shaded bsdf\n");
+    std::string materials_dc;
+    for (const auto & line : m_radDCmats)
+    {
+      materials_dc += line;
+    };
+    queueFile(t_radDir / openstudio::toPath("bsdf/mapping.rad"), materials_dc, false);
 
-      // write radiance vmx materials list
-      // format of this file is: window group, bsdf, bsdf
-      m_radDCmats.insert("# OpenStudio windowGroup->BSDF \"Mapping\" File\n# windowGroup,inwardNormal,shade control type,shade control setpoint,unshaded bsdf,shaded bsdf\n");
-      openstudio::path materials_dcfilename = t_radDir / openstudio::toPath("bsdf/mapping.rad");
-      OFSTREAM materials_dcfile(materials_dcfilename);
-      if (materials_dcfile.is_open()){
-        t_outfiles.push_back(materials_dcfilename);
-        for (const auto & line : m_radDCmats)
-        {
-          materials_dcfile << line;
-        };
+    // files do not depend on each other, write them out on worker threads
+    writeFiles(pendingFiles, m_parallelExport);
+    for (const auto & pendingFile : pendingFiles)
+    {
+      if (pendingFile.written){
+        t_outfiles.push_back(pendingFile.path);
+        if (pendingFile.sceneFile){
+          m_radSceneFiles.push_back(pendingFile.path);
+        }
       } else{
-        LOG(Error, "Cannot open file '" << toString(materials_dcfilename) << "' for writing");
+        LOG(Error, "Cannot open file '" << toString(pendingFile.path) << "' for writing");
       }
+    }
 
+    // write complete scene
+    openstudio::path modelfilename = t_radDir / openstudio::toPath("model.rad");
+    OFSTREAM modelfile(modelfilename);
 
-      // write complete scene
-      openstudio::path modelfilename = t_radDir / openstudio::toPath("model.rad");
-      OFSTREAM modelfile(modelfilename);
-
-      if (modelfile.is_open()){
-        t_outfiles.push_back(modelfilename);
+    if (modelfile.is_open()){
+      t_outfiles.push_back(modelfilename);
 
-        std::set<openstudio::path> uniquePaths(m_radSceneFiles.begin(), m_radSceneFiles.end());
+      std::set<openstudio::path> uniquePaths(m_radSceneFiles.begin(), m_radSceneFiles.end());
 
-        for (const auto & filename : uniquePaths)
-        {
-          modelfile << "!xform ./" << openstudio::toString(openstudio::relativePath(filename, t_radDir)) << std::endl;
-        }
-      } else{
-        LOG(Error, "Cannot open file '" << toString(modelfilename) << "' for writing");
+      for (const auto & filename : uniquePaths)
+      {
+        modelfile << "!xform ./" << openstudio::toString(openstudio::relativePath(filename, t_radDir)) << std::endl;
       }
+    } else{
+      LOG(Error, "Cannot open file '" << toString(modelfilename) << "' for writing");
     }
   }
 
@@ -67,6 +67,12 @@ namespace radiance {
      */
     std::vector<openstudio::path> translateModel(const openstudio::path& outPath, const openstudio::model::Model& model);
 
+    /** If parallelExport, the surface polygons of all spaces are computed and the space, window group and material
+     *  files are written on worker threads.  The model is only accessed from the calling thread, output is identical
+     *  to a serial export.  Defaults to false.
+     */
+    void setParallelExport(bool parallelExport);
+
     /** Get warning messages generated by the last translation.
      */
     std::vector<LogMessage> warnings() const;
@@ -153,6 +159,7 @@ namespace radiance {
       std::map<std::string, std::string> m_radWindowGroups;
       std::map<std::string, std::string> m_radWindowGroupShades;
       int m_windowGroupId;
+      bool m_parallelExport;
       std::string shadeBSDF;
 
       // get window group
@@ -0,0 +1,379 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../DaylightCoefficients.hpp"
+#include "../ForwardTranslator.hpp"
+#include "../../model/Model.hpp"
+#include "../../model/Shade.hpp"
+#include "../../model/ShadingControl.hpp"
+#include "../../model/SubSurface.hpp"
+
+#include "../../utilities/filetypes/EpwFile.hpp"
+#include "../../utilities/core/PathHelpers.hpp"
+#include "../../utilities/core/Compare.hpp"
+
+#include <resources.hxx>
+
+#include <boost/math/constants/constants.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+using namespace openstudio;
+using namespace openstudio::model;
+using namespace openstudio::radiance;
+
+TEST(Radiance, SkyVectors_Patches)
+{
+  const double pi = boost::math::constants::pi<double>();
+
+  ASSERT_EQ(146u, SkyVectors::numPatches());
+
+  // sky patches cover the upper hemisphere, the ground covers the lower
+  double sky = 0.0;
+  for (unsigned patch = 1; patch < SkyVectors::numPatches(); ++patch){
+    EXPECT_GT(SkyVectors::patchSolidAngle(patch), 0.0);
+    sky += SkyVectors::patchSolidAngle(patch);
+  }
+  EXPECT_NEAR(2.0 * pi, sky, 1.0e-9);
+  EXPECT_NEAR(2.0 * pi, SkyVectors::patchSolidAngle(0), 1.0e-9);
+
+  EXPECT_NEAR(-1.0, SkyVectors::patchDirection(0).z(), 1.0e-9);
+  EXPECT_NEAR(1.0, SkyVectors::patchDirection(145).z(), 1.0e-9);
+
+  // first patch is centered on north
+  Vector3d north = SkyVectors::patchDirection(1);
+  EXPECT_NEAR(0.0, north.x(), 1.0e-9);
+  EXPECT_GT(north.y(), 0.0);
+
+  // second patch is toward east
+  EXPECT_GT(SkyVectors::patchDirection(2).x(), 0.0);
+
+  for (unsigned patch = 0; patch < SkyVectors::numPatches(); ++patch){
+    EXPECT_EQ(patch, SkyVectors::patchIndex(SkyVectors::patchDirection(patch)));
+  }
+
+  EXPECT_EQ(0u, SkyVectors::patchIndex(Vector3d(1, 1, -1)));
+  EXPECT_EQ(145u, SkyVectors::patchIndex(Vector3d(0, 0, 1)));
+}
+
+TEST(Radiance, SkyVectors_EpwFile)
+{
+  openstudio::path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  EpwFile epwFile(p, true);
+
+  SkyVectors skyVectors = SkyVectors::fromEpwFile(epwFile);
+  ASSERT_EQ(8760u, skyVectors.dateTimes().size());
+  ASSERT_EQ(8760u, skyVectors.values().size1());
+  ASSERT_EQ(SkyVectors::numPatches(), skyVectors.values().size2());
+
+  bool sunUp = false;
+  for (unsigned t = 0; t < skyVectors.values().size1(); ++t){
+    for (unsigned patch = 0; patch < SkyVectors::numPatches(); ++patch){
+      EXPECT_GE(skyVectors.values()(t, patch), 0.0);
+    }
+    if (skyVectors.values()(t, 0) > 0.0){
+      sunUp = true;
+    }
+  }
+  EXPECT_TRUE(sunUp);
+
+  // first record ends at 1:00 on January 1, it is night in Golden
+  for (unsigned patch = 0; patch < SkyVectors::numPatches(); ++patch){
+    EXPECT_EQ(0.0, skyVectors.values()(0, patch));
+  }
+}
+
+TEST(Radiance, DaylightCoefficientMatrix_SaveLoad)
+{
+  openstudio::path dir = openstudio::tempDir() / toPath("DaylightCoefficientMatrix_SaveLoad");
+  openstudio::filesystem::remove_all(dir);
+  openstudio::filesystem::create_directories(dir);
+
+  Matrix coefficients(2, 3);
+  for (unsigned i = 0; i < 2; ++i){
+    for (unsigned j = 0; j < 3; ++j){
+      coefficients(i, j) = 0.1 * i + 0.01 * j + 1.0e-12;
+    }
+  }
+
+  DaylightCoefficientMatrix matrix(coefficients);
+  ASSERT_TRUE(matrix.save(dir / toPath("binary.dmx")));
+
+  boost::optional<DaylightCoefficientMatrix> loaded = DaylightCoefficientMatrix::load(dir / toPath("binary.dmx"));
+  ASSERT_TRUE(loaded);
+  ASSERT_EQ(2u, loaded->numSensors());
+  ASSERT_EQ(3u, loaded->numPatches());
+  for (unsigned i = 0; i < 2; ++i){
+    for (unsigned j = 0; j < 3; ++j){
+      EXPECT_EQ(coefficients(i, j), loaded->coefficients()(i, j));
+    }
+  }
+
+  // ascii rgb output as written by rfluxmtx
+  {
+    std::ofstream file(toString(dir / toPath("ascii.dmx")));
+    file << "#?RADIANCE\n";
+    file << "rfluxmtx -I+ -y 1\n";
+    file << "NROWS=1\n";
+    file << "NCOLS=2\n";
+    file << "NCOMP=3\n";
+    file << "FORMAT=ascii\n";
+    file << "\n";
+    file << "1 1 1\t2 0 0\n";
+  }
+
+  loaded = DaylightCoefficientMatrix::load(dir / toPath("ascii.dmx"));
+  ASSERT_TRUE(loaded);
+  ASSERT_EQ(1u, loaded->numSensors());
+  ASSERT_EQ(2u, loaded->numPatches());
+  EXPECT_NEAR(1.0, loaded->coefficients()(0, 0), 1.0e-9);
+  EXPECT_NEAR(0.53, loaded->coefficients()(0, 1), 1.0e-9);
+
+  // truncated data
+  {
+    std::ofstream file(toString(dir / toPath("truncated.dmx")));
+    file << "#?RADIANCE\nNROWS=2\nNCOLS=2\nNCOMP=1\nFORMAT=ascii\n\n1 2 3\n";
+  }
+  EXPECT_FALSE(DaylightCoefficientMatrix::load(dir / toPath("truncated.dmx")));
+  EXPECT_FALSE(DaylightCoefficientMatrix::load(dir / toPath("missing.dmx")));
+}
+
+TEST(Radiance, DaylightCoefficients_Illuminance)
+{
+  const double pi = boost::math::constants::pi<double>();
+
+  openstudio::path dir = openstudio::tempDir() / toPath("DaylightCoefficients_Illuminance");
+  openstudio::filesystem::remove_all(dir);
+  openstudio::path radDir = dir / toPath("model");
+  openstudio::path cacheDir = dir / toPath("cache");
+  openstudio::filesystem::create_directories(radDir / toPath("scene/glazing"));
+  openstudio::filesystem::create_directories(radDir / toPath("scene/shades"));
+  {
+    std::ofstream file(toString(radDir / toPath("scene/model.rad")));
+    file << "void plastic floor 0 0 5 0.2 0.2 0.2 0 0\n";
+  }
+  for (const std::string& name : {"glazing/WG1", "glazing/WG2", "shades/WG1_SHADE"}){
+    std::ofstream file(toString(radDir / toPath("scene/" + name + ".rad")));
+    file << "# OpenStudio Window Group\n";
+  }
+
+  // a horizontal sensor under an unobstructed sky sees each patch weighted by its projected solid angle
+  const unsigned numPatches = SkyVectors::numPatches();
+  Matrix open(1, numPatches);
+  Matrix shaded(1, numPatches);
+  for (unsigned patch = 0; patch < numPatches; ++patch){
+    double cosine = std::max(0.0, SkyVectors::patchDirection(patch).z());
+    open(0, patch) = cosine * SkyVectors::patchSolidAngle(patch);
+    shaded(0, patch) = 0.1 * open(0, patch);
+  }
+
+  // uniform sky of 10000 lux diffuse horizontal illuminance and a sky with no light
+  const double diffuseHorizontal = 10000.0;
+  std::vector<DateTime> dateTimes;
+  dateTimes.push_back(DateTime(Date(MonthOfYear::Jun, 21), Time(0, 12)));
+  dateTimes.push_back(DateTime(Date(MonthOfYear::Jun, 21), Time(0, 13)));
+  dateTimes.push_back(DateTime(Date(MonthOfYear::Jun, 21), Time(0, 14)));
+  Matrix sky(3, numPatches);
+  for (unsigned patch = 0; patch < numPatches; ++patch){
+    sky(0, patch) = (patch == 0 ? 0.0 : diffuseHorizontal / pi / 179.0);
+    sky(1, patch) = sky(0, patch);
+    sky(2, patch) = 0.0;
+  }
+  SkyVectors skyVectors(dateTimes, sky);
+
+  std::string hash;
+  {
+    DaylightCoefficients daylightCoefficients(radDir, cacheDir);
+    hash = daylightCoefficients.geometryHash();
+    EXPECT_FALSE(hash.empty());
+    std::vector<std::string> windowGroupNames = daylightCoefficients.windowGroupNames();
+    ASSERT_EQ(3u, windowGroupNames.size());
+    EXPECT_EQ("WG1", windowGroupNames[0]);
+    EXPECT_EQ("WG1_SHADE", windowGroupNames[1]);
+    EXPECT_EQ("WG2", windowGroupNames[2]);
+    EXPECT_FALSE(daylightCoefficients.loadCachedMatrix("WG1"));
+
+    // only exported window groups are accepted
+    EXPECT_FALSE(daylightCoefficients.addMatrix("WG3", DaylightCoefficientMatrix(open)));
+    EXPECT_FALSE(daylightCoefficients.addMatrix("WG2_SHADE", DaylightCoefficientMatrix(open)));
+    EXPECT_FALSE(daylightCoefficients.loadCachedMatrix("WG3"));
+
+    ASSERT_TRUE(daylightCoefficients.addMatrix("WG1", DaylightCoefficientMatrix(open)));
+    ASSERT_TRUE(daylightCoefficients.addMatrix("WG1_SHADE", DaylightCoefficientMatrix(shaded)));
+    EXPECT_FALSE(daylightCoefficients.addMatrix("WG2", DaylightCoefficientMatrix(Matrix(2, numPatches))));
+    EXPECT_TRUE(openstudio::filesystem::exists(daylightCoefficients.cachePath("WG1")));
+
+    Matrix illuminance = daylightCoefficients.illuminance(skyVectors);
+    ASSERT_EQ(1u, illuminance.size1());
+    ASSERT_EQ(3u, illuminance.size2());
+    // patches are sampled at their centers, so the sum is close to but not exactly the integral
+    EXPECT_NEAR(diffuseHorizontal, illuminance(0, 0), 0.02 * diffuseHorizontal);
+    EXPECT_NEAR(illuminance(0, 0), illuminance(0, 1), 1.0e-9);
+    EXPECT_EQ(0.0, illuminance(0, 2));
+
+    std::map<std::string, std::vector<bool> > shadeSchedules;
+    shadeSchedules["WG1"] = {false, true, true};
+    Matrix shadedIlluminance = daylightCoefficients.illuminance(skyVectors, shadeSchedules);
+    EXPECT_NEAR(illuminance(0, 0), shadedIlluminance(0, 0), 1.0e-9);
+    EXPECT_NEAR(0.1 * illuminance(0, 1), shadedIlluminance(0, 1), 1.0e-9);
+
+    shadeSchedules["WG1"] = {true};
+    EXPECT_THROW(daylightCoefficients.illuminance(skyVectors, shadeSchedules), std::exception);
+  }
+
+  // same geometry reuses the cached matrices
+  {
+    DaylightCoefficients daylightCoefficients(radDir, cacheDir);
+    EXPECT_EQ(hash, daylightCoefficients.geometryHash());
+    EXPECT_TRUE(daylightCoefficients.loadCachedMatrix("WG1"));
+    EXPECT_TRUE(daylightCoefficients.loadCachedMatrix("WG1_SHADE"));
+    ASSERT_EQ(2u, daylightCoefficients.names().size());
+  }
+
+  // changed geometry does not
+  {
+    std::ofstream file(toString(radDir / toPath("scene/model.rad")), std::ios_base::app);
+    file << "floor polygon f 0 0 12 0 0 0 1 0 0 1 1 0 0 1 0\n";
+  }
+  {
+    DaylightCoefficients daylightCoefficients(radDir, cacheDir);
+    EXPECT_NE(hash, daylightCoefficients.geometryHash());
+    EXPECT_FALSE(daylightCoefficients.loadCachedMatrix("WG1"));
+  }
+}
+
+TEST(Radiance, DaylightCoefficients_WindowGroupOutputs)
+{
+  openstudio::path dir = openstudio::tempDir() / toPath("DaylightCoefficients_WindowGroupOutputs");
+  openstudio::filesystem::remove_all(dir);
+  openstudio::path radDir = dir / toPath("model");
+  openstudio::path cacheDir = dir / toPath("cache");
+  openstudio::filesystem::create_directories(radDir / toPath("scene/glazing"));
+  openstudio::filesystem::create_directories(radDir / toPath("scene/shades"));
+  openstudio::filesystem::create_directories(radDir / toPath("output/dc"));
+  for (const std::string& name : {"glazing/WG1", "shades/WG1_SHADE"}){
+    std::ofstream file(toString(radDir / toPath("scene/" + name + ".rad")));
+    file << "# OpenStudio Window Group\n";
+  }
+
+  const unsigned numPatches = SkyVectors::numPatches();
+
+  // two sensors, two window patches
+  Matrix view(2, 2);
+  view(0, 0) = 1.0; view(0, 1) = 0.0;
+  view(1, 0) = 0.5; view(1, 1) = 0.5;
+  Matrix daylight(2, numPatches);
+  for (unsigned patch = 0; patch < numPatches; ++patch){
+    daylight(0, patch) = 0.01 * patch;
+    daylight(1, patch) = 0.02;
+  }
+  Matrix shadeTransmission(2, 2);
+  shadeTransmission(0, 0) = 0.1; shadeTransmission(0, 1) = 0.0;
+  shadeTransmission(1, 0) = 0.0; shadeTransmission(1, 1) = 0.1;
+
+  {
+    DaylightCoefficients daylightCoefficients(radDir, cacheDir);
+
+    // outputs have not been computed yet
+    EXPECT_FALSE(daylightCoefficients.loadWindowGroupMatrix("WG1"));
+    EXPECT_FALSE(daylightCoefficients.loadWindowGroupMatrices());
+
+    ASSERT_TRUE(DaylightCoefficientMatrix(view).save(radDir / toPath("output/dc/WG1.vmx")));
+    ASSERT_TRUE(DaylightCoefficientMatrix(daylight).save(radDir / toPath("output/dc/WG1.dmx")));
+    ASSERT_TRUE(DaylightCoefficientMatrix(shadeTransmission).save(radDir / toPath("output/dc/WG1_SHADE.tmx")));
+
+    EXPECT_FALSE(daylightCoefficients.loadWindowGroupMatrix("WG2"));
+    ASSERT_TRUE(daylightCoefficients.loadWindowGroupMatrices());
+    ASSERT_EQ(2u, daylightCoefficients.names().size());
+  }
+
+  // computed matrices were cached, they are reused without the outputs
+  openstudio::filesystem::remove_all(radDir / toPath("output"));
+  DaylightCoefficients daylightCoefficients(radDir, cacheDir);
+  ASSERT_TRUE(daylightCoefficients.loadWindowGroupMatrices());
+
+  boost::optional<DaylightCoefficientMatrix> open = DaylightCoefficientMatrix::load(daylightCoefficients.cachePath("WG1"));
+  boost::optional<DaylightCoefficientMatrix> shaded = DaylightCoefficientMatrix::load(daylightCoefficients.cachePath("WG1_SHADE"));
+  ASSERT_TRUE(open);
+  ASSERT_TRUE(shaded);
+  ASSERT_EQ(2u, open->numSensors());
+  ASSERT_EQ(numPatches, open->numPatches());
+  for (unsigned patch = 0; patch < numPatches; ++patch){
+    EXPECT_NEAR(0.01 * patch, open->coefficients()(0, patch), 1.0e-12);
+    EXPECT_NEAR(0.5 * 0.01 * patch + 0.5 * 0.02, open->coefficients()(1, patch), 1.0e-12);
+    EXPECT_NEAR(0.1 * open->coefficients()(0, patch), shaded->coefficients()(0, patch), 1.0e-12);
+    EXPECT_NEAR(0.1 * open->coefficients()(1, patch), shaded->coefficients()(1, patch), 1.0e-12);
+  }
+}
+
+TEST(Radiance, DaylightCoefficients_ForwardTranslator)
+{
+  Model model = exampleModel();
+  Shade shade(model);
+  ShadingControl shadingControl(shade);
+  for (auto& subSurface : model.getConcreteModelObjects<model::SubSurface>()){
+    if (istringEqual(subSurface.subSurfaceType(), "FixedWindow") ||
+        istringEqual(subSurface.subSurfaceType(), "OperableWindow")){
+      subSurface.setShadingControl(shadingControl);
+    }
+  }
+
+  openstudio::path dir = openstudio::tempDir() / toPath("DaylightCoefficients_ForwardTranslator");
+  openstudio::filesystem::remove_all(dir);
+  openstudio::path radDir = dir / toPath("model");
+
+  ForwardTranslator ft;
+  std::vector<openstudio::path> outpaths = ft.translateModel(radDir, model);
+  ASSERT_FALSE(outpaths.empty());
+
+  // every exported glazing and shade file is a window group
+  DaylightCoefficients daylightCoefficients(radDir, dir / toPath("cache"));
+  std::vector<std::string> windowGroupNames = daylightCoefficients.windowGroupNames();
+  ASSERT_FALSE(windowGroupNames.empty());
+  for (const std::string& name : windowGroupNames){
+    EXPECT_TRUE(openstudio::filesystem::exists(radDir / toPath("scene/glazing/" + name + ".rad")) ||
+                openstudio::filesystem::exists(radDir / toPath("scene/shades/" + name + ".rad"))) << name;
+  }
+
+  // shaded windows are exported as a window group with a shade
+  auto shadeName = std::find_if(windowGroupNames.begin(), windowGroupNames.end(), [](const std::string& name) {
+    return name.size() > 6 && name.compare(name.size() - 6, 6, "_SHADE") == 0;
+  });
+  ASSERT_TRUE(shadeName != windowGroupNames.end());
+  std::string windowGroupName = shadeName->substr(0, shadeName->size() - 6);
+  EXPECT_TRUE(std::find(windowGroupNames.begin(), windowGroupNames.end(), windowGroupName) != windowGroupNames.end());
+
+  // outputs of rfluxmtx have not been computed
+  EXPECT_FALSE(daylightCoefficients.loadWindowGroupMatrix(windowGroupName));
+
+  EXPECT_FALSE(daylightCoefficients.addMatrix("NOT_A_WINDOW_GROUP", DaylightCoefficientMatrix(Matrix(1, SkyVectors::numPatches()))));
+}
@@ -52,9 +52,13 @@
 
 #include "../../utilities/geometry/Point3d.hpp"
 #include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/PathHelpers.hpp"
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/FenestrationSurface_Detailed_FieldEnums.hxx>
 
+#include <fstream>
+#include <set>
+
 using namespace openstudio;
 using namespace openstudio::model;
 using namespace openstudio::radiance;
@@ -325,3 +329,39 @@ TEST(Radiance, ForwardTranslator_formatString)
   EXPECT_EQ("0.4", formatString(0.4412345, 1));
   EXPECT_EQ("0.44", formatString(0.4412345, 2));
 }
+
+TEST(Radiance, ForwardTranslator_ParallelExport)
+{
+  Model model = exampleModel();
+
+  openstudio::path serialPath = toPath("./ForwardTranslator_SerialExport");
+  openstudio::path parallelPath = toPath("./ForwardTranslator_ParallelExport");
+  openstudio::filesystem::remove_all(serialPath);
+  openstudio::filesystem::remove_all(parallelPath);
+
+  ForwardTranslator serialFt;
+  std::vector<path> serialPaths = serialFt.translateModel(serialPath, model);
+  ASSERT_FALSE(serialPaths.empty());
+
+  ForwardTranslator parallelFt;
+  parallelFt.setParallelExport(true);
+  std::vector<path> parallelPaths = parallelFt.translateModel(parallelPath, model);
+  ASSERT_EQ(serialPaths.size(), parallelPaths.size()) << printPaths(parallelPaths);
+  EXPECT_TRUE(parallelFt.errors().empty()) << printLogMessages(parallelFt.errors());
+  EXPECT_EQ(serialFt.warnings().size(), parallelFt.warnings().size());
+
+  // every file is written once
+  std::set<path> uniquePaths(serialPaths.begin(), serialPaths.end());
+  EXPECT_EQ(serialPaths.size(), uniquePaths.size());
+
+  for (size_t i = 0; i < serialPaths.size(); ++i){
+    path relative = relativePath(serialPaths[i], serialPath);
+    EXPECT_EQ(toString(relative), toString(relativePath(parallelPaths[i], parallelPath)));
+
+    std::ifstream serialFile(toString(serialPaths[i]));
+    std::ifstream parallelFile(toString(parallelPaths[i]));
+    std::string serialContents((std::istreambuf_iterator<char>(serialFile)), std::istreambuf_iterator<char>());
+    std::string parallelContents((std::istreambuf_iterator<char>(parallelFile)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(serialContents, parallelContents) << toString(relative);
+  }
+}
@@ -5176,28 +5176,22 @@ boost::optional<model::ModelObject> ReverseTranslator::translateTrmlUnit(const Q
 
       QDomElement zoneServedElement = trmlUnitElement.firstChildElement("ZnServedRef");
 
-      QDomNodeList thrmlZnElements = trmlUnitElement.parentNode().parentNode().parentNode().toElement().elementsByTagName("ThrmlZn");
+      // only zones in the building the terminal's air system belongs to
+      QDomElement bldgElement = findAncestorElement(trmlUnitElement, "Bldg");
 
-      for( int j = 0; j < thrmlZnElements.count(); j++ )
+      QDomElement thrmlZnElement = findThrmlZnElement(zoneServedElement.text(), bldgElement);
+
+      if( ! thrmlZnElement.isNull() )
       {
-        QDomElement thrmlZnElement = thrmlZnElements.at(j).toElement();
+        QDomElement htgDsgnMaxFlowFracElement = thrmlZnElement.firstChildElement("HtgDsgnMaxFlowFrac");
 
-        QDomElement thrmlZnNameElement = thrmlZnElement.firstChildElement("Name");
+        value = htgDsgnMaxFlowFracElement.text().toDouble(&ok);
 
-        if(istringEqual(thrmlZnNameElement.text().toStdString(),zoneServedElement.text().toStdString()))
+        if( ok )
         {
-          QDomElement htgDsgnMaxFlowFracElement = thrmlZnElement.firstChildElement("HtgDsgnMaxFlowFrac");
-
-          value = htgDsgnMaxFlowFracElement.text().toDouble(&ok);
-
-          if( ok )
-          {
-            terminal.setMaximumFlowFractionDuringReheat(value);
-
-            found = true;
-          }
+          terminal.setMaximumFlowFractionDuringReheat(value);
 
-          break;
+          found = true;
         }
       }
 
@@ -9293,18 +9287,13 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCrvM
 
 QDomElement ReverseTranslator::findZnSysElement(const QString & znSysName,const QDomDocument & doc)
 {
-  QDomNodeList znSysElements = doc.documentElement().firstChildElement("Proj").elementsByTagName("ZnSys");
-
-  for (int i = 0; i < znSysElements.count(); i++)
-  {
-    QDomElement znSysElement = znSysElements.at(i).toElement();
+  QDomElement projElement = doc.documentElement().firstChildElement("Proj");
 
-    QDomElement znSysNameElement = znSysElement.firstChildElement("Name");
+  QVector<QDomElement> znSysElements = findElements("ZnSys",znSysName,Qt::CaseSensitive,projElement);
 
-    if( znSysNameElement.text() == znSysName )
-    {
-      return znSysElement;
-    }
+  if( ! znSysElements.isEmpty() )
+  {
+    return znSysElements.front();
   }
 
   return QDomElement();
@@ -9312,22 +9301,11 @@ QDomElement ReverseTranslator::findZnSysElement(const QString & znSysName,const
 
 QDomElement ReverseTranslator::findTrmlUnitElementForZone(const QString & zoneName,const QDomDocument & doc)
 {
-  QDomNodeList airSystemElements = doc.documentElement().elementsByTagName("AirSys");
+  auto it = m_trmlUnitsByZone.find(zoneName.toLower());
 
-  for( int i = 0; i < airSystemElements.count(); i++ )
+  if( it != m_trmlUnitsByZone.end() && ! it->isEmpty() )
   {
-    QDomElement airSystemElement = airSystemElements.at(i).toElement();
-    QDomNodeList terminalElements = airSystemElement.elementsByTagName("TrmlUnit");
-    for( int j = 0; j < terminalElements.count(); j++ )
-    {
-      QDomElement terminalElement = terminalElements.at(j).toElement();
-      QDomElement zoneServedElement = terminalElement.firstChildElement("ZnServedRef");
-
-      if(zoneName.compare(zoneServedElement.text(),Qt::CaseInsensitive) == 0)
-      {
-        return terminalElement;
-      }
-    }
+    return it->front();
   }
 
   return QDomElement();
@@ -9335,17 +9313,28 @@ QDomElement ReverseTranslator::findTrmlUnitElementForZone(const QString & zoneNa
 
 QDomElement ReverseTranslator::findAirSysElement(const QString & airSysName,const QDomDocument & doc)
 {
-  QDomNodeList airSystemElements = doc.documentElement().elementsByTagName("AirSys");
+  QVector<QDomElement> airSystemElements = findElements("AirSys",airSysName);
 
-  for( int i = 0; i < airSystemElements.count(); i++ )
+  if( ! airSystemElements.isEmpty() )
   {
-    QDomElement airSystemElement = airSystemElements.at(i).toElement();
-    QDomElement airSystemNameElement = airSystemElement.firstChildElement("Name");
+    return airSystemElements.front();
+  }
 
-    if(airSysName.compare(airSystemNameElement.text(),Qt::CaseInsensitive) == 0)
-    {
-      return airSystemElement;
-    }
+  return QDomElement();
+}
+
+QDomElement ReverseTranslator::findThrmlZnElement(const QString & thrmlZnName, const QDomElement & scope)
+{
+  if( scope.isNull() )
+  {
+    return QDomElement();
+  }
+
+  QVector<QDomElement> thrmlZnElements = findElements("ThrmlZn",thrmlZnName,Qt::CaseInsensitive,scope);
+
+  if( ! thrmlZnElements.isEmpty() )
+  {
+    return thrmlZnElements.front();
   }
 
   return QDomElement();
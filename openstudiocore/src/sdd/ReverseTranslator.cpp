@@ -149,6 +149,17 @@ namespace sdd {
     return os;
   }
 
+  // True if element is nested anywhere within ancestor
+  static bool isDescendant(const QDomElement& element, const QDomElement& ancestor)
+  {
+    for (QDomNode node = element.parentNode(); !node.isNull(); node = node.parentNode()){
+      if (node == ancestor){
+        return true;
+      }
+    }
+    return false;
+  }
+
   ReverseTranslator::ReverseTranslator( bool masterAutosize )
     : m_isInputXML(false), m_autosize(true),
       m_masterAutosize(masterAutosize)
@@ -229,7 +240,76 @@ namespace sdd {
 
   boost::optional<model::Model> ReverseTranslator::convert(const QDomDocument& doc)
   {
-    return translateSDD(doc.documentElement(), doc);
+    m_elementsByTypeAndName.clear();
+    m_trmlUnitsByZone.clear();
+    indexElements(doc.documentElement(), QDomElement());
+
+    boost::optional<model::Model> result = translateSDD(doc.documentElement(), doc);
+
+    // do not hold on to the document after translation
+    m_elementsByTypeAndName.clear();
+    m_trmlUnitsByZone.clear();
+
+    return result;
+  }
+
+  void ReverseTranslator::indexElements(const QDomElement& element, const QDomElement& airSysElement)
+  {
+    QDomElement parentAirSysElement = airSysElement;
+
+    QString tagName = element.tagName();
+    QDomElement nameElement = element.firstChildElement("Name");
+    if (!nameElement.isNull()){
+      m_elementsByTypeAndName[tagName][nameElement.text().toLower()].append(element);
+    }
+
+    if (tagName == "AirSys"){
+      parentAirSysElement = element;
+    } else if ((tagName == "TrmlUnit") && !airSysElement.isNull()){
+      m_trmlUnitsByZone[element.firstChildElement("ZnServedRef").text().toLower()].append(element);
+    }
+
+    for (QDomElement child = element.firstChildElement(); !child.isNull(); child = child.nextSiblingElement()){
+      indexElements(child, parentAirSysElement);
+    }
+  }
+
+  QDomElement ReverseTranslator::findAncestorElement(const QDomElement& element, const QString & tagName) const
+  {
+    for (QDomNode node = element.parentNode(); !node.isNull(); node = node.parentNode()){
+      QDomElement ancestor = node.toElement();
+      if (!ancestor.isNull() && (ancestor.tagName() == tagName)){
+        return ancestor;
+      }
+    }
+    return QDomElement();
+  }
+
+  QVector<QDomElement> ReverseTranslator::findElements(const QString & tagName, const QString & name, Qt::CaseSensitivity cs, const QDomElement & scope) const
+  {
+    QVector<QDomElement> result;
+
+    auto typeIt = m_elementsByTypeAndName.find(tagName);
+    if (typeIt == m_elementsByTypeAndName.end()){
+      return result;
+    }
+
+    auto nameIt = typeIt->find(name.toLower());
+    if (nameIt == typeIt->end()){
+      return result;
+    }
+
+    for (const QDomElement& element : *nameIt){
+      if ((cs == Qt::CaseSensitive) && (element.firstChildElement("Name").text() != name)){
+        continue;
+      }
+      if (!scope.isNull() && !isDescendant(element, scope)){
+        continue;
+      }
+      result.append(element);
+    }
+
+    return result;
   }
 
   boost::optional<model::Model> ReverseTranslator::translateSDD(const QDomElement& element, const QDomDocument& doc)
@@ -2057,23 +2137,18 @@ namespace sdd {
 
 QDomElement ReverseTranslator::supplySegment(const QString & fluidSegmentName, const QDomDocument& doc)
 {
-  QDomNodeList fluidSysElements = doc.documentElement().firstChildElement("Proj").elementsByTagName("FluidSys");
+  QDomElement projElement = doc.documentElement().firstChildElement("Proj");
 
-  for (int i = 0; i < fluidSysElements.count(); i++) {
-    QDomElement fluidSysElement = fluidSysElements.at(i).toElement();
-    QDomNodeList fluidSegmentElements = fluidSysElement.elementsByTagName("FluidSeg");
-
-    for (int i = 0; i < fluidSegmentElements.count(); i++) {
-      QDomElement fluidSegmentElement = fluidSegmentElements.at(i).toElement();
+  for (const QDomElement& fluidSegmentElement : findElements("FluidSeg", fluidSegmentName, Qt::CaseInsensitive, projElement)) {
+    if (findAncestorElement(fluidSegmentElement, "FluidSys").isNull()) {
+      continue;
+    }
 
-      QDomElement nameElement = fluidSegmentElement.firstChildElement("Name");
-      QDomElement typeElement = fluidSegmentElement.firstChildElement("Type");
+    QDomElement typeElement = fluidSegmentElement.firstChildElement("Type");
 
-      if( (typeElement.text().toLower() == "secondarysupply" ||
-           typeElement.text().toLower() == "primarysupply" ) &&
-           nameElement.text().toLower() == fluidSegmentName.toLower() ) {
-        return fluidSegmentElement;
-      }
+    if( typeElement.text().toLower() == "secondarysupply" ||
+        typeElement.text().toLower() == "primarysupply" ) {
+      return fluidSegmentElement;
     }
   }
 
@@ -2093,43 +2168,36 @@ boost::optional<model::PlantLoop> ReverseTranslator::serviceHotWaterLoopForSuppl
 {
   boost::optional<model::PlantLoop> result;
 
-  QDomNodeList fluidSysElements = doc.documentElement().firstChildElement("Proj").elementsByTagName("FluidSys");
+  QDomElement projElement = doc.documentElement().firstChildElement("Proj");
 
-  for (int i = 0; i < fluidSysElements.count(); i++)
+  for (const QDomElement& fluidSegmentElement : findElements("FluidSeg", fluidSegmentName, Qt::CaseInsensitive, projElement))
   {
-    QDomElement fluidSysElement = fluidSysElements.at(i).toElement();
+    QDomElement fluidSysElement = findAncestorElement(fluidSegmentElement, "FluidSys");
+
+    if( fluidSysElement.isNull() )
+    {
+      continue;
+    }
 
     QDomElement fluidSysNameElement = fluidSysElement.firstChildElement("Name");
 
     QDomElement fluidSysTypeElement = fluidSysElement.firstChildElement("Type");
 
-    if( fluidSysTypeElement.text().toLower() == "servicehotwater" )
-    {
-      QDomNodeList fluidSegmentElements = fluidSysElement.elementsByTagName("FluidSeg");
+    QDomElement typeElement = fluidSegmentElement.firstChildElement("Type");
 
-      for (int i = 0; i < fluidSegmentElements.count(); i++)
+    if( fluidSysTypeElement.text().toLower() == "servicehotwater" &&
+        (typeElement.text().toLower() == "secondarysupply" ||
+         typeElement.text().toLower() == "primarysupply") )
+    {
+      if( boost::optional<model::PlantLoop> loop = model.getModelObjectByName<model::PlantLoop>(fluidSysNameElement.text().toStdString()) )
       {
-        QDomElement fluidSegmentElement = fluidSegmentElements.at(i).toElement();
-
-        QDomElement nameElement = fluidSegmentElement.firstChildElement("Name");
-        QDomElement typeElement = fluidSegmentElement.firstChildElement("Type");
-
-        if( (typeElement.text().toLower() == "secondarysupply" ||
-             typeElement.text().toLower() == "primarysupply" ) &&
-            nameElement.text().toLower() == fluidSegmentName.toLower()
-          )
+        return loop;
+      }
+      else
+      {
+        if( boost::optional<model::ModelObject> mo = translateFluidSys(fluidSysElement,doc,model) )
         {
-          if( boost::optional<model::PlantLoop> loop = model.getModelObjectByName<model::PlantLoop>(fluidSysNameElement.text().toStdString()) )
-          {
-            return loop;
-          }
-          else
-          {
-            if( boost::optional<model::ModelObject> mo = translateFluidSys(fluidSysElement,doc,model) )
-            {
-              return mo->optionalCast<model::PlantLoop>();
-            }
-          }
+          return mo->optionalCast<model::PlantLoop>();
         }
       }
     }
@@ -43,8 +43,12 @@
 #include "../model/ConstructionBase.hpp"
 #include "../model/AirConditionerVariableRefrigerantFlow.hpp"
 
+#include <QDomElement>
+#include <QHash>
+#include <QString>
+#include <QVector>
+
 class QDomDocument;
-class QDomElement;
 class QDomNodeList;
 
 namespace openstudio {
@@ -159,6 +163,26 @@ namespace sdd {
     // Return the "TrmlUnit" element serving zoneName
     QDomElement findTrmlUnitElementForZone(const QString & zoneName,const QDomDocument & doc);
 
+    // Return the "ThrmlZn" element within scope with the name thrmlZnName, case insensitive.
+    QDomElement findThrmlZnElement(const QString & thrmlZnName, const QDomElement & scope);
+
+    // Index every element with a "Name" child by tag and name, and every "TrmlUnit" by the zone it serves,
+    // so the find methods above do not rescan the document. Built once per translation before any mapping.
+    void indexElements(const QDomElement& element, const QDomElement& airSysElement);
+
+    // Return the elements of type tagName with name, in document order.
+    // If scope is not null only elements nested within scope are returned.
+    QVector<QDomElement> findElements(const QString & tagName, const QString & name, Qt::CaseSensitivity cs = Qt::CaseInsensitive,
+                                      const QDomElement & scope = QDomElement()) const;
+
+    // Return the closest ancestor of element of type tagName, FluidSeg and TrmlUnit elements may be nested below their systems
+    QDomElement findAncestorElement(const QDomElement& element, const QString & tagName) const;
+
+    // keyed by lower case name
+    typedef QHash<QString, QVector<QDomElement> > ElementsByName;
+    QHash<QString, ElementsByName> m_elementsByTypeAndName;
+    ElementsByName m_trmlUnitsByZone;
+
     model::Schedule alwaysOnSchedule(openstudio::model::Model& model);
     boost::optional<model::Schedule> m_alwaysOnSchedule;
 
@@ -54,6 +54,10 @@
 #include "../../model/YearDescription_Impl.hpp"
 #include "../../model/RunPeriodControlSpecialDays.hpp"
 #include "../../model/RunPeriodControlSpecialDays_Impl.hpp"
+#include "../../model/PlantLoop.hpp"
+#include "../../model/PlantLoop_Impl.hpp"
+#include "../../model/ZoneHVACBaseboardConvectiveWater.hpp"
+#include "../../model/ZoneHVACBaseboardConvectiveWater_Impl.hpp"
 
 
 #include "../../utilities/idf/Workspace.hpp"
@@ -62,8 +66,89 @@
 #include <resources.hxx>
 
 #include <sstream>
+#include <fstream>
 
 using namespace openstudio::model;
 using namespace openstudio;
 
+TEST_F(SDDFixture, ReverseTranslator_ZonesAndFluidSegments)
+{
+  // a simulation SDD with a zone served by a hot water baseboard, the coil references a supply segment of the hot water loop
+  path p = resourcesPath() / openstudio::toPath("sdd/ReverseTranslator_ZonesAndFluidSegments.xml");
+  {
+    std::ofstream file(toString(p));
+    ASSERT_TRUE(file.is_open());
+    file << "<SDDXML>\n"
+            "  <Proj>\n"
+            "    <Name>Test Project</Name>\n"
+            "    <SimFlag>1</SimFlag>\n"
+            "    <Bldg>\n"
+            "      <Name>Test Building</Name>\n"
+            "      <ThrmlZn>\n"
+            "        <Name>Zone 1</Name>\n"
+            "        <Type>Conditioned</Type>\n"
+            "        <PriAirCondgSysRef index=\"0\">Zone 1 Baseboard</PriAirCondgSysRef>\n"
+            "      </ThrmlZn>\n"
+            "      <ThrmlZn>\n"
+            "        <Name>Zone 2</Name>\n"
+            "        <Type>Unconditioned</Type>\n"
+            "      </ThrmlZn>\n"
+            "    </Bldg>\n"
+            "    <ZnSys>\n"
+            "      <Name>Zone 1 Baseboard</Name>\n"
+            "      <TypeSim>Baseboard</TypeSim>\n"
+            "      <CoilHtg>\n"
+            "        <Name>Zone 1 Baseboard Coil</Name>\n"
+            "        <Type>HotWater</Type>\n"
+            "        <FluidSegInRef>hw supply</FluidSegInRef>\n"
+            "      </CoilHtg>\n"
+            "    </ZnSys>\n"
+            "    <FluidSys>\n"
+            "      <Name>CHW Loop</Name>\n"
+            "      <Type>ChilledWater</Type>\n"
+            "      <FluidSeg>\n"
+            "        <Name>HW Supply</Name>\n"
+            "        <Type>PrimaryReturn</Type>\n"
+            "      </FluidSeg>\n"
+            "    </FluidSys>\n"
+            "    <FluidSys>\n"
+            "      <Name>HW Loop</Name>\n"
+            "      <Type>HotWater</Type>\n"
+            "      <FluidSeg>\n"
+            "        <Name>HW Supply</Name>\n"
+            "        <Type>PrimarySupply</Type>\n"
+            "      </FluidSeg>\n"
+            "      <FluidSeg>\n"
+            "        <Name>HW Return</Name>\n"
+            "        <Type>PrimaryReturn</Type>\n"
+            "      </FluidSeg>\n"
+            "    </FluidSys>\n"
+            "  </Proj>\n"
+            "</SDDXML>\n";
+  }
 
+  ReverseTranslator reverseTranslator;
+  boost::optional<Model> model = reverseTranslator.loadModel(p);
+  ASSERT_TRUE(model);
+
+  boost::optional<ThermalZone> zone1 = model->getModelObjectByName<ThermalZone>("Zone 1");
+  ASSERT_TRUE(zone1);
+  boost::optional<ThermalZone> zone2 = model->getModelObjectByName<ThermalZone>("Zone 2");
+  ASSERT_TRUE(zone2);
+  EXPECT_TRUE(zone1->thermostatSetpointDualSetpoint());
+  EXPECT_FALSE(zone2->thermostatSetpointDualSetpoint());
+  EXPECT_TRUE(zone2->equipment().empty());
+
+  boost::optional<PlantLoop> hwLoop = model->getModelObjectByName<PlantLoop>("HW Loop");
+  ASSERT_TRUE(hwLoop);
+  ASSERT_TRUE(model->getModelObjectByName<PlantLoop>("CHW Loop"));
+
+  // the zone system is found by name and the coil is connected to the loop with the supply segment, not the return segment of the same name
+  std::vector<ZoneHVACBaseboardConvectiveWater> baseboards = model->getConcreteModelObjects<ZoneHVACBaseboardConvectiveWater>();
+  ASSERT_EQ(1u, baseboards.size());
+  ASSERT_TRUE(baseboards[0].thermalZone());
+  EXPECT_EQ(zone1->handle(), baseboards[0].thermalZone()->handle());
+  boost::optional<PlantLoop> coilLoop = baseboards[0].heatingCoil().plantLoop();
+  ASSERT_TRUE(coilLoop);
+  EXPECT_EQ(hwLoop->handle(), coilLoop->handle());
+}
@@ -160,7 +160,13 @@ namespace openstudio {
     while (itr != m_widgetMap.end())
     {
       if (itr->second->widget == t_obj) {
+        boost::optional<model::ModelObject> obj = itr->first;
         itr = m_widgetMap.erase(itr);
+
+        // objects only stay selectable while they have widgets, rows of a virtualized grid are built and deleted as needed
+        if (obj && m_widgetMap.count(obj) == 0) {
+          m_selectorObjects.erase(*obj);
+        }
       }
       else {
         ++itr;
@@ -237,6 +243,9 @@ namespace openstudio {
 
   void ObjectSelector::selectAll()
   {
+    // make sure every row has registered its selectable objects
+    m_grid->gridView()->ensureRowsBuilt(m_grid->rowCount());
+
     m_selectedObjects.clear();
 
     for (auto obj : m_selectorObjects) {
@@ -1894,10 +1903,24 @@ namespace openstudio {
     //if (m_iddObjectType == iddObjectType) { TODO uncomment, currently used to update views with extensible dropzones, which need to issue their own signal to refresh
     // Update model list
     // m_modelObjects.push_back(object.cast<model::ModelObject>());
+    std::vector<model::ModelObject> oldModelObjects = m_modelObjects;
     refreshModelObjects();
 
-    // Update row
-    gridView()->requestAddRow(rowCount() - 1);
+    // If the new object is a row and the rows before it did not change, only the rows from it on need to be rebuilt
+    boost::optional<model::ModelObject> modelObject = object.optionalCast<model::ModelObject>();
+    if (modelObject && m_modelObjects.size() == oldModelObjects.size() + 1) {
+      auto it = std::find(m_modelObjects.begin(), m_modelObjects.end(), *modelObject);
+      if (it != m_modelObjects.end() && std::equal(m_modelObjects.begin(), it, oldModelObjects.begin())) {
+        int index = std::distance(m_modelObjects.begin(), it);
+
+        // Update row
+        gridView()->requestAddRow(rowIndexFromModelIndex(index));
+        return;
+      }
+    }
+
+    // Otherwise the object may be shown in an extensible drop zone, refresh the whole grid
+    requestRefreshGrid();
     //}
   }
 
@@ -52,6 +52,7 @@
 #include <QLabel>
 #include <QPushButton>
 #include <QScrollArea>
+#include <QScrollBar>
 #include <QShowEvent>
 #include <QStackedWidget>
 
@@ -200,7 +201,7 @@ void OSGridView::requestAddRow(int row)
 
   m_timer.start();
 
-  m_rowToAdd = row;
+  m_firstChangedRow = (m_firstChangedRow < 0) ? row : std::min(m_firstChangedRow, row);
 
   m_queueRequests.emplace_back(AddRow);
 }
@@ -212,11 +213,36 @@ void OSGridView::requestRemoveRow(int row)
 
   m_timer.start();
 
-  m_rowToRemove = row;
+  m_firstChangedRow = (m_firstChangedRow < 0) ? row : std::min(m_firstChangedRow, row);
 
   m_queueRequests.emplace_back(RemoveRow);
 }
 
+void OSGridView::setVirtualized(bool virtualized)
+{
+  m_virtualized = virtualized;
+
+  if (!m_virtualized && m_gridController) {
+    ensureRowsBuilt(m_gridController->rowCount());
+  }
+}
+
+bool OSGridView::virtualized() const
+{
+  return m_virtualized;
+}
+
+void OSGridView::ensureRowsBuilt(int rowCount)
+{
+  OS_ASSERT(m_gridController);
+
+  int lastRow = std::min(rowCount, m_gridController->rowCount());
+  if (m_builtRowCount < lastRow) {
+    buildRows(m_builtRowCount, lastRow);
+    m_gridController->getObjectSelector()->updateWidgets();
+  }
+}
+
 //void OSGridView::refreshRow(int row)
 //{
 //  for( int j = 0; j < m_gridController->columnCount(); j++ )
@@ -227,10 +253,15 @@ void OSGridView::requestRemoveRow(int row)
 
 QLayoutItem * OSGridView::itemAtPosition(int row, int column)
 {
-  auto layoutnum = row / ROWS_PER_LAYOUT;
+  unsigned layoutnum = row / ROWS_PER_LAYOUT;
   auto relativerow = row % ROWS_PER_LAYOUT;
 
-  return m_gridLayouts.at(layoutnum)->itemAtPosition(relativerow, column);
+  // rows of a virtualized grid that have not been scrolled into view yet
+  if (layoutnum >= m_gridLayouts.size()) {
+    return nullptr;
+  }
+
+  return m_gridLayouts[layoutnum]->itemAtPosition(relativerow, column);
 }
 
 //void OSGridView::removeWidget(int row, int column)
@@ -291,6 +322,38 @@ void OSGridView::deleteAll()
       delete child;
     }
   }
+
+  m_builtRowCount = 0;
+}
+
+void OSGridView::deleteRows(int firstRow)
+{
+  for (unsigned layoutIndex = firstRow / ROWS_PER_LAYOUT; layoutIndex < m_gridLayouts.size(); ++layoutIndex)
+  {
+    QGridLayout * layout = m_gridLayouts[layoutIndex];
+
+    // take items from the back so that the indexes of the remaining items do not change
+    for (int index = layout->count() - 1; index >= 0; --index)
+    {
+      int row, column, rowSpan, columnSpan;
+      layout->getItemPosition(index, &row, &column, &rowSpan, &columnSpan);
+
+      if (static_cast<int>(layoutIndex) * ROWS_PER_LAYOUT + row >= firstRow)
+      {
+        QLayoutItem * child = layout->takeAt(index);
+
+        QWidget * widget = child->widget();
+
+        OS_ASSERT(widget);
+
+        delete widget;
+
+        delete child;
+      }
+    }
+  }
+
+  m_builtRowCount = std::min(m_builtRowCount, firstRow);
 }
 
 //void OSGridView::refreshGrid()
@@ -348,60 +411,84 @@ void OSGridView::doRefresh()
     return;
   }
 
-  bool has_add_row = false;
-  bool has_remove_row = false;
   bool has_refresh_grid = false;
   bool has_refresh_all = false;
 
   for (const auto &r : m_queueRequests)
   {
-    if (r == AddRow) has_add_row = true;
-    if (r == RemoveRow) has_remove_row = true;
     if (r == RefreshGrid) has_refresh_grid = true;
     if (r == RefreshAll) has_refresh_all = true;
   }
 
   m_queueRequests.clear();
 
-  //if (has_refresh_all) {
-  //  refreshAll();
-  //}
-  //else if (has_refresh_grid) {
-  //  refreshGrid(); // This now causes a crash
-  //}
-  //else if (has_add_row) {
-  //  addRow(m_rowToAdd);
-  //}
-  //else if (has_remove_row) {
-  //  removeRow(m_rowToRemove);
-  //}
-  //else {
-  //  // Should never get here
-  //  OS_ASSERT(false);
-  //}
-
-  refreshAll(); // TODO remove this and uncomment the block above for finer granularity refreshes
+  if (has_refresh_all || has_refresh_grid || m_firstChangedRow < 0) {
+    refreshAll();
+  }
+  else {
+    // only rows were added or removed
+    refreshChangedRows();
+  }
+
   setEnabled(true);
 }
 
+void OSGridView::refreshChangedRows()
+{
+  int firstRow = m_firstChangedRow;
+  m_firstChangedRow = -1;
+
+  if (!m_gridController) return;
+
+  // take the net change from the controller rather than counting requests, requests do not map one to one onto rows
+  int rowCount = m_gridController->rowCount();
+  int rowCountChange = rowCount - m_lastRowCount;
+  m_lastRowCount = rowCount;
+  firstRow = std::min(firstRow, rowCount);
+  bool allRowsBuilt = (m_builtRowCount >= rowCount - rowCountChange);
+
+  // rows that have not been scrolled into view are built from the current model objects when they are
+  if (!allRowsBuilt && firstRow >= m_builtRowCount) return;
+
+  int lastRow = rowCount;
+  if (!allRowsBuilt) {
+    lastRow = std::min(rowCount, std::max(firstRow, m_builtRowCount + rowCountChange));
+  }
+
+  // rows before the first change keep their widgets, the rest shift by the added or removed rows
+  deleteRows(firstRow);
+  buildRows(firstRow, lastRow);
+
+  m_gridController->getObjectSelector()->updateWidgets();
+}
+
 void OSGridView::refreshAll()
 {
   // std::cout << " REFRESHALL CALLED " << std::endl;
   m_queueRequests.clear();
+  m_firstChangedRow = -1;
+
+  // keep as many rows as were scrolled into view so the scroll position is preserved
+  int previousBuiltRowCount = m_builtRowCount;
   deleteAll();
 
   if (m_gridController)
   {
     m_gridController->refreshModelObjects();
 
-    for (int i = 0; i < m_gridController->rowCount(); i++)
-    {
-      for (int j = 0; j < m_gridController->columnCount(); j++)
-      {
-        addWidget(i, j);
+    int rowCount = m_gridController->rowCount();
+    m_lastRowCount = rowCount;
+    if (m_virtualized) {
+      connectToScrollArea();
+      // start with one layout worth of rows, more are built by onScrollChanged,
+      // without a scroll area to page through everything is built once we are shown
+      if (m_scrollArea || !isVisible()) {
+        rowCount = std::min(rowCount, std::max(previousBuiltRowCount, static_cast<int>(ROWS_PER_LAYOUT)));
       }
     }
 
+    buildRows(0, rowCount);
+
     this->m_gridController->getObjectSelector()->updateWidgets();
 
     QTimer::singleShot(0, this, SLOT(selectRowDeterminedByModelSubTabView()));
@@ -431,10 +518,61 @@ void OSGridView::doRowSelect()
 {
   // If the index is valid, do some work
   if (m_gridController->m_oldIndex > -1){
+    ensureRowsBuilt(m_gridController->m_oldIndex + 1);
     m_gridController->selectRow(m_gridController->m_oldIndex, true);
   }
 }
 
+void OSGridView::buildRows(int firstRow, int lastRow)
+{
+  OS_ASSERT(m_gridController);
+  OS_ASSERT(firstRow <= m_builtRowCount);
+
+  for (int i = firstRow; i < lastRow; i++)
+  {
+    for (int j = 0; j < m_gridController->columnCount(); j++)
+    {
+      addWidget(i, j);
+    }
+  }
+
+  m_builtRowCount = std::max(firstRow, lastRow);
+}
+
+void OSGridView::connectToScrollArea()
+{
+  if (m_scrollArea) return;
+
+  for (QWidget * parent = parentWidget(); parent; parent = parent->parentWidget())
+  {
+    auto scrollArea = qobject_cast<QScrollArea *>(parent);
+    if (scrollArea)
+    {
+      m_scrollArea = scrollArea;
+      connect(scrollArea->verticalScrollBar(), &QScrollBar::valueChanged, this, &OSGridView::onScrollChanged);
+      connect(scrollArea->verticalScrollBar(), &QScrollBar::rangeChanged, this, &OSGridView::onScrollChanged);
+      break;
+    }
+  }
+}
+
+void OSGridView::onScrollChanged()
+{
+  if (!m_virtualized || !m_scrollArea || !m_gridController) return;
+
+  // wait for pending refreshes, the model objects may not match the rows built so far
+  if (!m_queueRequests.empty()) return;
+
+  if (m_builtRowCount >= m_gridController->rowCount()) return;
+
+  // build another layout worth of rows once we are within a page of the bottom,
+  // this repeats through rangeChanged until the visible area is filled
+  QScrollBar * scrollBar = m_scrollArea->verticalScrollBar();
+  if (scrollBar->value() + scrollBar->pageStep() < scrollBar->maximum()) return;
+
+  ensureRowsBuilt(m_builtRowCount + ROWS_PER_LAYOUT);
+}
+
 void OSGridView::addWidget(int row, int column)
 {
   OS_ASSERT(m_gridController);
@@ -30,6 +30,7 @@
 #ifndef SHAREDGUICOMPONENTS_OSGRIDVIEW_HPP
 #define SHAREDGUICOMPONENTS_OSGRIDVIEW_HPP
 
+#include <QPointer>
 #include <QTimer>
 #include <QWidget>
 
@@ -44,6 +45,7 @@ class QLabel;
 class QShowEvent;
 class QString;
 class QLayoutItem;
+class QScrollArea;
 
 namespace openstudio{
 
@@ -78,6 +80,15 @@ public:
 
   void requestAddRow(int row);
 
+  // When virtualized, rows are only built as they are scrolled into view of the enclosing scroll area,
+  // and adding or removing a row only rebuilds the rows after it
+  void setVirtualized(bool virtualized);
+
+  bool virtualized() const;
+
+  // build any rows before rowCount that have not been built yet
+  void ensureRowsBuilt(int rowCount);
+
   QVBoxLayout * m_contentLayout;
 
 protected:
@@ -116,6 +127,8 @@ private slots:
 
   void selectRowDeterminedByModelSubTabView();
 
+  void onScrollChanged();
+
 private:
 
   enum QueueType
@@ -135,6 +148,18 @@ private:
 
   void setGridController(OSGridController * gridController);
 
+  // build widgets for rows [firstRow, lastRow)
+  void buildRows(int firstRow, int lastRow);
+
+  // delete widgets for all rows from firstRow on
+  void deleteRows(int firstRow);
+
+  // rebuild rows after the first added or removed row
+  void refreshChangedRows();
+
+  // find the scroll area we are in and build rows as it scrolls
+  void connectToScrollArea();
+
   static const int ROWS_PER_LAYOUT = 100;
 
   std::vector<QGridLayout *> m_gridLayouts;
@@ -147,9 +172,18 @@ private:
 
   QTimer m_timer;
 
-  int m_rowToAdd = -1;
+  // first row added or removed since the last refresh
+  int m_firstChangedRow = -1;
+
+  // number of rows in the grid controller when rows were last built, an object's subrows share its row
+  int m_lastRowCount = 0;
+
+  bool m_virtualized = false;
+
+  // number of rows with widgets, all rows unless virtualized
+  int m_builtRowCount = 0;
 
-  int m_rowToRemove = -1;
+  QPointer<QScrollArea> m_scrollArea;
 };
 
 } // openstudio
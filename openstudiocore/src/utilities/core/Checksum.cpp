@@ -28,62 +28,188 @@
 ***********************************************************************************************************************/
 
 #include "Checksum.hpp"
+#include "Filesystem.hpp"
+#include "PathHelpers.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
 #include <ios>
+#include <map>
+#include <mutex>
 #include <sstream>
-
-#include <boost/crc.hpp>
+#include <utility>
+#include <vector>
 
 
 namespace openstudio {
 
   namespace detail {
 
-    bool checksumIgnore(char c)
+    // CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320) using slice-by-8 tables,
+    // produces the same values as boost::crc_32_type
+    struct Crc32Tables
+    {
+      Crc32Tables()
+      {
+        for (uint32_t i = 0; i < 256; ++i){
+          uint32_t crc = i;
+          for (unsigned j = 0; j < 8; ++j){
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+          }
+          table[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; ++i){
+          for (unsigned k = 1; k < 8; ++k){
+            table[k][i] = (table[k-1][i] >> 8) ^ table[0][table[k-1][i] & 0xFF];
+          }
+        }
+      }
+
+      uint32_t table[8][256];
+    };
+
+    const Crc32Tables& crc32Tables()
     {
-      // ignore all whitespace
-      //bool result = (c == ' ' || c == '\t' || c == '\n' ||  c == '\v' || c == '\f' || c == '\r');
+      static const Crc32Tables tables;
+      return tables;
+    }
 
+    uint32_t crc32Update(uint32_t crc, const unsigned char* data, size_t size)
+    {
+      const Crc32Tables& tables = crc32Tables();
+      const uint32_t (&t)[8][256] = tables.table;
+
+      while (size >= 8){
+        uint32_t one = crc ^ (static_cast<uint32_t>(data[0]) |
+                              (static_cast<uint32_t>(data[1]) << 8) |
+                              (static_cast<uint32_t>(data[2]) << 16) |
+                              (static_cast<uint32_t>(data[3]) << 24));
+        uint32_t two = static_cast<uint32_t>(data[4]) |
+                       (static_cast<uint32_t>(data[5]) << 8) |
+                       (static_cast<uint32_t>(data[6]) << 16) |
+                       (static_cast<uint32_t>(data[7]) << 24);
+        crc = t[7][one & 0xFF] ^ t[6][(one >> 8) & 0xFF] ^ t[5][(one >> 16) & 0xFF] ^ t[4][one >> 24] ^
+              t[3][two & 0xFF] ^ t[2][(two >> 8) & 0xFF] ^ t[1][(two >> 16) & 0xFF] ^ t[0][two >> 24];
+        data += 8;
+        size -= 8;
+      }
+
+      while (size > 0){
+        crc = (crc >> 8) ^ t[0][(crc ^ *data) & 0xFF];
+        ++data;
+        --size;
+      }
+
+      return crc;
+    }
+
+    // process a block of bytes, skipping ignored characters without copying the block
+    uint32_t crc32UpdateFiltered(uint32_t crc, const char* data, size_t size)
+    {
       // ignore just line feed
-      bool result = (c == '\r');
+      const char* end = data + size;
+      while (data < end){
+        const char* cr = static_cast<const char*>(std::memchr(data, '\r', static_cast<size_t>(end - data)));
+        const char* runEnd = cr ? cr : end;
+        crc = crc32Update(crc, reinterpret_cast<const unsigned char*>(data), static_cast<size_t>(runEnd - data));
+        data = cr ? cr + 1 : end;
+      }
+      return crc;
+    }
 
-      return result;
+    std::string formatChecksum(uint32_t crc)
+    {
+      char buffer[9];
+      std::snprintf(buffer, sizeof(buffer), "%08X", static_cast<unsigned>(crc));
+      return std::string(buffer);
+    }
+
+    struct ChecksumCacheEntry
+    {
+      uintmax_t size;
+      std::time_t lastWriteTime;
+      std::string checksum;
+    };
+
+    // checksums keyed by path, only reused while size and last write time match the file on disk
+    struct ChecksumCache
+    {
+      std::mutex mutex;
+      std::map<std::string, ChecksumCacheEntry> entries;
+    };
+
+    ChecksumCache& checksumCache()
+    {
+      static ChecksumCache cache;
+      return cache;
+    }
+
+    // files written within this many seconds of now may be modified again without changing their
+    // last write time, checksums of such files are not cached
+    const std::time_t racyWriteSeconds = 2;
+
+    // name of the cache file when loadChecksumCache or saveChecksumCache is given a directory
+    const char * const checksumCacheFileName = "checksum_cache.txt";
+
+    path checksumCacheFile(const path& p)
+    {
+      try{
+        if (openstudio::filesystem::is_directory(p)){
+          return p / toPath(checksumCacheFileName);
+        }
+      }catch(...){
+      }
+      return p;
+    }
+
+    // checksum of the relative paths and cached checksums of all regular files in a directory tree
+    std::string cachedDirectoryChecksum(const path& dir)
+    {
+      std::vector<std::pair<std::string, path> > files;
+      try{
+        for (openstudio::filesystem::recursive_directory_iterator it(dir), end; it != end; ++it){
+          if (openstudio::filesystem::is_regular_file(it->path())){
+            files.push_back(std::make_pair(relativePath(it->path(), dir).generic_string(), it->path()));
+          }
+        }
+      }catch(...){
+        return "00000000";
+      }
+
+      // directory iteration order is unspecified
+      std::sort(files.begin(), files.end());
+
+      std::string listing;
+      for (const auto& file : files){
+        listing += file.first + '\t' + cachedChecksum(file.second) + '\n';
+      }
+      return checksum(listing);
     }
   }
 
   /// return 8 character hex checksum of string
   std::string checksum(const std::string& s)
   {
-    std::stringstream ss(s);
-    return checksum(ss);
+    uint32_t crc = detail::crc32UpdateFiltered(0xFFFFFFFFu, s.data(), s.size());
+    return detail::formatChecksum(crc ^ 0xFFFFFFFFu);
   }
 
   /// return 8 character hex checksum of istream
   std::string checksum(std::istream& is)
   {
-    boost::crc_32_type  crc;
+    uint32_t crc = 0xFFFFFFFFu;
     do{
-      const std::streamsize n = 1024;
-      char  buffer[n];
+      const std::streamsize n = 16384;
+      char buffer[n];
       is.read(buffer, n);
       std::streamsize readSize = is.gcount();
-      //crc.process_bytes(buffer, readSize);
-
-      size_t stringSize = static_cast<size_t>(readSize);
-      std::string str(buffer, stringSize);
-      str.erase( std::remove_if( str.begin(), str.end(), openstudio::detail::checksumIgnore ), str.end() );
-      stringSize = str.size();
-
-      crc.process_bytes(str.c_str(), stringSize);
+      crc = detail::crc32UpdateFiltered(crc, buffer, static_cast<size_t>(readSize));
     } while ( is );
 
-    std::stringstream ss;
-    ss << std::hex << std::uppercase << crc.checksum();
-    std::string result = "00000000";
-    std::string checksum = ss.str();
-    result.replace(8-checksum.size(), checksum.size(), checksum);
-
-    return result;
+    return detail::formatChecksum(crc ^ 0xFFFFFFFFu);
   }
 
   /// return 8 character hex checksum of file contents
@@ -100,4 +226,108 @@ namespace openstudio {
     return result;
   }
 
+  std::string cachedChecksum(const path& p)
+  {
+    uintmax_t size = 0;
+    std::time_t lastWriteTime = 0;
+    try{
+      if (openstudio::filesystem::is_directory(p)){
+        return detail::cachedDirectoryChecksum(p);
+      }
+      if (!openstudio::filesystem::is_regular_file(p)){
+        return checksum(p);
+      }
+      size = openstudio::filesystem::file_size(p);
+      lastWriteTime = openstudio::filesystem::last_write_time(p);
+    }catch(...){
+      return checksum(p);
+    }
+
+    std::string key = p.generic_string();
+    detail::ChecksumCache& cache = detail::checksumCache();
+    {
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      auto it = cache.entries.find(key);
+      if (it != cache.entries.end()){
+        if (it->second.size == size && it->second.lastWriteTime == lastWriteTime){
+          return it->second.checksum;
+        }
+        cache.entries.erase(it);
+      }
+    }
+
+    std::string result = checksum(p);
+
+    if (lastWriteTime + detail::racyWriteSeconds < std::time(nullptr)){
+      detail::ChecksumCacheEntry entry;
+      entry.size = size;
+      entry.lastWriteTime = lastWriteTime;
+      entry.checksum = result;
+
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      cache.entries[key] = entry;
+    }
+
+    return result;
+  }
+
+  void clearChecksumCache()
+  {
+    detail::ChecksumCache& cache = detail::checksumCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.entries.clear();
+  }
+
+  bool loadChecksumCache(const path& p)
+  {
+    openstudio::filesystem::ifstream ifs(detail::checksumCacheFile(p));
+    if (!ifs){
+      return false;
+    }
+
+    std::map<std::string, detail::ChecksumCacheEntry> entries;
+    std::string line;
+    while (std::getline(ifs, line)){
+      // each line is checksum, size, last write time and path separated by tabs
+      std::istringstream ss(line);
+      detail::ChecksumCacheEntry entry;
+      std::string key;
+      if (!std::getline(ss, entry.checksum, '\t') || entry.checksum.size() != 8){
+        continue;
+      }
+      long long lastWriteTime = 0;
+      if (!(ss >> entry.size) || ss.get() != '\t' || !(ss >> lastWriteTime) || ss.get() != '\t'){
+        continue;
+      }
+      if (!std::getline(ss, key) || key.empty()){
+        continue;
+      }
+      entry.lastWriteTime = static_cast<std::time_t>(lastWriteTime);
+      entries[key] = entry;
+    }
+
+    detail::ChecksumCache& cache = detail::checksumCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    for (const auto& entry : entries){
+      cache.entries[entry.first] = entry.second;
+    }
+    return true;
+  }
+
+  bool saveChecksumCache(const path& p)
+  {
+    openstudio::filesystem::ofstream ofs(detail::checksumCacheFile(p), std::ios_base::trunc);
+    if (!ofs){
+      return false;
+    }
+
+    detail::ChecksumCache& cache = detail::checksumCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    for (const auto& entry : cache.entries){
+      ofs << entry.second.checksum << '\t' << entry.second.size << '\t'
+          << static_cast<long long>(entry.second.lastWriteTime) << '\t' << entry.first << '\n';
+    }
+    return static_cast<bool>(ofs);
+  }
+
 } // openstudio
@@ -47,6 +47,22 @@ namespace openstudio {
   /// return 8 character hex checksum of file contents
   UTILITIES_API std::string checksum(const path& p);
 
+  /// return 8 character hex checksum of file contents, reusing the result of an earlier call if the file's
+  /// size and last write time are unchanged, entries are shared by all callers in this process
+  /// if p is a directory, return a checksum of the relative paths and checksums of all files below it
+  UTILITIES_API std::string cachedChecksum(const path& p);
+
+  /// forget all checksums remembered by cachedChecksum
+  UTILITIES_API void clearChecksumCache();
+
+  /// merge checksums previously written by saveChecksumCache into the cache, returns false if the file could not be read
+  /// if p is a directory, the cache is read from checksum_cache.txt in that directory
+  UTILITIES_API bool loadChecksumCache(const path& p);
+
+  /// write the checksums remembered by cachedChecksum to a file, returns false if the file could not be written
+  /// if p is a directory, the cache is written to checksum_cache.txt in that directory
+  UTILITIES_API bool saveChecksumCache(const path& p);
+
 } // openstudio
 
 
@@ -0,0 +1,90 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_PARALLELFOR_HPP
+#define UTILITIES_CORE_PARALLELFOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace openstudio
+{
+  /**
+   * Calls f(i) for each i in [0, n), spread over the available cores when parallel is true.
+   *
+   * The calling thread takes part in the work and the call returns once all indices are done.
+   * f must be safe to call from several threads at once, in particular it must not use model objects
+   * or log through a LogSink filtered by thread.  If f throws, the remaining indices are still
+   * processed and the first exception is rethrown on the calling thread once all threads have joined.
+   */
+  template <typename F>
+    void parallelFor(size_t n, F f, bool parallel = true)
+    {
+      std::atomic<size_t> next(0);
+      std::exception_ptr error;
+      std::mutex errorMutex;
+      auto worker = [&]() {
+        for (size_t i = next++; i < n; i = next++) {
+          try {
+            f(i);
+          } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) {
+              error = std::current_exception();
+            }
+          }
+        }
+      };
+
+      size_t numThreads = 1;
+      if (parallel) {
+        numThreads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), n);
+      }
+
+      std::vector<std::thread> threads;
+      for (size_t i = 1; i < numThreads; ++i) {
+        threads.push_back(std::thread(worker));
+      }
+      worker();
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+
+} // openstudio
+
+#endif // UTILITIES_CORE_PARALLELFOR_HPP
@@ -32,12 +32,20 @@
 #include "../Checksum.hpp"
 #include "../UUID.hpp"
 #include "../Containers.hpp"
+#include "../Filesystem.hpp"
 
 #include <resources.hxx>
 
+#include <ctime>
+#include <iterator>
+
 using openstudio::path;
 using openstudio::toPath;
 using openstudio::checksum;
+using openstudio::cachedChecksum;
+using openstudio::clearChecksumCache;
+using openstudio::loadChecksumCache;
+using openstudio::saveChecksumCache;
 using openstudio::createUUID;
 using openstudio::StringVector;
 using openstudio::toString;
@@ -125,3 +133,148 @@ TEST(Checksum, UUIDs) {
     EXPECT_TRUE(std::find(itStart,itEnd,*it) == itEnd);
   }
 }
+
+TEST(Checksum, LargeString)
+{
+  // long enough to exercise the 8 byte blocks and the carriage returns that straddle them
+  string s;
+  string sNoCR;
+  for (unsigned i = 0; i < 10000; ++i) {
+    s += "line " + std::to_string(i) + "\r\n";
+    sNoCR += "line " + std::to_string(i) + "\n";
+  }
+  EXPECT_EQ(checksum(sNoCR), checksum(s));
+
+  stringstream ss(s);
+  EXPECT_EQ(checksum(sNoCR), checksum(ss));
+}
+
+TEST(Checksum, CachedChecksum)
+{
+  clearChecksumCache();
+
+  path p = resourcesPath() / toPath("utilities/Checksum/Checksum.txt");
+  EXPECT_EQ("1AD514BA", cachedChecksum(p));
+  EXPECT_EQ("1AD514BA", cachedChecksum(p));
+
+  // directories are checksummed from the files in them
+  p = resourcesPath() / toPath("utilities/Checksum/");
+  std::string dirChecksum = cachedChecksum(p);
+  EXPECT_NE("00000000", dirChecksum);
+  EXPECT_EQ(dirChecksum, cachedChecksum(p));
+
+  p = resourcesPath() / toPath("utilities/Checksum/NotAFile.txt");
+  EXPECT_EQ("00000000", cachedChecksum(p));
+
+  // a file that changes is checksummed again
+  p = openstudio::filesystem::temp_directory_path() / toPath("CachedChecksum.txt");
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hi there";
+  }
+  EXPECT_EQ("1AD514BA", cachedChecksum(p));
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "HI there";
+  }
+  EXPECT_EQ("D5682D26", cachedChecksum(p));
+  openstudio::filesystem::remove(p);
+
+  clearChecksumCache();
+}
+
+TEST(Checksum, SaveLoadChecksumCache)
+{
+  clearChecksumCache();
+
+  path p = resourcesPath() / toPath("utilities/Checksum/Checksum2.txt");
+  EXPECT_EQ("17B88D3A", cachedChecksum(p));
+
+  path cachePath = openstudio::filesystem::temp_directory_path() / toPath("ChecksumCache.txt");
+  EXPECT_TRUE(saveChecksumCache(cachePath));
+
+  clearChecksumCache();
+  EXPECT_TRUE(loadChecksumCache(cachePath));
+  EXPECT_EQ("17B88D3A", cachedChecksum(p));
+
+  openstudio::filesystem::remove(cachePath);
+  EXPECT_FALSE(loadChecksumCache(cachePath));
+
+  clearChecksumCache();
+}
+
+TEST(Checksum, ChecksumCacheInvalidation)
+{
+  clearChecksumCache();
+
+  path dir = openstudio::filesystem::temp_directory_path() / toPath("ChecksumCacheInvalidation");
+  openstudio::filesystem::remove_all(dir);
+  openstudio::filesystem::create_directories(dir / toPath("sub"));
+
+  // files must be older than a couple of seconds to be cached
+  std::time_t written = std::time(nullptr) - 100;
+
+  path p = dir / toPath("Checksum.txt");
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hi there";
+  }
+  openstudio::filesystem::last_write_time(p, written);
+  EXPECT_EQ("1AD514BA", cachedChecksum(p));
+
+  // replace the saved checksum so that cache hits can be told apart from checksumming the file again
+  path cachePath = dir / toPath("checksum_cache.txt");
+  EXPECT_TRUE(saveChecksumCache(dir));
+  ASSERT_TRUE(openstudio::filesystem::exists(cachePath));
+  std::string cacheContents;
+  {
+    openstudio::filesystem::ifstream ifs(cachePath, std::ios_base::binary);
+    cacheContents.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+  }
+  ASSERT_EQ(0u, cacheContents.find("1AD514BA"));
+  cacheContents.replace(0, 8, "12345678");
+  {
+    openstudio::filesystem::ofstream ofs(cachePath, std::ios_base::binary);
+    ofs << cacheContents;
+  }
+
+  clearChecksumCache();
+  EXPECT_TRUE(loadChecksumCache(dir));
+  EXPECT_EQ("12345678", cachedChecksum(p));
+
+  // a new last write time is a miss
+  openstudio::filesystem::last_write_time(p, written + 10);
+  EXPECT_EQ("1AD514BA", cachedChecksum(p));
+
+  // a new size is a miss even if the last write time is unchanged
+  clearChecksumCache();
+  openstudio::filesystem::last_write_time(p, written);
+  EXPECT_TRUE(loadChecksumCache(dir));
+  EXPECT_EQ("12345678", cachedChecksum(p));
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hi there!";
+  }
+  openstudio::filesystem::last_write_time(p, written);
+  EXPECT_EQ(checksum(p), cachedChecksum(p));
+  EXPECT_NE("12345678", cachedChecksum(p));
+
+  // a directory checksum changes when a file below it changes
+  path other = dir / toPath("sub/Other.txt");
+  {
+    openstudio::filesystem::ofstream ofs(other, std::ios_base::binary);
+    ofs << "Hi there";
+  }
+  openstudio::filesystem::last_write_time(other, written);
+  std::string dirChecksum = cachedChecksum(dir);
+  EXPECT_EQ(dirChecksum, cachedChecksum(dir));
+  {
+    openstudio::filesystem::ofstream ofs(other, std::ios_base::binary);
+    ofs << "HI there";
+  }
+  openstudio::filesystem::last_write_time(other, written + 10);
+  EXPECT_NE(dirChecksum, cachedChecksum(dir));
+
+  openstudio::filesystem::remove_all(dir);
+  clearChecksumCache();
+}
@@ -0,0 +1,71 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../ParallelFor.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace openstudio;
+
+TEST(ParallelFor, VisitsEachIndexOnce)
+{
+  for (bool parallel : {false, true}) {
+    std::vector<std::atomic<int> > counts(1000);
+    for (std::atomic<int>& count : counts) {
+      count = 0;
+    }
+
+    parallelFor(counts.size(), [&counts](size_t i) { ++counts[i]; }, parallel);
+
+    for (const std::atomic<int>& count : counts) {
+      EXPECT_EQ(1, count.load());
+    }
+  }
+
+  // nothing to do
+  parallelFor(0, [](size_t) { FAIL(); });
+}
+
+TEST(ParallelFor, RethrowsAfterJoining)
+{
+  std::atomic<size_t> visited(0);
+  EXPECT_THROW(parallelFor(100, [&visited](size_t i) {
+    ++visited;
+    if (i % 10 == 3) {
+      throw std::runtime_error("failed");
+    }
+  }), std::runtime_error);
+
+  // the other indices are still processed
+  EXPECT_EQ(100u, visited.load());
+}
@@ -215,6 +215,22 @@ OPENSTUDIO_ENUM(BuildingSector,
   ((Commercial)(NonResidential))
   ((Residential)));
 
+/** \class TimeSeriesAggregationType
+ *  \brief How TimeSeries values are combined when resampling or over a rolling window.
+ *  \details See the OPENSTUDIO_ENUM documentation in utilities/core/Enum.hpp. The actual macro call is:
+ *  \code
+OPENSTUDIO_ENUM(TimeSeriesAggregationType,
+  ((Sum))
+  ((Mean))
+  ((Maximum))
+  ((Minimum)));
+ *  \endcode */
+OPENSTUDIO_ENUM(TimeSeriesAggregationType,
+  ((Sum))
+  ((Mean))
+  ((Maximum))
+  ((Minimum)));
+
 } // openstudio
 
 #endif // UTILITIES_DATA_DATAENUMS_HPP
@@ -1232,3 +1232,136 @@ TEST_F(DataFixture, TimeSeries_Monthly)
   // Check computations
   EXPECT_EQ(205804800, startTimeSeries.integrate());
 }
+
+TEST_F(DataFixture, TimeSeries_AlignedArithmetic)
+{
+  std::string units = "W";
+  Time interval(0, 1);
+  Date startDate(MonthOfYear(MonthOfYear::Jan), 1);
+  DateTime firstReportDateTime(startDate, interval);
+
+  std::vector<TimeSeries> timeSeriesVector;
+  for (unsigned j = 0; j < 5; ++j) {
+    Vector values(8760);
+    for (unsigned i = 0; i < 8760; ++i) {
+      values[i] = 0.1 * (i % 24) + j;
+    }
+    timeSeriesVector.push_back(TimeSeries(firstReportDateTime, interval, values, units));
+  }
+
+  // same report times
+  TimeSeries total = timeSeriesVector[0] + timeSeriesVector[1];
+  TimeSeries difference = timeSeriesVector[0] - timeSeriesVector[1];
+  ASSERT_EQ(8760u, total.values().size());
+  ASSERT_EQ(8760u, difference.values().size());
+  EXPECT_EQ(firstReportDateTime, total.firstReportDateTime());
+  for (unsigned i = 0; i < 8760; ++i) {
+    EXPECT_EQ(timeSeriesVector[0].values(i) + timeSeriesVector[1].values(i), total.values(i));
+    EXPECT_EQ(timeSeriesVector[0].values(i) - timeSeriesVector[1].values(i), difference.values(i));
+  }
+
+  // n-ary sum matches adding one by one
+  TimeSeries chained = timeSeriesVector[0];
+  for (unsigned j = 1; j < timeSeriesVector.size(); ++j) {
+    chained = chained + timeSeriesVector[j];
+  }
+  TimeSeries summed = sum(timeSeriesVector);
+  ASSERT_EQ(chained.values().size(), summed.values().size());
+  for (unsigned i = 0; i < 8760; ++i) {
+    EXPECT_EQ(chained.values(i), summed.values(i));
+  }
+
+  // offset report times are merged
+  TimeSeries shifted(firstReportDateTime + Time(0, 0, 30, 0), interval, timeSeriesVector[1].values(), units);
+  TimeSeries merged = timeSeriesVector[0] + shifted;
+  ASSERT_EQ(2 * 8760u, merged.values().size());
+  EXPECT_EQ(firstReportDateTime, merged.firstReportDateTime());
+  DateTimeVector mergedDateTimes = merged.dateTimes();
+  for (unsigned i = 0; i < mergedDateTimes.size(); i += 97) {
+    EXPECT_DOUBLE_EQ(timeSeriesVector[0].value(mergedDateTimes[i]) + shifted.value(mergedDateTimes[i]), merged.values(i));
+  }
+
+  // different units
+  TimeSeries otherUnits(firstReportDateTime, interval, timeSeriesVector[1].values(), "C");
+  EXPECT_TRUE((timeSeriesVector[0] + otherUnits).values().empty());
+}
+
+TEST_F(DataFixture, TimeSeries_Resample)
+{
+  std::string units = "W";
+  Date startDate(MonthOfYear(MonthOfYear::Jan), 1);
+
+  // 15 minute data for two days
+  Time interval(0, 0, 15, 0);
+  Vector values(2 * 96);
+  for (unsigned i = 0; i < values.size(); ++i) {
+    values[i] = i % 4;
+  }
+  TimeSeries timeSeries(DateTime(startDate, interval), interval, values, units);
+
+  TimeSeries hourlySum = timeSeries.resample(Time(0, 1), TimeSeriesAggregationType::Sum);
+  ASSERT_EQ(48u, hourlySum.values().size());
+  ASSERT_TRUE(hourlySum.intervalLength());
+  EXPECT_EQ(Time(0, 1), hourlySum.intervalLength().get());
+  EXPECT_EQ(DateTime(startDate, Time(0, 1)), hourlySum.firstReportDateTime());
+  for (unsigned i = 0; i < 48; ++i) {
+    EXPECT_DOUBLE_EQ(6.0, hourlySum.values(i));
+  }
+
+  TimeSeries hourlyMax = timeSeries.resample(Time(0, 1), TimeSeriesAggregationType::Maximum);
+  TimeSeries hourlyMin = timeSeries.resample(Time(0, 1), TimeSeriesAggregationType::Minimum);
+  EXPECT_DOUBLE_EQ(3.0, hourlyMax.values(10));
+  EXPECT_DOUBLE_EQ(0.0, hourlyMin.values(10));
+
+  TimeSeries dailyMean = timeSeries.resample(Time(1), TimeSeriesAggregationType::Mean);
+  ASSERT_EQ(2u, dailyMean.values().size());
+  EXPECT_DOUBLE_EQ(1.5, dailyMean.values(0));
+  EXPECT_DOUBLE_EQ(1.5, dailyMean.values(1));
+
+  // hourly data for a year
+  Vector ones(8760, 1.0);
+  TimeSeries hourly(DateTime(startDate, Time(0, 1)), Time(0, 1), ones, units);
+  TimeSeries monthly = hourly.resampleMonthly(TimeSeriesAggregationType::Sum);
+  ASSERT_EQ(12u, monthly.values().size());
+  EXPECT_DOUBLE_EQ(744.0, monthly.values(0));
+  EXPECT_DOUBLE_EQ(672.0, monthly.values(1));
+  EXPECT_DOUBLE_EQ(744.0, monthly.values(11));
+  EXPECT_DOUBLE_EQ(8760.0, sum(monthly.values()));
+  EXPECT_EQ(DateTime(Date(MonthOfYear(MonthOfYear::Feb), 1)), monthly.firstReportDateTime());
+}
+
+TEST_F(DataFixture, TimeSeries_RollingWindow)
+{
+  std::string units = "W";
+  Date startDate(MonthOfYear(MonthOfYear::Jan), 1);
+  Time interval(0, 1);
+
+  Vector values(100);
+  for (unsigned i = 0; i < values.size(); ++i) {
+    values[i] = (i * 37) % 11;
+  }
+  TimeSeries timeSeries(DateTime(startDate, interval), interval, values, units);
+
+  TimeSeries rollingSum = timeSeries.rollingWindow(Time(0, 3), TimeSeriesAggregationType::Sum);
+  TimeSeries rollingMean = timeSeries.rollingWindow(Time(0, 3), TimeSeriesAggregationType::Mean);
+  TimeSeries rollingMax = timeSeries.rollingWindow(Time(0, 3), TimeSeriesAggregationType::Maximum);
+  TimeSeries rollingMin = timeSeries.rollingWindow(Time(0, 3), TimeSeriesAggregationType::Minimum);
+  ASSERT_EQ(values.size(), rollingSum.values().size());
+  EXPECT_EQ(timeSeries.firstReportDateTime(), rollingSum.firstReportDateTime());
+
+  for (unsigned i = 0; i < values.size(); ++i) {
+    unsigned begin = (i < 2) ? 0 : i - 2;
+    double expectedSum = 0;
+    double expectedMax = values[begin];
+    double expectedMin = values[begin];
+    for (unsigned j = begin; j <= i; ++j) {
+      expectedSum += values[j];
+      expectedMax = std::max(expectedMax, values[j]);
+      expectedMin = std::min(expectedMin, values[j]);
+    }
+    EXPECT_DOUBLE_EQ(expectedSum, rollingSum.values(i));
+    EXPECT_DOUBLE_EQ(expectedSum / (i - begin + 1), rollingMean.values(i));
+    EXPECT_DOUBLE_EQ(expectedMax, rollingMax.values(i));
+    EXPECT_DOUBLE_EQ(expectedMin, rollingMin.values(i));
+  }
+}
@@ -30,6 +30,7 @@
 #include "TimeSeries.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
 #include <exception>
 #include <set>
 
@@ -40,7 +41,7 @@ namespace openstudio{
 
 namespace detail{
 
-TimeSeries_Impl::TimeSeries_Impl() :m_outOfRangeValue(0.0)
+TimeSeries_Impl::TimeSeries_Impl() :m_outOfRangeValue(0.0), m_wrapAround(false)
 {}
 
 TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLength, const Vector& values, const std::string& units)
@@ -683,38 +684,126 @@ void TimeSeries_Impl::setOutOfRangeValue(double value)
   m_outOfRangeValue = value;
 }
 
-/// add timeseries
-std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator+(const TimeSeries_Impl& other) const
+bool TimeSeries_Impl::isAlignedWith(const TimeSeries_Impl& other) const
 {
-  std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
+  if (m_values.size() != other.m_values.size() || m_firstReportDateTime != other.m_firstReportDateTime) {
+    return false;
+  }
 
-  // if same units
-  if (m_units == other.units()) {
+  // equal intervals do not need to compare every time
+  if (m_intervalLength && other.m_intervalLength) {
+    return m_intervalLength->totalSeconds() == other.m_intervalLength->totalSeconds();
+  }
+
+  return (m_secondsFromFirstReport == other.m_secondsFromFirstReport);
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::withValues(const Vector& values) const
+{
+  OS_ASSERT(values.size() == m_values.size());
+  std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl(*this));
+  result->m_values = values;
+  return result;
+}
 
-    // make unique, ordered set of all date times
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::combine(const TimeSeries_Impl& other, double sign) const
+{
+  // same report times, combine the value arrays directly
+  if (isAlignedWith(other)) {
+    unsigned n = m_values.size();
+    if (n == 0) {
+      return withValues(m_values);
+    }
+    Vector values(n);
+    const double* lhs = &m_values.data()[0];
+    const double* rhs = &other.m_values.data()[0];
+    double* out = &values.data()[0];
+    for (unsigned i = 0; i < n; ++i) {
+      out[i] = lhs[i] + sign*rhs[i];
+    }
+    return withValues(values);
+  }
+
+  // dates wrapping around the end of the year or mixing calendar and assumed years need the date time lookups
+  bool sameYearType = (m_firstReportDateTime.date().baseYear().is_initialized() == other.m_firstReportDateTime.date().baseYear().is_initialized());
+  if (m_wrapAround || other.m_wrapAround || !sameYearType || m_values.empty() || other.m_values.empty()) {
     std::set<DateTime> dateTimesSet;
     DateTimeVector dateTimes1 = dateTimes();
     DateTimeVector dateTimes2 = other.dateTimes();
     dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
     dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
 
-    // create vector out of set
     DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
 
-    // compute value at each date time
     Vector values(dateTimesSet.size());
     unsigned valueIndex = 0;
     for (const DateTime& dt : dateTimes) {
-      values[valueIndex] = value(dt) + other.value(dt);
+      values[valueIndex] = value(dt) + sign*other.value(dt);
+      ++valueIndex;
+    }
 
-      LOG(Debug, "At '" << dt << "' " << value(dt) << " + " << other.value(dt) << " = " << values[valueIndex]);
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+  }
 
-      ++valueIndex;
+  // merge the report times of both series, relative to the earlier first report
+  long otherOffset = (other.m_firstReportDateTime - m_firstReportDateTime).totalSeconds();
+  long thisShift = (otherOffset < 0) ? -otherOffset : 0;
+  long otherShift = (otherOffset < 0) ? 0 : otherOffset;
+  DateTime firstReportDateTime = (otherOffset < 0) ? other.m_firstReportDateTime : m_firstReportDateTime;
+
+  std::vector<long> seconds;
+  seconds.reserve(m_secondsFromFirstReport.size() + other.m_secondsFromFirstReport.size());
+  auto it1 = m_secondsFromFirstReport.begin();
+  auto it2 = other.m_secondsFromFirstReport.begin();
+  while (it1 != m_secondsFromFirstReport.end() || it2 != other.m_secondsFromFirstReport.end()) {
+    long next;
+    if (it2 == other.m_secondsFromFirstReport.end() || (it1 != m_secondsFromFirstReport.end() && *it1 + thisShift <= *it2 + otherShift)) {
+      next = *it1 + thisShift;
+      ++it1;
+    } else {
+      next = *it2 + otherShift;
+      ++it2;
+    }
+    if (seconds.empty() || seconds.back() != next) {
+      seconds.push_back(next);
     }
+  }
+
+  Vector values(seconds.size());
+  for (unsigned i = 0; i < seconds.size(); ++i) {
+    values[i] = valueAtSecondsFromFirstReport(seconds[i] - thisShift) + sign*other.valueAtSecondsFromFirstReport(seconds[i] - otherShift);
+  }
 
-    // make new result
-    result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+  if (seconds.size() < 2) {
+    DateTimeVector dateTimes(1, firstReportDateTime);
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+  }
 
+  // same state the date time constructor would produce for these report times
+  std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
+  long firstIntervalSeconds = seconds[1] - seconds[0];
+  result->m_firstReportDateTime = firstReportDateTime;
+  result->m_startDateTime = firstReportDateTime - Time(0, 0, 0, firstIntervalSeconds);
+  result->m_secondsFromFirstReport = seconds;
+  result->m_secondsFromFirstReportAsVector = createVector(seconds);
+  result->m_secondsFromStart.resize(seconds.size());
+  for (unsigned i = 0; i < seconds.size(); ++i) {
+    result->m_secondsFromStart[i] = seconds[i] + firstIntervalSeconds;
+  }
+  result->m_values = values;
+  result->m_units = m_units;
+  result->m_wrapAround = false;
+  return result;
+}
+
+/// add timeseries
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator+(const TimeSeries_Impl& other) const
+{
+  std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
+
+  // if same units
+  if (m_units == other.units()) {
+    result = combine(other, 1.0);
   } else {
     LOG(Warn, "Adding timeseries with different units returns an empty timeseries");
   }
@@ -729,38 +818,209 @@ std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Imp
 
   // if same units
   if (m_units == other.units()) {
+    result = combine(other, -1.0);
+  } else {
+    LOG(Warn, "Subtracting timeseries with different units returns an empty timeseries");
+  }
 
-    // make unique, ordered set of all date times
-    std::set<DateTime> dateTimesSet;
-    DateTimeVector dateTimes1 = dateTimes();
-    DateTimeVector dateTimes2 = other.dateTimes();
-    dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
-    dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
+  return result;
+}
 
-    // create vector out of set
-    DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::alignedSum(const std::vector<std::shared_ptr<TimeSeries_Impl> >& timeSeries)
+{
+  if (timeSeries.size() < 2 || timeSeries.front()->m_values.empty()) {
+    return std::shared_ptr<TimeSeries_Impl>();
+  }
 
-    // compute value at each date time
-    Vector values(dateTimesSet.size());
-    unsigned valueIndex = 0;
-    for (const DateTime& dt : dateTimes) {
-      values[valueIndex] = value(dt) - other.value(dt);
+  const TimeSeries_Impl& first = *timeSeries.front();
+  for (const auto& ts : timeSeries) {
+    if (ts->m_units != first.m_units || !first.isAlignedWith(*ts)) {
+      return std::shared_ptr<TimeSeries_Impl>();
+    }
+  }
 
-      LOG(Debug, "At '" << dt << "' " << value(dt) << " - " << other.value(dt) << " = " << values[valueIndex]);
+  // accumulate in order so results match adding the series one by one
+  unsigned n = first.m_values.size();
+  Vector values(first.m_values);
+  double* out = &values.data()[0];
+  for (unsigned j = 1; j < timeSeries.size(); ++j) {
+    const double* in = &timeSeries[j]->m_values.data()[0];
+    for (unsigned i = 0; i < n; ++i) {
+      out[i] += in[i];
+    }
+  }
 
-      ++valueIndex;
+  return first.withValues(values);
+}
+
+namespace {
+
+  // running aggregate of the values in one period
+  struct Aggregate
+  {
+    Aggregate() : sum(0), maximum(0), minimum(0), count(0) {}
+
+    void add(double value)
+    {
+      sum += value;
+      maximum = (count == 0) ? value : std::max(maximum, value);
+      minimum = (count == 0) ? value : std::min(minimum, value);
+      ++count;
     }
 
-    // make new result
-    result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+    double result(const TimeSeriesAggregationType& aggregationType, double emptyValue) const
+    {
+      if (aggregationType == TimeSeriesAggregationType::Sum) {
+        return sum;
+      }
+      if (count == 0) {
+        return emptyValue;
+      }
+      if (aggregationType == TimeSeriesAggregationType::Mean) {
+        return sum / count;
+      } else if (aggregationType == TimeSeriesAggregationType::Maximum) {
+        return maximum;
+      }
+      return minimum;
+    }
 
-  } else {
-    LOG(Warn, "Subtracting timeseries with different units returns an empty timeseries");
+    double sum;
+    double maximum;
+    double minimum;
+    unsigned count;
+  };
+
+  // first day of the month after date
+  Date nextMonthStart(Date date)
+  {
+    MonthOfYear monthOfYear = date.monthOfYear();
+    while (date.monthOfYear() == monthOfYear) {
+      date += Time(1);
+    }
+    return date;
   }
 
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::resample(const Time& intervalLength, const TimeSeriesAggregationType& aggregationType) const
+{
+  long period = intervalLength.totalSeconds();
+  if (period <= 0) {
+    LOG(Warn, "Resampling to an interval of " << intervalLength << " returns an empty timeseries");
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+  }
+  if (m_values.empty()) {
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+  }
+
+  // values are reported at the end of their interval, so a report at the end of a period belongs to it
+  long dayOffset = m_firstReportDateTime.time().totalSeconds();
+  long firstPeriod = (dayOffset + m_secondsFromFirstReport.front() + period - 1) / period;
+  long lastPeriod = (dayOffset + m_secondsFromFirstReport.back() + period - 1) / period;
+
+  std::vector<Aggregate> aggregates(lastPeriod - firstPeriod + 1);
+  for (unsigned i = 0; i < m_values.size(); ++i) {
+    long p = (dayOffset + m_secondsFromFirstReport[i] + period - 1) / period;
+    aggregates[p - firstPeriod].add(m_values[i]);
+  }
+
+  Vector values(aggregates.size());
+  for (unsigned i = 0; i < aggregates.size(); ++i) {
+    values[i] = aggregates[i].result(aggregationType, m_outOfRangeValue);
+  }
+
+  DateTime firstReportDateTime = DateTime(m_firstReportDateTime.date()) + Time(0, 0, 0, firstPeriod*period);
+  std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl(firstReportDateTime, intervalLength, values, m_units));
+  result->m_outOfRangeValue = m_outOfRangeValue;
   return result;
 }
 
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::resampleMonthly(const TimeSeriesAggregationType& aggregationType) const
+{
+  if (m_values.empty()) {
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+  }
+
+  // a report at midnight on the first of a month belongs to the previous month
+  Date firstValueDate = (m_firstReportDateTime - Time(0, 0, 0, 1)).date();
+  Date monthStart = firstValueDate - Time(firstValueDate.dayOfMonth() - 1);
+  DateTime startDateTime(monthStart);
+
+  Date monthEnd = nextMonthStart(monthStart);
+  long monthEndSeconds = (DateTime(monthEnd) - m_firstReportDateTime).totalSeconds();
+
+  std::vector<long> timeInSeconds;
+  std::vector<Aggregate> aggregates(1);
+  timeInSeconds.push_back((DateTime(monthEnd) - startDateTime).totalSeconds());
+  for (unsigned i = 0; i < m_values.size(); ++i) {
+    while (m_secondsFromFirstReport[i] > monthEndSeconds) {
+      monthEnd = nextMonthStart(monthEnd);
+      monthEndSeconds = (DateTime(monthEnd) - m_firstReportDateTime).totalSeconds();
+      timeInSeconds.push_back((DateTime(monthEnd) - startDateTime).totalSeconds());
+      aggregates.push_back(Aggregate());
+    }
+    aggregates.back().add(m_values[i]);
+  }
+
+  Vector values(aggregates.size());
+  for (unsigned i = 0; i < aggregates.size(); ++i) {
+    values[i] = aggregates[i].result(aggregationType, m_outOfRangeValue);
+  }
+
+  DateTime firstReportDateTime = startDateTime + Time(0, 0, 0, timeInSeconds.front());
+  std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl(firstReportDateTime, timeInSeconds, values, m_units));
+  result->m_outOfRangeValue = m_outOfRangeValue;
+  return result;
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::rollingWindow(const Time& window, const TimeSeriesAggregationType& aggregationType) const
+{
+  long windowSeconds = window.totalSeconds();
+  if (windowSeconds <= 0) {
+    LOG(Warn, "Rolling window of " << window << " returns an empty timeseries");
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+  }
+
+  unsigned n = m_values.size();
+  Vector values(n);
+
+  if (aggregationType == TimeSeriesAggregationType::Sum || aggregationType == TimeSeriesAggregationType::Mean) {
+    // running sum over the reports in (t - window, t]
+    double sum = 0;
+    unsigned begin = 0;
+    for (unsigned i = 0; i < n; ++i) {
+      sum += m_values[i];
+      while (m_secondsFromFirstReport[begin] <= m_secondsFromFirstReport[i] - windowSeconds) {
+        sum -= m_values[begin];
+        ++begin;
+      }
+      if (aggregationType == TimeSeriesAggregationType::Sum) {
+        values[i] = sum;
+      } else {
+        values[i] = sum / (i - begin + 1);
+      }
+    }
+  } else {
+    // monotonic queue of candidate indices, front is the extreme value in the window
+    bool maximum = (aggregationType == TimeSeriesAggregationType::Maximum);
+    std::vector<unsigned> candidates(n);
+    unsigned front = 0;
+    unsigned back = 0;
+    for (unsigned i = 0; i < n; ++i) {
+      while (back > front && (maximum ? m_values[candidates[back - 1]] <= m_values[i] : m_values[candidates[back - 1]] >= m_values[i])) {
+        --back;
+      }
+      candidates[back++] = i;
+      while (m_secondsFromFirstReport[candidates[front]] <= m_secondsFromFirstReport[i] - windowSeconds) {
+        ++front;
+      }
+      values[i] = m_values[candidates[front]];
+    }
+  }
+
+  return withValues(values);
+}
+
 std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator*(double d) const {
   if (m_intervalLength) {
     return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime,
@@ -946,6 +1206,21 @@ double TimeSeries::averageValue() const
   return m_impl->averageValue();
 }
 
+TimeSeries TimeSeries::resample(const Time& intervalLength, const TimeSeriesAggregationType& aggregationType) const
+{
+  return TimeSeries(m_impl->resample(intervalLength, aggregationType));
+}
+
+TimeSeries TimeSeries::resampleMonthly(const TimeSeriesAggregationType& aggregationType) const
+{
+  return TimeSeries(m_impl->resampleMonthly(aggregationType));
+}
+
+TimeSeries TimeSeries::rollingWindow(const Time& window, const TimeSeriesAggregationType& aggregationType) const
+{
+  return TimeSeries(m_impl->rollingWindow(window, aggregationType));
+}
+
 TimeSeries::TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl)
   : m_impl(impl)
 {}
@@ -957,6 +1232,16 @@ TimeSeries operator*(double d, const TimeSeries& series)
 
 TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector)
 {
+  std::vector<std::shared_ptr<detail::TimeSeries_Impl> > impls;
+  impls.reserve(timeSeriesVector.size());
+  for (const TimeSeries& ts : timeSeriesVector) {
+    impls.push_back(ts.m_impl);
+  }
+  std::shared_ptr<detail::TimeSeries_Impl> alignedSum = detail::TimeSeries_Impl::alignedSum(impls);
+  if (alignedSum) {
+    return TimeSeries(alignedSum);
+  }
+
   TimeSeries result;
   bool first = true;
   for (const TimeSeries& ts : timeSeriesVector) {
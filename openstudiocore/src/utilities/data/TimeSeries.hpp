@@ -33,6 +33,7 @@
 #include "../UtilitiesAPI.hpp"
 
 #include "Vector.hpp"
+#include "DataEnums.hpp"
 #include "../time/Date.hpp"
 #include "../time/Time.hpp"
 #include "../time/DateTime.hpp"
@@ -110,9 +111,28 @@ public:
 
   double averageValue() const;
 
+  std::shared_ptr<TimeSeries_Impl> resample(const Time& intervalLength, const TimeSeriesAggregationType& aggregationType) const;
+
+  std::shared_ptr<TimeSeries_Impl> resampleMonthly(const TimeSeriesAggregationType& aggregationType) const;
+
+  std::shared_ptr<TimeSeries_Impl> rollingWindow(const Time& window, const TimeSeriesAggregationType& aggregationType) const;
+
+  /// sum of all timeSeries in one pass if they share units and report times, otherwise null
+  static std::shared_ptr<TimeSeries_Impl> alignedSum(const std::vector<std::shared_ptr<TimeSeries_Impl> >& timeSeries);
+
 private:
 
   REGISTER_LOGGER("utilities.TimeSeries_Impl");
+
+  // true if other reports at exactly the same times
+  bool isAlignedWith(const TimeSeries_Impl& other) const;
+
+  // this + sign*other, working on the seconds from first report rather than date times
+  std::shared_ptr<TimeSeries_Impl> combine(const TimeSeries_Impl& other, double sign) const;
+
+  // copy of this with different values reported at the same times
+  std::shared_ptr<TimeSeries_Impl> withValues(const Vector& values) const;
+
   // fully qualified first report date
   DateTime m_firstReportDateTime;
 
@@ -299,6 +319,18 @@ public:
   /** Compute the time series average value */
   double averageValue() const;
 
+  /** Aggregate values into consecutive periods of intervalLength, aligned to midnight of the first report date.
+   *  Each result value is reported at the end of its period. Empty periods sum to 0, other aggregations
+   *  of an empty period return outOfRangeValue(). */
+  TimeSeries resample(const Time& intervalLength, const TimeSeriesAggregationType& aggregationType) const;
+
+  /** Aggregate values into calendar months, each result value is reported at the end of its month. */
+  TimeSeries resampleMonthly(const TimeSeriesAggregationType& aggregationType) const;
+
+  /** Aggregate each value with the values reported during the preceding window, reported at the same times
+   *  as this series. A value reported at time t covers the reports in (t - window, t]. */
+  TimeSeries rollingWindow(const Time& window, const TimeSeriesAggregationType& aggregationType) const;
+
   //@}
 private:
 
@@ -306,6 +338,8 @@ private:
   // constructor from impl
   TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl);
 
+  friend UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
+
   // pointer to impl
   std::shared_ptr<detail::TimeSeries_Impl> m_impl;
 };
@@ -323,7 +357,8 @@ UTILITIES_API TimeSeries operator*(double d, const TimeSeries& series);
 // We should be able to tackle double/TimeSeries after adding get/setQuantity to
 // IdfObject.
 
-// Helper function to add up all the TimeSeries in timeSeriesVector.
+// Helper function to add up all the TimeSeries in timeSeriesVector. Series sharing units and report times
+// are added in a single pass.
 UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
 
 /** Returns std::function pointer to sum(const std::vector<TimeSeries>&). */
@@ -50,6 +50,12 @@ namespace detail{
   }
 
   std::string RunOptions_Impl::string() const
+  {
+    Json::StyledWriter writer;
+    return writer.write(toJSON());
+  }
+
+  Json::Value RunOptions_Impl::toJSON() const
   {
     Json::Value result;
 
@@ -89,8 +95,7 @@ namespace detail{
       result["output_adapter"] = outputAdapter;
     }
 
-    Json::StyledWriter writer;
-    return writer.write(result);
+    return result;
   }
 
   bool RunOptions_Impl::debug() const
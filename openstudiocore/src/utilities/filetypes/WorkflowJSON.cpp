@@ -135,7 +135,18 @@ namespace detail{
     return result;
   }
 
-  std::string WorkflowJSON_Impl::string(bool includeHash) const
+  std::string WorkflowJSON_Impl::string(bool includeHash, bool compact) const
+  {
+    if (compact){
+      Json::FastWriter writer;
+      return writer.write(toJSON(includeHash));
+    }
+
+    Json::StyledWriter writer;
+    return writer.write(toJSON(includeHash));
+  }
+
+  Json::Value WorkflowJSON_Impl::toJSON(bool includeHash) const
   {
     Json::Value clone(m_value);
     if (!includeHash){
@@ -144,29 +155,15 @@ namespace detail{
 
     Json::Value steps(Json::arrayValue);
     for (const auto& step : m_steps){
-
-      Json::Reader reader;
-      Json::Value stepValue;
-      bool parsingSuccessful = reader.parse(step.string(), stepValue);
-      if (parsingSuccessful){
-        steps.append(stepValue);
-      }
+      steps.append(step.getImpl<detail::WorkflowStep_Impl>()->toJSON());
     }
     clone["steps"] = steps;
 
     if (m_runOptions){
-      Json::Reader reader;
-      Json::Value options;
-      bool parsingSuccessful = reader.parse(m_runOptions->string(), options);
-      if (parsingSuccessful){
-        clone["run_options"] = options;
-      }
+      clone["run_options"] = m_runOptions->getImpl<detail::RunOptions_Impl>()->toJSON();
     }
 
-    Json::StyledWriter writer;
-    std::string result = writer.write(clone);
-
-    return result;
+    return clone;
   }
 
   std::string WorkflowJSON_Impl::hash() const
@@ -195,7 +192,7 @@ namespace detail{
     return result;
   }
 
-  bool WorkflowJSON_Impl::save() const
+  bool WorkflowJSON_Impl::save(bool compact) const
   {
     boost::optional<openstudio::path> p = oswPath();
     if (!p){
@@ -206,7 +203,7 @@ namespace detail{
       std::ofstream outFile(openstudio::toString(*p));
       if (outFile) {
         try {
-          outFile << string();
+          outFile << string(true, compact);
           outFile.close();
           return true;
         } catch (...) {
@@ -824,12 +821,7 @@ namespace detail{
 
     Json::ArrayIndex n = steps.size();
     for (Json::ArrayIndex i = 0; i < n; ++i){
-      Json::Value step = steps[i];
-
-      Json::FastWriter writer;
-      std::string s = writer.write(step);
-
-      boost::optional<WorkflowStep> workflowStep = WorkflowStep::fromString(s);
+      boost::optional<WorkflowStep> workflowStep = WorkflowStep_Impl::fromJSON(steps[i]);
       if (workflowStep){
         m_steps.push_back(*workflowStep);
       }else{
@@ -955,9 +947,9 @@ boost::optional<WorkflowJSON> WorkflowJSON::load(const openstudio::path& p)
   return result;
 }
 
-std::string WorkflowJSON::string(bool includeHash) const
+std::string WorkflowJSON::string(bool includeHash, bool compact) const
 {
-  return getImpl<detail::WorkflowJSON_Impl>()->string(includeHash);
+  return getImpl<detail::WorkflowJSON_Impl>()->string(includeHash, compact);
 }
 
 std::string WorkflowJSON::hash() const
@@ -975,9 +967,9 @@ bool WorkflowJSON::checkForUpdates()
   return getImpl<detail::WorkflowJSON_Impl>()->checkForUpdates();
 }
 
-bool WorkflowJSON::save() const
+bool WorkflowJSON::save(bool compact) const
 {
-  return getImpl<detail::WorkflowJSON_Impl>()->save();
+  return getImpl<detail::WorkflowJSON_Impl>()->save(compact);
 }
 
 bool WorkflowJSON::saveAs(const openstudio::path& p)
@@ -77,8 +77,8 @@ public:
   /** Attempt to load a WorkflowJSON from path */
   static boost::optional<WorkflowJSON> load(const openstudio::path& p);
 
-  /** Get the workflow as a string. */
-  std::string string(bool includeHash=true) const;
+  /** Get the workflow as a string. If compact is true the JSON is written without whitespace. */
+  std::string string(bool includeHash=true, bool compact=false) const;
 
   /** Get a stored hash of the workflow. */
   std::string hash() const;
@@ -89,8 +89,8 @@ public:
   /** Check for updates and return true if there are any, updates value of the stored hash. */
   bool checkForUpdates();
 
-  /** Saves this file to the current location. */
-  bool save() const;
+  /** Saves this file to the current location. If compact is true the JSON is written without whitespace. */
+  bool save(bool compact=false) const;
 
   /** Saves this file to a new location. Updates the OSW path. */
   bool saveAs(const openstudio::path& p);
@@ -62,7 +62,9 @@ namespace detail {
 
       WorkflowJSON clone() const;
 
-      std::string string(bool includeHash = true) const;
+      std::string string(bool includeHash = true, bool compact = false) const;
+
+      Json::Value toJSON(bool includeHash = true) const;
 
       std::string hash() const;
 
@@ -70,7 +72,7 @@ namespace detail {
 
       bool checkForUpdates();
 
-      bool save() const;
+      bool save(bool compact = false) const;
 
       bool saveAs(const openstudio::path& p);
 
@@ -29,6 +29,7 @@
 
 #include "WorkflowStep.hpp"
 #include "WorkflowStep_Impl.hpp"
+#include "WorkflowStepResult_Impl.hpp"
 
 #include "../core/Assert.hpp"
 
@@ -43,20 +44,82 @@ namespace detail{
   WorkflowStep_Impl::~WorkflowStep_Impl()
   {}
 
+  boost::optional<WorkflowStep> WorkflowStep_Impl::fromJSON(const Json::Value& value)
+  {
+    boost::optional<WorkflowStep> result;
+
+    if (value.isMember("measure_dir_name")){
+      Json::Value measureDirName = value["measure_dir_name"];
+
+      MeasureStep measureStep(measureDirName.asString());
+      result = measureStep;
+
+      if (value.isMember("name")){
+        Json::Value name = value["name"];
+        measureStep.setName(name.asString());
+      }
+
+      if (value.isMember("description")){
+        Json::Value description = value["description"];
+        measureStep.setDescription(description.asString());
+      }
+
+      if (value.isMember("modeler_description")){
+        Json::Value modelerDescription = value["modeler_description"];
+        measureStep.setModelerDescription(modelerDescription.asString());
+      }
+
+      Json::Value arguments = value["arguments"];
+      for (const auto& name : arguments.getMemberNames()){
+        Json::Value value = arguments[name];
+
+        if (value.isBool()){
+          measureStep.setArgument(name, value.asBool());
+        }else if (value.isIntegral()){
+          measureStep.setArgument(name, value.asInt());
+        }else if (value.isDouble()){
+          measureStep.setArgument(name, value.asDouble());
+        }else{
+          measureStep.setArgument(name, value.asString());
+        }
+      }
+    }
+
+    if (result && value.isMember("result") && value["result"].isObject()){
+      // step results are only converted to WorkflowStepResult when requested
+      result->getImpl<WorkflowStep_Impl>()->setResult(value["result"]);
+    }
+
+    return result;
+  }
+
   boost::optional<WorkflowStepResult> WorkflowStep_Impl::result() const
   {
+    if (m_resultJSON){
+      m_result = WorkflowStepResult_Impl::fromJSON(*m_resultJSON);
+      m_resultJSON.reset();
+    }
     return m_result;
   }
 
   void WorkflowStep_Impl::setResult(const WorkflowStepResult& result)
   {
     m_result = result;
+    m_resultJSON.reset();
+    onUpdate();
+  }
+
+  void WorkflowStep_Impl::setResult(const Json::Value& result)
+  {
+    m_result.reset();
+    m_resultJSON = result;
     onUpdate();
   }
 
   void WorkflowStep_Impl::resetResult()
   {
     m_result.reset();
+    m_resultJSON.reset();
     onUpdate();
   }
 
@@ -65,6 +128,16 @@ namespace detail{
     this->onChange.nano_emit();
   }
 
+  Json::Value WorkflowStep_Impl::resultJSON() const
+  {
+    if (m_resultJSON){
+      return *m_resultJSON;
+    }else if (m_result){
+      return m_result->getImpl<WorkflowStepResult_Impl>()->toJSON();
+    }
+    return Json::Value();
+  }
+
   MeasureStep_Impl::MeasureStep_Impl(const std::string& measureDirName)
     : m_measureDirName(measureDirName)
   {}
@@ -118,6 +191,12 @@ namespace detail{
   */
 
   std::string MeasureStep_Impl::string() const
+  {
+    Json::StyledWriter writer;
+    return writer.write(toJSON());
+  }
+
+  Json::Value MeasureStep_Impl::toJSON() const
   {
     Json::Value result;
     result["measure_dir_name"] = m_measureDirName;
@@ -152,18 +231,12 @@ namespace detail{
     }
     result["arguments"] = arguments;
 
-    boost::optional<WorkflowStepResult> workflowStepResult = this->result();
-    if (workflowStepResult){
-      Json::Reader reader;
-      Json::Value v;
-      bool parsingSuccessful = reader.parse(workflowStepResult->string(), v);
-      if (parsingSuccessful){
-        result["result"] = v;
-      }
+    Json::Value workflowStepResult = resultJSON();
+    if (!workflowStepResult.isNull()){
+      result["result"] = workflowStepResult;
     }
 
-    Json::StyledWriter writer;
-    return writer.write(result);
+    return result;
   }
 
 
@@ -297,63 +370,14 @@ WorkflowStep::~WorkflowStep()
 
 boost::optional<WorkflowStep> WorkflowStep::fromString(const std::string& s)
 {
-  boost::optional<WorkflowStep> result;
-
   Json::Reader reader;
   Json::Value value;
   bool parsingSuccessful = reader.parse(s, value);
   if (!parsingSuccessful){
-    return result;
-  }
-
-  if (value.isMember("measure_dir_name")){
-    Json::Value measureDirName = value["measure_dir_name"];
-
-    MeasureStep measureStep(measureDirName.asString());
-    result = measureStep;
-
-    if (value.isMember("name")){
-      Json::Value name = value["name"];
-      measureStep.setName(name.asString());
-    }
-
-    if (value.isMember("description")){
-      Json::Value description = value["description"];
-      measureStep.setDescription(description.asString());
-    }
-
-    if (value.isMember("modeler_description")){
-      Json::Value modelerDescription = value["modeler_description"];
-      measureStep.setModelerDescription(modelerDescription.asString());
-    }
-
-    Json::Value arguments = value["arguments"];
-    for (const auto& name : arguments.getMemberNames()){
-      Json::Value value = arguments[name];
-
-      if (value.isBool()){
-        measureStep.setArgument(name, value.asBool());
-      }else if (value.isIntegral()){
-        measureStep.setArgument(name, value.asInt());
-      }else if (value.isDouble()){
-        measureStep.setArgument(name, value.asDouble());
-      }else{
-        measureStep.setArgument(name, value.asString());
-      }
-    }
-  }
-
-  if (value.isMember("result")){
-    Json::StyledWriter writer;
-    Json::Value v = value["result"];
-    std::string s = writer.write(v);
-    boost::optional<WorkflowStepResult> workflowStepResult = WorkflowStepResult::fromString(s);
-    if (workflowStepResult){
-      result->setResult(*workflowStepResult);
-    }
+    return boost::none;
   }
 
-  return result;
+  return detail::WorkflowStep_Impl::fromJSON(value);
 }
 
 std::string WorkflowStep::string() const
@@ -43,7 +43,39 @@ namespace detail {
     : m_name(name), m_value(value)
   {}
 
+  boost::optional<WorkflowStepValue> WorkflowStepValue_Impl::fromJSON(const Json::Value& value)
+  {
+    boost::optional<WorkflowStepValue> result;
+
+    try{
+      std::string name = value["name"].asString();
+      Json::Value v = value["value"];
+      if (v.isString()){
+        result = WorkflowStepValue(name, v.asString());
+      } else if (v.isIntegral()){
+        result = WorkflowStepValue(name, v.asInt());
+      } else if (v.isDouble()){
+        result = WorkflowStepValue(name, v.asDouble());
+      } else if (v.isBool()){
+        result = WorkflowStepValue(name, v.asBool());
+      } else{
+        //error
+      }
+
+    } catch (const std::exception&){
+      return boost::none;
+    }
+
+    return result;
+  }
+
   std::string WorkflowStepValue_Impl::string() const
+  {
+    Json::StyledWriter writer;
+    return writer.write(toJSON());
+  }
+
+  Json::Value WorkflowStepValue_Impl::toJSON() const
   {
     Json::Value value(Json::objectValue);
     value["name"] = m_name;
@@ -66,10 +98,8 @@ namespace detail {
       value["value"] = m_value.valueAsBoolean();
     }
 
-    Json::StyledWriter writer;
-    std::string result = writer.write(value);
-
-    return result;  }
+    return value;
+  }
 
   std::string WorkflowStepValue_Impl::name() const
   {
@@ -147,7 +177,150 @@ namespace detail {
   WorkflowStepResult_Impl::WorkflowStepResult_Impl()
   {}
 
+  boost::optional<WorkflowStepResult> WorkflowStepResult_Impl::fromJSON(const Json::Value& value)
+  {
+    WorkflowStepResult result;
+
+    try{
+
+      if (value.isMember("started_at")){
+        boost::optional<DateTime> dateTime = DateTime::fromISO8601(value["started_at"].asString());
+        if (dateTime){
+          result.setStartedAt(*dateTime);
+        }
+      }
+
+      if (value.isMember("completed_at")){
+        boost::optional<DateTime> dateTime = DateTime::fromISO8601(value["completed_at"].asString());
+        if (dateTime){
+          result.setCompletedAt(*dateTime);
+        }
+      }
+
+      if (value.isMember("measure_type")){
+        Json::Value measureType = value["measure_type"];
+        try{
+          result.setMeasureType(MeasureType(measureType.asString()));
+        } catch (const std::exception&){
+          LOG(Error, measureType.asString() << " is not a valid MeasureType.")
+        }
+      }
+
+      if (value.isMember("measure_name")){
+        Json::Value measureName = value["measure_name"];
+        result.setMeasureName(measureName.asString());
+      }
+
+      if (value.isMember("measure_uid")){
+        Json::Value measureId = value["measure_uid"];
+        result.setMeasureId(measureId.asString());
+      }
+
+      if (value.isMember("measure_version_id")){
+        Json::Value versionId = value["measure_version_id"];
+        result.setMeasureVersionId(versionId.asString());
+      }
+
+      if (value.isMember("measure_version_modified")){
+        Json::Value versionModified = value["measure_version_modified"];
+        std::string str = versionModified.asString();
+        boost::optional<DateTime> dateTime = DateTime::fromISO8601(versionModified.asString());
+        if (dateTime){
+          result.setMeasureVersionModified(dateTime.get());
+        }
+      }
+
+      if (value.isMember("measure_xml_checksum")){
+        Json::Value checksum = value["measure_xml_checksum"];
+        result.setMeasureXmlChecksum(checksum.asString());
+      }
+
+      if (value.isMember("measure_class_name")){
+        Json::Value className = value["measure_class_name"];
+        result.setMeasureClassName(className.asString());
+      }
+
+      if (value.isMember("measure_display_name")){
+        Json::Value displayName = value["measure_display_name"];
+        result.setMeasureDisplayName(displayName.asString());
+      }
+
+      if (value.isMember("measure_taxonomy")){
+        Json::Value taxonomy = value["measure_taxonomy"];
+        result.setMeasureTaxonomy(taxonomy.asString());
+      }
+
+      if (value.isMember("step_result")){
+        StepResult stepResult(value["step_result"].asString());
+        result.setStepResult(stepResult);
+      }
+
+      if (value.isMember("step_initial_condition")){
+        result.setStepInitialCondition(value["step_initial_condition"].asString());
+      }
+
+      if (value.isMember("step_final_condition")){
+        result.setStepFinalCondition(value["step_final_condition"].asString());
+      }
+
+      Json::Value defaultArrayValue(Json::arrayValue);
+      Json::ArrayIndex n;
+
+      Json::Value errors = value.get("step_errors", defaultArrayValue);
+      n = errors.size();
+      for (Json::ArrayIndex i = 0; i < n; ++i){
+        result.addStepError(errors[i].asString());
+      }
+
+      Json::Value warnings = value.get("step_warnings", defaultArrayValue);
+      n = warnings.size();
+      for (Json::ArrayIndex i = 0; i < n; ++i){
+        result.addStepWarning(warnings[i].asString());
+      }
+
+      Json::Value info = value.get("step_info", defaultArrayValue);
+      n = info.size();
+      for (Json::ArrayIndex i = 0; i < n; ++i){
+        result.addStepInfo(info[i].asString());
+      }
+
+      Json::Value stepValues = value.get("step_values", defaultArrayValue);
+      n = stepValues.size();
+      for (Json::ArrayIndex i = 0; i < n; ++i){
+        boost::optional<WorkflowStepValue> workflowStepValue = WorkflowStepValue_Impl::fromJSON(stepValues[i]);
+        if (workflowStepValue){
+          result.addStepValue(*workflowStepValue);
+        }
+      }
+
+      Json::Value files = value.get("step_files", defaultArrayValue);
+      n = files.size();
+      for (Json::ArrayIndex i = 0; i < n; ++i){
+        result.addStepFile(toPath(files[i].asString()));
+      }
+
+      if (value.isMember("stdout")){
+        result.setStdOut(value["stdout"].asString());
+      }
+
+      if (value.isMember("stderr")){
+        result.setStdErr(value["stderr"].asString());
+      }
+
+    } catch (const std::exception&){
+      return boost::none;
+    }
+
+    return result;
+  }
+
   std::string WorkflowStepResult_Impl::string() const
+  {
+    Json::StyledWriter writer;
+    return writer.write(toJSON());
+  }
+
+  Json::Value WorkflowStepResult_Impl::toJSON() const
   {
     Json::Value value(Json::objectValue);
     bool complete = false;
@@ -239,14 +412,8 @@ namespace detail {
 
     if (complete || (stepValues().size() > 0)){
       Json::Value values(Json::arrayValue);
-      for (const auto& stepValue : stepValues()){
-
-        Json::Value v;
-        Json::Reader reader;
-        bool parsingSuccessful = reader.parse(stepValue.string(), v);
-        if (parsingSuccessful){
-          values.append(v);
-        }
+      for (const auto& stepValue : m_stepValues){
+        values.append(stepValue.getImpl<WorkflowStepValue_Impl>()->toJSON());
       }
       value["step_values"] = values;
     }
@@ -267,10 +434,7 @@ namespace detail {
       value["stderr"] = stdErr().get();
     }
 
-    Json::StyledWriter writer;
-    std::string result = writer.write(value);
-
-    return result;
+    return value;
   }
 
   boost::optional<DateTime> WorkflowStepResult_Impl::startedAt() const
@@ -779,29 +943,7 @@ boost::optional<WorkflowStepValue> WorkflowStepValue::fromString(const std::stri
     return boost::none;
   }
 
-  boost::optional<WorkflowStepValue> result;
-
-  try{
-    std::string name = value["name"].asString();
-    Json::Value v = value["value"];
-    if (v.isString()){
-      result = WorkflowStepValue(name, v.asString());
-    } else if (v.isIntegral()){
-      result = WorkflowStepValue(name, v.asInt());
-    } else if (v.isDouble()){
-      result = WorkflowStepValue(name, v.asDouble());
-    } else if (v.isBool()){
-      result = WorkflowStepValue(name, v.asBool());
-    } else{
-      //error
-    }
-
-  } catch (const std::exception&){
-    return boost::none;
-  }
-
-  return result;
-
+  return detail::WorkflowStepValue_Impl::fromJSON(value);
 }
 
 std::string WorkflowStepValue::string() const
@@ -902,141 +1044,7 @@ boost::optional<WorkflowStepResult> WorkflowStepResult::fromString(const std::st
     return boost::none;
   }
 
-  WorkflowStepResult result;
-
-  try{
-
-    if (value.isMember("started_at")){
-      boost::optional<DateTime> dateTime = DateTime::fromISO8601(value["started_at"].asString());
-      if (dateTime){
-        result.setStartedAt(*dateTime);
-      }
-    }
-
-    if (value.isMember("completed_at")){
-      boost::optional<DateTime> dateTime = DateTime::fromISO8601(value["completed_at"].asString());
-      if (dateTime){
-        result.setCompletedAt(*dateTime);
-      }
-    }
-
-    if (value.isMember("measure_type")){
-      Json::Value measureType = value["measure_type"];
-      try{
-        result.setMeasureType(MeasureType(measureType.asString()));
-      } catch (const std::exception&){
-        LOG(Error, measureType.asString() << " is not a valid MeasureType.")
-      }
-    }
-
-    if (value.isMember("measure_name")){
-      Json::Value measureName = value["measure_name"];
-      result.setMeasureName(measureName.asString());
-    }
-
-    if (value.isMember("measure_uid")){
-      Json::Value measureId = value["measure_uid"];
-      result.setMeasureId(measureId.asString());
-    }
-
-    if (value.isMember("measure_version_id")){
-      Json::Value versionId = value["measure_version_id"];
-      result.setMeasureVersionId(versionId.asString());
-    }
-
-    if (value.isMember("measure_version_modified")){
-      Json::Value versionModified = value["measure_version_modified"];
-      std::string str = versionModified.asString();
-      boost::optional<DateTime> dateTime = DateTime::fromISO8601(versionModified.asString());
-      if (dateTime){
-        result.setMeasureVersionModified(dateTime.get());
-      }
-    }
-
-    if (value.isMember("measure_xml_checksum")){
-      Json::Value checksum = value["measure_xml_checksum"];
-      result.setMeasureXmlChecksum(checksum.asString());
-    }
-
-    if (value.isMember("measure_class_name")){
-      Json::Value className = value["measure_class_name"];
-      result.setMeasureClassName(className.asString());
-    }
-
-    if (value.isMember("measure_display_name")){
-      Json::Value displayName = value["measure_display_name"];
-      result.setMeasureDisplayName(displayName.asString());
-    }
-
-    if (value.isMember("measure_taxonomy")){
-      Json::Value taxonomy = value["measure_taxonomy"];
-      result.setMeasureTaxonomy(taxonomy.asString());
-    }
-
-    if (value.isMember("step_result")){
-      StepResult stepResult(value["step_result"].asString());
-      result.setStepResult(stepResult);
-    }
-
-    if (value.isMember("step_initial_condition")){
-      result.setStepInitialCondition(value["step_initial_condition"].asString());
-    }
-
-    if (value.isMember("step_final_condition")){
-      result.setStepFinalCondition(value["step_final_condition"].asString());
-    }
-
-    Json::Value defaultArrayValue(Json::arrayValue);
-    Json::ArrayIndex n;
-
-    Json::Value errors = value.get("step_errors", defaultArrayValue);
-    n = errors.size();
-    for (Json::ArrayIndex i = 0; i < n; ++i){
-      result.addStepError(errors[i].asString());
-    }
-
-    Json::Value warnings = value.get("step_warnings", defaultArrayValue);
-    n = warnings.size();
-    for (Json::ArrayIndex i = 0; i < n; ++i){
-      result.addStepWarning(warnings[i].asString());
-    }
-
-    Json::Value info = value.get("step_info", defaultArrayValue);
-    n = info.size();
-    for (Json::ArrayIndex i = 0; i < n; ++i){
-      result.addStepInfo(info[i].asString());
-    }
-
-    Json::Value stepValues = value.get("step_values", defaultArrayValue);
-    n = stepValues.size();
-    for (Json::ArrayIndex i = 0; i < n; ++i){
-      Json::StyledWriter writer;
-      std::string s = writer.write(stepValues[i]);
-      boost::optional<WorkflowStepValue> workflowStepValue = WorkflowStepValue::fromString(s);
-      if (workflowStepValue){
-        result.addStepValue(*workflowStepValue);
-      }
-    }
-
-    Json::Value files = value.get("step_files", defaultArrayValue);
-    n = files.size();
-    for (Json::ArrayIndex i = 0; i < n; ++i){
-      result.addStepFile(toPath(files[i].asString()));
-    }
-
-    if (value.isMember("stdout")){
-      result.setStdOut(value["stdout"].asString());
-    }
-
-    if (value.isMember("stderr")){
-      result.setStdErr(value["stderr"].asString());
-    }
-
-  } catch (const std::exception&){
-    return boost::none;
-  }
-
-  return result;
+  return detail::WorkflowStepResult_Impl::fromJSON(value);
 }
 
 std::string WorkflowStepResult::string() const
@@ -42,6 +42,7 @@ namespace openstudio {
 namespace detail{
   class WorkflowStepValue_Impl;
   class WorkflowStepResult_Impl;
+  class WorkflowStep_Impl;
 }
 class DateTime;
 class Variant;
@@ -140,6 +141,7 @@ class UTILITIES_API WorkflowStepValue {
   }
 
   friend class detail::WorkflowStepValue_Impl;
+  friend class detail::WorkflowStepResult_Impl;
 
   /** Protected constructor from impl. */
   WorkflowStepValue(std::shared_ptr<detail::WorkflowStepValue_Impl> impl);
@@ -327,6 +329,7 @@ class UTILITIES_API WorkflowStepResult {
   }
 
   friend class detail::WorkflowStepResult_Impl;
+  friend class detail::WorkflowStep_Impl;
 
   /** Protected constructor from impl. */
   WorkflowStepResult(std::shared_ptr<detail::WorkflowStepResult_Impl> impl);
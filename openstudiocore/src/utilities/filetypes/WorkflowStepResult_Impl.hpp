@@ -39,6 +39,8 @@
 #include "../utilities/time/DateTime.hpp"
 #include "../utilities/bcl/BCLMeasure.hpp"
 
+#include <jsoncpp/json.h>
+
 namespace openstudio {
 namespace detail {
 
@@ -47,8 +49,12 @@ class UTILITIES_API WorkflowStepValue_Impl {
 
   WorkflowStepValue_Impl(const std::string& name, const Variant& value);
 
+  static boost::optional<WorkflowStepValue> fromJSON(const Json::Value& value);
+
   std::string string() const;
 
+  Json::Value toJSON() const;
+
   //@}
   /** @name Getters */
   //@{
@@ -100,8 +106,12 @@ class UTILITIES_API WorkflowStepResult_Impl {
 
   WorkflowStepResult_Impl();
 
+  static boost::optional<WorkflowStepResult> fromJSON(const Json::Value& value);
+
   std::string string() const;
 
+  Json::Value toJSON() const;
+
   boost::optional<DateTime> startedAt() const;
 
   boost::optional<DateTime> completedAt() const;
@@ -32,6 +32,7 @@
 
 #include "../UtilitiesAPI.hpp"
 
+#include "WorkflowStep.hpp"
 #include "WorkflowStepResult.hpp"
 
 #include "../core/Logger.hpp"
@@ -54,12 +55,19 @@ namespace detail {
 
     virtual ~WorkflowStep_Impl();
 
+    static boost::optional<WorkflowStep> fromJSON(const Json::Value& value);
+
     virtual std::string string() const = 0;
 
+    virtual Json::Value toJSON() const = 0;
+
     boost::optional<WorkflowStepResult> result() const;
 
     void setResult(const WorkflowStepResult& result);
 
+    /// keeps the raw JSON result, it is only converted to a WorkflowStepResult if result() is called
+    void setResult(const Json::Value& result);
+
     void resetResult();
 
     // Emitted on any change
@@ -69,12 +77,18 @@ namespace detail {
 
     void onUpdate();
 
+    // serialized result, or a null value if there is no result
+    Json::Value resultJSON() const;
+
   private:
 
     // configure logging
     REGISTER_LOGGER("openstudio.WorkflowStep");
 
-    boost::optional<WorkflowStepResult> m_result;
+    mutable boost::optional<WorkflowStepResult> m_result;
+
+    // unparsed result, cleared once m_result has been created from it
+    mutable boost::optional<Json::Value> m_resultJSON;
 
   };
 
@@ -86,6 +100,8 @@ namespace detail {
 
     virtual std::string string() const;
 
+    virtual Json::Value toJSON() const;
+
     std::string measureDirName() const;
     bool setMeasureDirName(const std::string& measureDirName);
 
@@ -43,6 +43,8 @@
 
 #include <resources.hxx>
 
+#include <chrono>
+
 using namespace openstudio;
 
 
@@ -1116,3 +1118,92 @@ TEST(Filetypes, RunOptions)
   EXPECT_EQ("my_ruby_file.rb", workflow2->runOptions()->customOutputAdapter()->customFileName());
   EXPECT_EQ("MyOutputAdapter", workflow2->runOptions()->customOutputAdapter()->className());
 }
+
+TEST(Filetypes, WorkflowJSON_Compact)
+{
+  WorkflowJSON workflow;
+
+  std::vector<WorkflowStep> steps;
+  steps.push_back(MeasureStep("Measure1"));
+  steps.push_back(MeasureStep("Measure2"));
+  EXPECT_TRUE(workflow.setWorkflowSteps(steps));
+
+  std::vector<WorkflowStep> workflowSteps = workflow.workflowSteps();
+  ASSERT_EQ(2u, workflowSteps.size());
+  workflowSteps[0].setResult(getWorkflowStepResult(workflowSteps[0], boost::none));
+  workflow.checkForUpdates();
+
+  std::string styled = workflow.string();
+  std::string compact = workflow.string(true, true);
+  EXPECT_LT(compact.size(), styled.size());
+  EXPECT_EQ(std::string::npos, compact.find("\n   "));
+
+  boost::optional<WorkflowJSON> workflow2 = WorkflowJSON::load(compact);
+  ASSERT_TRUE(workflow2);
+  EXPECT_EQ(styled, workflow2->string());
+  EXPECT_EQ(workflow.hash(), workflow2->computeHash());
+  EXPECT_FALSE(workflow2->checkForUpdates());
+
+  // results read from the file are only converted when requested
+  workflowSteps = workflow2->workflowSteps();
+  ASSERT_EQ(2u, workflowSteps.size());
+  checkWorkflowStepResult(workflowSteps[0], boost::none);
+  EXPECT_FALSE(workflowSteps[1].result());
+  EXPECT_EQ(styled, workflow2->string());
+}
+
+TEST(Filetypes, DISABLED_WorkflowJSON_Benchmark)
+{
+  const unsigned numSteps = 200;
+  path p = toPath("./WorkflowJSON_Benchmark.osw");
+
+  WorkflowJSON workflow;
+  std::vector<WorkflowStep> steps;
+  for (unsigned i = 0; i < numSteps; ++i){
+    MeasureStep step("Measure" + std::to_string(i));
+    step.setArgument("index", static_cast<int>(i));
+    step.setArgument("fraction", 0.5 * i);
+    steps.push_back(step);
+  }
+  EXPECT_TRUE(workflow.setWorkflowSteps(steps));
+  EXPECT_TRUE(workflow.saveAs(p));
+
+  // simulate a run, results are saved after each step
+  auto start = std::chrono::steady_clock::now();
+  std::vector<WorkflowStep> workflowSteps = workflow.workflowSteps();
+  ASSERT_EQ(numSteps, workflowSteps.size());
+  for (auto& step : workflowSteps){
+    WorkflowStepResult result = getWorkflowStepResult(step, boost::none);
+    for (unsigned j = 0; j < 20; ++j){
+      result.addStepValue(WorkflowStepValue("value_" + std::to_string(j), 1.5 * j));
+    }
+    step.setResult(result);
+    workflow.checkForUpdates();
+    EXPECT_TRUE(workflow.save());
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::cout << "Saving " << numSteps << " step results took "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+  start = std::chrono::steady_clock::now();
+  WorkflowJSON workflow2(p);
+  EXPECT_FALSE(workflow2.checkForUpdates());
+  std::string s = workflow2.string();
+  end = std::chrono::steady_clock::now();
+  std::cout << "Loading and writing " << numSteps << " steps took "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+  EXPECT_EQ(workflow.string(), s);
+
+  start = std::chrono::steady_clock::now();
+  std::string compact = workflow2.string(true, true);
+  end = std::chrono::steady_clock::now();
+  std::cout << "Compact writing " << numSteps << " steps took "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+  EXPECT_LT(compact.size(), s.size());
+
+  workflowSteps = workflow2.workflowSteps();
+  ASSERT_EQ(numSteps, workflowSteps.size());
+  ASSERT_TRUE(workflowSteps.back().result());
+  EXPECT_EQ(24u, workflowSteps.back().result()->stepValues().size());
+}
@@ -220,14 +220,37 @@ namespace openstudio{
     return m_objectReferenceMap;
   }
 
+  class FloorplanJS::IndexScope
+  {
+  public:
+    IndexScope(const FloorplanJS& floorplan)
+      : m_floorplan(floorplan)
+    {
+      ++m_floorplan.m_indexScopes;
+    }
+
+    ~IndexScope()
+    {
+      if (--m_floorplan.m_indexScopes == 0){
+        m_floorplan.m_indexes.clear();
+      }
+    }
+
+  private:
+    IndexScope(const IndexScope&);
+    IndexScope& operator=(const IndexScope&);
+
+    const FloorplanJS& m_floorplan;
+  };
+
   FloorplanJS::FloorplanJS()
-    : m_lastId(0)
+    : m_lastId(0), m_indexScopes(0)
   {
     m_value = Json::Value(Json::objectValue);
   }
 
   FloorplanJS::FloorplanJS(const std::string& s)
-    : m_lastId(0)
+    : m_lastId(0), m_indexScopes(0)
   {
     Json::Reader reader;
     bool parsingSuccessful = reader.parse(s, m_value);
@@ -257,7 +280,7 @@ namespace openstudio{
   }
 
   FloorplanJS::FloorplanJS(const Json::Value& value)
-    : m_value(value),  m_lastId(0)
+    : m_value(value),  m_lastId(0), m_indexScopes(0)
   {
     // DLM: should update value to current schema
     // Code in FloorspaceJS, importFloorplan.js, importState
@@ -514,13 +537,14 @@ namespace openstudio{
     std::vector<Point3d> doorCenterVertices;
     std::vector<std::string> doorDefinitionIds;
 
-    const Json::Value windowDefinitions = m_value.get("window_definitions", Json::arrayValue);
-    const Json::Value daylightingControlDefinitions = m_value.get("daylighting_control_definitions", Json::arrayValue);
-    const Json::Value doorDefinitions = m_value.get("door_definitions", Json::arrayValue);
+    // references into m_value, findById indexes these arrays by address
+    const Json::Value& windowDefinitions = m_value["window_definitions"];
+    const Json::Value& daylightingControlDefinitions = m_value["daylighting_control_definitions"];
+    const Json::Value& doorDefinitions = m_value["door_definitions"];
 
     // get all the windows on this story
     std::map<std::string, std::vector<Json::Value> > edgeIdToWindowsMap;
-    for (const auto& window : story.get("windows", Json::arrayValue)){
+    for (const auto& window : story["windows"]){
       assertKeyAndType(window, "edge_id", Json::stringValue);
 
       std::string edgeId = window.get("edge_id", "").asString();
@@ -532,7 +556,7 @@ namespace openstudio{
 
     // get all the doors on this story
     std::map<std::string, std::vector<Json::Value> > edgeIdToDoorsMap;
-    for (const auto& door : story.get("doors", Json::arrayValue)){
+    for (const auto& door : story["doors"]){
       assertKeyAndType(door, "edge_id", Json::stringValue);
 
       std::string edgeId = door.get("edge_id", "").asString();
@@ -547,8 +571,8 @@ namespace openstudio{
     if (face){
 
       // get the edges
-      Json::Value edgeIds = face->get("edge_ids", Json::arrayValue);
-      Json::Value edgeOrders = face->get("edge_order", Json::arrayValue);
+      const Json::Value& edgeIds = (*face)["edge_ids"];
+      const Json::Value& edgeOrders = (*face)["edge_order"];
       Json::ArrayIndex edgeN = edgeIds.size();
       OS_ASSERT(edgeN == edgeOrders.size());
 
@@ -560,7 +584,7 @@ namespace openstudio{
         // get the edge
         const Json::Value* edge = findById(edges, edgeId);
         if (edge){
-          Json::Value vertexIds = edge->get("vertex_ids", Json::arrayValue);
+          const Json::Value& vertexIds = (*edge)["vertex_ids"];
           OS_ASSERT(2u == vertexIds.size());
 
           // get the vertices
@@ -586,7 +610,7 @@ namespace openstudio{
 
           // check if there are windows on this edge
           if (edgeIdToWindowsMap.find(edgeId) != edgeIdToWindowsMap.end()){
-            std::vector<Json::Value> windows = edgeIdToWindowsMap[edgeId];
+            const std::vector<Json::Value>& windows = edgeIdToWindowsMap[edgeId];
             for (const auto& window : windows){
               assertKeyAndType(window, "window_definition_id", Json::stringValue);
               std::string windowDefinitionId = window.get("window_definition_id", "").asString();
@@ -614,7 +638,7 @@ namespace openstudio{
 
           // check if there are doors on this edge
           if (edgeIdToDoorsMap.find(edgeId) != edgeIdToDoorsMap.end()){
-            std::vector<Json::Value> doors = edgeIdToDoorsMap[edgeId];
+            const std::vector<Json::Value>& doors = edgeIdToDoorsMap[edgeId];
             for (const auto& door : doors){
               assertKeyAndType(door, "door_definition_id", Json::stringValue);
               std::string doorDefinitionId = door.get("door_definition_id", "").asString();
@@ -1061,6 +1085,9 @@ namespace openstudio{
     m_plenumThermalZoneNames.clear();
     m_boundingBox = BoundingBox();
 
+    // m_value is not modified while converting, so indexes stay valid
+    IndexScope indexScope(*this);
+
     std::vector<ThreeGeometry> geometries;
     std::vector<ThreeSceneChild> children;
     std::vector<std::string> buildingStoryNames;
@@ -1104,7 +1131,8 @@ namespace openstudio{
     bool anyPlenums = false;
 
     // loop over stories
-    Json::Value stories = m_value.get("stories", Json::arrayValue);
+    // arrays are read by reference, copying them would copy the whole floorplan
+    const Json::Value& stories = m_value["stories"];
     Json::ArrayIndex storyN = stories.size();
     for (Json::ArrayIndex storyIdx = 0; storyIdx < storyN; ++storyIdx){
 
@@ -1171,13 +1199,13 @@ namespace openstudio{
 
       // get the geometry
       assertKeyAndType(stories[storyIdx], "geometry", Json::objectValue);
-      Json::Value geometry = stories[storyIdx].get("geometry", Json::arrayValue);
-      Json::Value vertices = geometry.get("vertices", Json::arrayValue);
-      Json::Value edges = geometry.get("edges", Json::arrayValue);
-      Json::Value faces = geometry.get("faces", Json::arrayValue);
+      const Json::Value& geometry = stories[storyIdx]["geometry"];
+      const Json::Value& vertices = geometry["vertices"];
+      const Json::Value& edges = geometry["edges"];
+      const Json::Value& faces = geometry["faces"];
 
       // loop over spaces
-      Json::Value spaces = stories[storyIdx].get("spaces", Json::arrayValue);
+      const Json::Value& spaces = stories[storyIdx]["spaces"];
       Json::ArrayIndex spaceN = spaces.size();
       for (Json::ArrayIndex spaceIdx = 0; spaceIdx < spaceN; ++spaceIdx){
 
@@ -1265,7 +1293,7 @@ namespace openstudio{
       } // spaces
 
       // loop over shading
-      Json::Value shading = stories[storyIdx].get("shading", Json::arrayValue);
+      const Json::Value& shading = stories[storyIdx]["shading"];
       Json::ArrayIndex shadingN = shading.size();
       for (Json::ArrayIndex shadingdx = 0; shadingdx < shadingN; ++shadingdx){
 
@@ -1360,7 +1388,7 @@ namespace openstudio{
     } // stories
 
     // loop over building_units
-    Json::Value buildingUnits = m_value.get("building_units", Json::arrayValue);
+    const Json::Value& buildingUnits = m_value["building_units"];
     Json::ArrayIndex n = buildingUnits.size();
     for (Json::ArrayIndex i = 0; i < n; ++i){
       modelObjectMetadata.push_back(makeModelObjectMetadata("OS:BuildingUnit", buildingUnits[i]));
@@ -1368,7 +1396,7 @@ namespace openstudio{
     }
 
     // loop over thermal_zones
-    Json::Value thermalZones = m_value.get("thermal_zones", Json::arrayValue);
+    const Json::Value& thermalZones = m_value["thermal_zones"];
     n = thermalZones.size();
     for (Json::ArrayIndex i = 0; i < n; ++i){
       modelObjectMetadata.push_back(makeModelObjectMetadata("OS:ThermalZone", thermalZones[i]));
@@ -1383,7 +1411,7 @@ namespace openstudio{
     }
 
     // loop over space_types
-    Json::Value spaceTypes = m_value.get("space_types", Json::arrayValue);
+    const Json::Value& spaceTypes = m_value["space_types"];
     n = spaceTypes.size();
     for (Json::ArrayIndex i = 0; i < n; ++i){
       modelObjectMetadata.push_back(makeModelObjectMetadata("OS:SpaceType", spaceTypes[i]));
@@ -1396,7 +1424,7 @@ namespace openstudio{
     }
 
     // loop over construction_sets
-    Json::Value constructionSets = m_value.get("construction_sets", Json::arrayValue);
+    const Json::Value& constructionSets = m_value["construction_sets"];
     n = constructionSets.size();
     for (Json::ArrayIndex i = 0; i < n; ++i){
       modelObjectMetadata.push_back(makeModelObjectMetadata("OS:DefaultConstructionSet", constructionSets[i]));
@@ -1531,6 +1559,8 @@ namespace openstudio{
       storyHandleToSpaceObejctIds[*parentHandleString].push_back(object);
     }
 
+    // stories are not modified while their spaces are updated
+    IndexScope indexScope(*this);
     for (const auto& keyValue: storyHandleToSpaceObejctIds){
       // no need to check by name, assume stories have been updated
       Json::Value* story = findByHandleString(m_value, "stories", keyValue.first);
@@ -1621,39 +1651,103 @@ namespace openstudio{
     }
   }
 
-  Json::Value* FloorplanJS::findByHandleString(Json::Value& value, const std::string& key, const std::string& handleString)
+  boost::optional<Json::ArrayIndex> FloorplanJS::findIndex(const Json::Value& values, const std::string& key, const std::string& s) const
   {
-    if (handleString.empty()){
-      return nullptr;
+    if (s.empty() || !values.isArray()){
+      return boost::none;
     }
 
-    Json::Value& values = value[key];
     Json::ArrayIndex n = values.size();
-    for (Json::ArrayIndex i = 0; i < n; ++i){
-      if (getHandleString(values[i]) == handleString){
-        return &values[i];
+
+    if (m_indexScopes == 0){
+      for (Json::ArrayIndex i = 0; i < n; ++i){
+        if (values[i].get(key, "").asString() == s){
+          return i;
+        }
       }
+      return boost::none;
     }
 
-    return nullptr;
+    // index is built on first lookup, the first object with each value is kept
+    auto indexKey = std::make_pair(&values, key);
+    auto it = m_indexes.find(indexKey);
+
+    auto isValid = [&](Json::ArrayIndex i) {
+      // non-const operator[] would resize the array for an index past the end
+      return (i < n) && (values[i].get(key, "").asString() == s);
+    };
+
+    if (it != m_indexes.end()){
+      auto it2 = it->second.second.find(s);
+      if (it2 != it->second.second.end()){
+        if (isValid(it2->second)){
+          return it2->second;
+        }
+      } else if (it->second.first == n){
+        // a miss is trusted if the array size is unchanged, arrays modified in place are dropped with eraseIndexes
+        return boost::none;
+      }
+
+      // stale index, rebuild it
+      m_indexes.erase(it);
+      it = m_indexes.end();
+    }
+
+    std::map<std::string, Json::ArrayIndex> index;
+    for (Json::ArrayIndex i = 0; i < n; ++i){
+      index.insert(std::make_pair(values[i].get(key, "").asString(), i));
+    }
+    it = m_indexes.insert(std::make_pair(indexKey, std::make_pair(n, std::move(index)))).first;
+
+    auto it2 = it->second.second.find(s);
+    if (it2 != it->second.second.end()){
+      OS_ASSERT(isValid(it2->second));
+      return it2->second;
+    }
+
+    return boost::none;
   }
 
-  Json::Value* FloorplanJS::findByName(Json::Value& value, const std::string& key, const std::string& name, bool requireEmptyHandle)
+  void FloorplanJS::eraseIndexes(const Json::Value& values)
   {
-    if (name.empty()){
-      return nullptr;
+    auto it = m_indexes.lower_bound(std::make_pair(&values, std::string()));
+    while (it != m_indexes.end() && it->first.first == &values){
+      it = m_indexes.erase(it);
     }
+  }
 
+  Json::Value* FloorplanJS::findByHandleString(Json::Value& value, const std::string& key, const std::string& handleString)
+  {
     Json::Value& values = value[key];
-    Json::ArrayIndex n = values.size();
-    for (Json::ArrayIndex i = 0; i < n; ++i){
-      if (getName(values[i]) == name){
-        if (requireEmptyHandle && getHandleString(values[i]).empty()){
-          return &values[i];
-        } else{
+    boost::optional<Json::ArrayIndex> i = findIndex(values, "handle", handleString);
+    if (i){
+      return &values[*i];
+    }
+
+    return nullptr;
+  }
+
+  Json::Value* FloorplanJS::findByName(Json::Value& value, const std::string& key, const std::string& name, bool requireEmptyHandle)
+  {
+    Json::Value& values = value[key];
+
+    if (requireEmptyHandle){
+      // objects already linked to a handle are skipped, so the index of first names cannot be used
+      if (name.empty() || !values.isArray()){
+        return nullptr;
+      }
+      Json::ArrayIndex n = values.size();
+      for (Json::ArrayIndex i = 0; i < n; ++i){
+        if (getName(values[i]) == name && getHandleString(values[i]).empty()){
           return &values[i];
         }
       }
+      return nullptr;
+    }
+
+    boost::optional<Json::ArrayIndex> i = findIndex(values, "name", name);
+    if (i){
+      return &values[*i];
     }
 
     return nullptr;
@@ -1661,16 +1755,10 @@ namespace openstudio{
 
   Json::Value* FloorplanJS::findById(Json::Value& value, const std::string& key, const std::string& id)
   {
-    if (id.empty()){
-      return nullptr;
-    }
-
     Json::Value& values = value[key];
-    Json::ArrayIndex n = values.size();
-    for (Json::ArrayIndex i = 0; i < n; ++i){
-      if (getId(values[i]) == id){
-        return &values[i];
-      }
+    boost::optional<Json::ArrayIndex> i = findIndex(values, "id", id);
+    if (i){
+      return &values[*i];
     }
 
     return nullptr;
@@ -1678,15 +1766,9 @@ namespace openstudio{
 
   const Json::Value* FloorplanJS::findById(const Json::Value& values, const std::string& id) const
   {
-    if (id.empty()){
-      return nullptr;
-    }
-
-    Json::ArrayIndex n = values.size();
-    for (Json::ArrayIndex i = 0; i < n; ++i){
-      if (getId(values[i]) == id){
-        return &values[i];
-      }
+    boost::optional<Json::ArrayIndex> i = findIndex(values, "id", id);
+    if (i){
+      return &values[*i];
     }
 
     return nullptr;
@@ -1694,6 +1776,9 @@ namespace openstudio{
 
   void FloorplanJS::updateObjects(Json::Value& value, const std::string& key, const std::vector<FloorplanObject>& objects, bool removeMissingObjects)
   {
+    // references to other arrays are looked up for every object, the array being updated is dropped from the indexes whenever it changes
+    IndexScope indexScope(*this);
+
     // ensure key exists
     if (!value.isMember(key)){
       value[key] = Json::Value(Json::arrayValue);
@@ -1736,6 +1821,7 @@ namespace openstudio{
         Json::Value removed;
         values.removeIndex(i, &removed);
       }
+      eraseIndexes(values);
 
       if (!faceIdsToRemove.empty()){
         if (checkKeyAndType(value, "geometry", Json::objectValue)){
@@ -1744,41 +1830,77 @@ namespace openstudio{
       }
     }
 
+    // index objects by handle and name, the first object with each handle or name is found as in findByHandleString and findByName
+    Json::Value& values = value[key];
+    std::map<std::string, std::set<Json::ArrayIndex> > handleIndex;
+    std::map<std::string, std::set<Json::ArrayIndex> > nameIndex;
+    Json::ArrayIndex n = values.size();
+    for (Json::ArrayIndex i = 0; i < n; ++i){
+      handleIndex[getHandleString(values[i])].insert(i);
+      nameIndex[getName(values[i])].insert(i);
+    }
+
+    auto findFirst = [](const std::map<std::string, std::set<Json::ArrayIndex> >& index, const std::string& s) -> boost::optional<Json::ArrayIndex> {
+      if (!s.empty()){
+        auto it = index.find(s);
+        if (it != index.end() && !it->second.empty()){
+          return *(it->second.begin());
+        }
+      }
+      return boost::none;
+    };
+
     // now update names and data
     for (const auto& object : objects){
 
-      Json::Value* v = findByHandleString(value, key, object.handleString());
-      if (v){
+      boost::optional<Json::ArrayIndex> i = findFirst(handleIndex, object.handleString());
+      std::string oldHandle;
+      std::string oldName;
+      if (i){
+        oldHandle = getHandleString(values[*i]);
+        oldName = getName(values[*i]);
+
         // ensure name is the same
-        (*v)["name"] = object.name();
+        values[*i]["name"] = object.name();
       } else {
         // find object by name only if handle is empty
-        v = findByName(value, key, object.name(), true);
+        i = findFirst(nameIndex, object.name());
+
+        if (i){
+          oldHandle = getHandleString(values[*i]);
+          oldName = getName(values[*i]);
 
-        if (v){
           // set handle
-          (*v)["handle"] = object.handleString();
+          values[*i]["handle"] = object.handleString();
         } else{
           // create new object
           Json::Value newObject(Json::objectValue);
           newObject["id"] = getNextId();
           newObject["name"] = object.name();
           newObject["handle"] = object.handleString();
-          v = &(value[key].append(newObject));
+          values.append(newObject);
+          i = values.size() - 1;
         }
       }
 
-      if (v){
-        // update properties
-        Json::Value data = object.data();
-        for (const auto& key : data.getMemberNames()){
-          (*v)[key] = data[key];
-        }
+      Json::Value& v = values[*i];
 
-        // update references
-        for (const auto& p : object.objectReferenceMap()){
-          updateObjectReference(*v, p.first, p.second, removeMissingObjects);
-        }
+      // update properties
+      Json::Value data = object.data();
+      for (const auto& key : data.getMemberNames()){
+        v[key] = data[key];
+      }
+
+      // keep the indexes in sync with the updated object
+      handleIndex[oldHandle].erase(*i);
+      handleIndex[getHandleString(v)].insert(*i);
+      nameIndex[oldName].erase(*i);
+      nameIndex[getName(v)].insert(*i);
+      eraseIndexes(values);
+
+      // update references
+      for (const auto& p : object.objectReferenceMap()){
+        updateObjectReference(v, p.first, p.second, removeMissingObjects);
       }
     }
   }
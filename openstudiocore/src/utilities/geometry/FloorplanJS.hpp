@@ -43,6 +43,7 @@
 
 #include <vector>
 #include <set>
+#include <map>
 #include <boost/optional.hpp>
 
 namespace openstudio{
@@ -197,6 +198,15 @@ namespace openstudio{
     // recursively traverses through value and finds the largest id
     void setLastId(const Json::Value& value);
 
+    // index of the first object in values with s as the value of key, uses a cached index of the array while an IndexScope is alive
+    boost::optional<Json::ArrayIndex> findIndex(const Json::Value& values, const std::string& key, const std::string& s) const;
+
+    // drops cached indexes of values, must be called after objects in values are modified
+    void eraseIndexes(const Json::Value& values);
+
+    // enables cached indexes in findIndex for the duration of a method that makes many lookups, indexes are dropped when the last scope ends
+    class IndexScope;
+
     Json::Value* findByHandleString(Json::Value& value, const std::string& key, const std::string& handleString);
     Json::Value* findByName(Json::Value& value, const std::string& key, const std::string& name, bool requireEmptyHandle);
     Json::Value* findById(Json::Value& value, const std::string& key, const std::string& id);
@@ -215,6 +225,10 @@ namespace openstudio{
     unsigned m_lastId;
     mutable std::set<std::string> m_plenumThermalZoneNames;
     mutable BoundingBox m_boundingBox;
+
+    // indexes of json arrays by address and key along with the array size when built, only kept while an IndexScope is alive
+    mutable std::map<std::pair<const Json::Value*, std::string>, std::pair<Json::ArrayIndex, std::map<std::string, Json::ArrayIndex> > > m_indexes;
+    mutable unsigned m_indexScopes;
   };
 
   /// convienence method, converts a FloorplanJS JSON string to a ThreeJS JSON string
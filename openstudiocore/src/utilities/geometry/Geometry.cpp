@@ -31,15 +31,21 @@
 #include "Intersection.hpp"
 #include "Transformation.hpp"
 #include "Point3d.hpp"
+#include "PointWelder.hpp"
 #include "Vector3d.hpp"
 
 #include "../core/Assert.hpp"
 
 #include <boost/math/constants/constants.hpp>
 
+#include <boost/functional/hash.hpp>
+
 #include <polypartition/polypartition.h>
 
+#include <cmath>
 #include <list>
+#include <mutex>
+#include <unordered_map>
 
 namespace openstudio{
   /// convert degrees to radians
@@ -463,139 +469,323 @@ namespace openstudio{
     return point3d;
   }
 
-  std::vector<std::vector<Point3d> > computeTriangulation(const Point3dVector& vertices, const std::vector<std::vector<Point3d> >& holes, double tol)
-  {
-    std::vector<std::vector<Point3d> > result;
+  namespace {
 
-    // check input
-    if (vertices.size () < 3){
-      return result;
-    }
+    // above this many points the O(n log n) monotone partition is tried before ear clipping
+    const size_t monotoneTriangulationPoints = 32;
 
-    boost::optional<Vector3d> normal = getOutwardNormal(vertices);
-    if (!normal || normal->z() > -0.999){
-      return result;
-    }
+    // cached triangulations, cleared when full
+    const size_t maxTriangulationCacheSize = 10000;
 
-    for (const auto& hole : holes){
-      normal = getOutwardNormal(hole);
-      if (!normal || normal->z() > -0.999){
-        return result;
+    struct TriangulationCacheEntry
+    {
+      std::vector<Point3d> vertices;
+      std::vector<std::vector<Point3d> > holes;
+      double tol;
+      std::vector<std::vector<Point3d> > triangulation;
+    };
+
+    std::mutex triangulationCacheMutex;
+    std::unordered_multimap<size_t, TriangulationCacheEntry> triangulationCache;
+
+    bool exactlyEqual(const std::vector<Point3d>& points1, const std::vector<Point3d>& points2)
+    {
+      if (points1.size() != points2.size()){
+        return false;
       }
+      for (size_t i = 0; i < points1.size(); ++i){
+        if (points1[i].x() != points2[i].x() || points1[i].y() != points2[i].y() || points1[i].z() != points2[i].z()){
+          return false;
+        }
+      }
+      return true;
     }
 
-    std::vector<Point3d> allPoints;
+    size_t triangulationHash(const std::vector<Point3d>& vertices, const std::vector<std::vector<Point3d> >& holes, double tol)
+    {
+      size_t result = 0;
+      boost::hash_combine(result, tol);
+      boost::hash_combine(result, vertices.size());
+      for (const Point3d& point : vertices){
+        boost::hash_combine(result, point.x());
+        boost::hash_combine(result, point.y());
+        boost::hash_combine(result, point.z());
+      }
+      for (const std::vector<Point3d>& hole : holes){
+        boost::hash_combine(result, hole.size());
+        for (const Point3d& point : hole){
+          boost::hash_combine(result, point.x());
+          boost::hash_combine(result, point.y());
+          boost::hash_combine(result, point.z());
+        }
+      }
+      return result;
+    }
 
-    // PolyPartition does not support holes which intersect the polygon or share an edge
-    // if any hole is not fully contained we will use boost to remove all the holes
-    bool polyPartitionHoles = true;
-    for (const std::vector<Point3d>& hole : holes){
-      if (!within(hole, vertices, tol)){
-        // PolyPartition can't handle this
-        polyPartitionHoles = false;
-        break;
+    bool findCachedTriangulation(size_t hash, const std::vector<Point3d>& vertices, const std::vector<std::vector<Point3d> >& holes, double tol, std::vector<std::vector<Point3d> >& result)
+    {
+      std::lock_guard<std::mutex> lock(triangulationCacheMutex);
+      auto range = triangulationCache.equal_range(hash);
+      for (auto it = range.first; it != range.second; ++it){
+        const TriangulationCacheEntry& entry = it->second;
+        if (entry.tol != tol || entry.holes.size() != holes.size() || !exactlyEqual(entry.vertices, vertices)){
+          continue;
+        }
+        bool holesEqual = true;
+        for (size_t i = 0; i < holes.size(); ++i){
+          if (!exactlyEqual(entry.holes[i], holes[i])){
+            holesEqual = false;
+            break;
+          }
+        }
+        if (holesEqual){
+          result = entry.triangulation;
+          return true;
+        }
       }
+      return false;
     }
 
-    if (!polyPartitionHoles){
-      // use boost to do all the intersections
-      std::vector<std::vector<Point3d> > allFaces = subtract(vertices, holes, tol);
-      std::vector<std::vector<Point3d> > noHoles;
-      for (const std::vector<Point3d>& face : allFaces){
-        std::vector<std::vector<Point3d> > temp = computeTriangulation(face, noHoles);
-        result.insert(result.end(), temp.begin(), temp.end());
+    void cacheTriangulation(size_t hash, const std::vector<Point3d>& vertices, const std::vector<std::vector<Point3d> >& holes, double tol, const std::vector<std::vector<Point3d> >& triangulation)
+    {
+      std::lock_guard<std::mutex> lock(triangulationCacheMutex);
+      if (triangulationCache.size() >= maxTriangulationCacheSize){
+        triangulationCache.clear();
       }
-      return result;
+      TriangulationCacheEntry entry;
+      entry.vertices = vertices;
+      entry.holes = holes;
+      entry.tol = tol;
+      entry.triangulation = triangulation;
+      triangulationCache.insert(std::make_pair(hash, entry));
     }
 
-    // convert input to vector of TPPLPoly
-    std::list<TPPLPoly> polys;
+    // splits a strictly convex, clockwise polygon on the z = 0 plane into a fan of triangles
+    // returns false without touching result if the polygon does not qualify
+    bool computeConvexTriangulation(const std::vector<Point3d>& vertices, double tol, std::vector<std::vector<Point3d> >& result)
+    {
+      size_t n = vertices.size();
+      double totalTurn = 0;
+      for (size_t i = 0; i < n; ++i){
+        const Point3d& previous = vertices[(i + n - 1) % n];
+        const Point3d& current = vertices[i];
+        const Point3d& next = vertices[(i + 1) % n];
+
+        if (std::abs(current.z()) > tol){
+          return false;
+        }
+
+        double ax = current.x() - previous.x();
+        double ay = current.y() - previous.y();
+        double bx = next.x() - current.x();
+        double by = next.y() - current.y();
+        if (ax*ax + ay*ay < tol*tol || bx*bx + by*by < tol*tol){
+          return false;
+        }
 
-    TPPLPoly outerPoly; // must be counter-clockwise, input vertices are clockwise
-    outerPoly.Init(vertices.size());
-    outerPoly.SetHole(false);
-    size_t n = vertices.size();
-    for(size_t i = 0; i < n; ++i){
+        // every corner must turn clockwise
+        double cross = ax*by - ay*bx;
+        if (cross > -tol*tol){
+          return false;
+        }
+        totalTurn += std::atan2(cross, ax*bx + ay*by);
+      }
 
-      // should all have zero z coordinate now
-      double z = vertices[n-i-1].z();
-      if (abs(z) > tol){
-        LOG_FREE(Error, "utilities.geometry.computeTriangulation", "All points must be on z = 0 plane for triangulation methods");
-        return result;
+      // a single clockwise revolution, rules out self intersecting stars
+      if (std::abs(totalTurn + 2.0*boost::math::constants::pi<double>()) > 0.001){
+        return false;
       }
 
-      Point3d point = getCombinedPoint(vertices[n-i-1], allPoints, tol);
-      outerPoly[i].x = point.x();
-      outerPoly[i].y = point.y();
+      result.reserve(n - 2);
+      for (size_t i = 1; i + 1 < n; ++i){
+        std::vector<Point3d> triangle;
+        triangle.reserve(3);
+        triangle.push_back(Point3d(vertices[0].x(), vertices[0].y(), 0));
+        triangle.push_back(Point3d(vertices[i].x(), vertices[i].y(), 0));
+        triangle.push_back(Point3d(vertices[i + 1].x(), vertices[i + 1].y(), 0));
+        result.push_back(triangle);
+      }
+      return true;
     }
-    outerPoly.SetOrientation(TPPL_CCW);
-    polys.push_back(outerPoly);
 
+    std::vector<std::vector<Point3d> > computePolyPartitionTriangulation(const Point3dVector& vertices, const std::vector<std::vector<Point3d> >& holes, double tol)
+    {
+      std::vector<std::vector<Point3d> > result;
 
-    for (const std::vector<Point3d>& holeVertices : holes){
+      PointWelder allPoints(tol);
 
-      if (holeVertices.size () < 3){
-        LOG_FREE(Error, "utilities.geometry.computeTriangulation", "Hole has fewer than 3 points, ignoring");
-        continue;
+      // PolyPartition does not support holes which intersect the polygon or share an edge
+      // if any hole is not fully contained we will use boost to remove all the holes
+      bool polyPartitionHoles = true;
+      for (const std::vector<Point3d>& hole : holes){
+        if (!within(hole, vertices, tol)){
+          // PolyPartition can't handle this
+          polyPartitionHoles = false;
+          break;
+        }
+      }
+
+      if (!polyPartitionHoles){
+        // use boost to do all the intersections
+        std::vector<std::vector<Point3d> > allFaces = subtract(vertices, holes, tol);
+        std::vector<std::vector<Point3d> > noHoles;
+        for (const std::vector<Point3d>& face : allFaces){
+          std::vector<std::vector<Point3d> > temp = computeTriangulation(face, noHoles);
+          result.insert(result.end(), temp.begin(), temp.end());
+        }
+        return result;
       }
 
-      TPPLPoly innerPoly; // must be clockwise, input vertices are clockwise
-      innerPoly.Init(holeVertices.size());
-      innerPoly.SetHole(true);
-      //std::cout << "inner :";
-      for(unsigned i = 0; i < holeVertices.size(); ++i){
+      // convert input to vector of TPPLPoly
+      std::list<TPPLPoly> polys;
+
+      TPPLPoly outerPoly; // must be counter-clockwise, input vertices are clockwise
+      outerPoly.Init(vertices.size());
+      outerPoly.SetHole(false);
+      size_t n = vertices.size();
+      for(size_t i = 0; i < n; ++i){
 
         // should all have zero z coordinate now
-        double z = holeVertices[i].z();
+        double z = vertices[n-i-1].z();
         if (abs(z) > tol){
           LOG_FREE(Error, "utilities.geometry.computeTriangulation", "All points must be on z = 0 plane for triangulation methods");
           return result;
         }
 
-        Point3d point = getCombinedPoint(holeVertices[i], allPoints, tol);
-        innerPoly[i].x = point.x();
-        innerPoly[i].y = point.y();
+        Point3d point = allPoints.weld(vertices[n-i-1]);
+        outerPoly[i].x = point.x();
+        outerPoly[i].y = point.y();
       }
-      innerPoly.SetOrientation(TPPL_CW);
-      polys.push_back(innerPoly);
+      outerPoly.SetOrientation(TPPL_CCW);
+      polys.push_back(outerPoly);
+
+
+      for (const std::vector<Point3d>& holeVertices : holes){
+
+        if (holeVertices.size () < 3){
+          LOG_FREE(Error, "utilities.geometry.computeTriangulation", "Hole has fewer than 3 points, ignoring");
+          continue;
+        }
+
+        TPPLPoly innerPoly; // must be clockwise, input vertices are clockwise
+        innerPoly.Init(holeVertices.size());
+        innerPoly.SetHole(true);
+        //std::cout << "inner :";
+        for(unsigned i = 0; i < holeVertices.size(); ++i){
+
+          // should all have zero z coordinate now
+          double z = holeVertices[i].z();
+          if (abs(z) > tol){
+            LOG_FREE(Error, "utilities.geometry.computeTriangulation", "All points must be on z = 0 plane for triangulation methods");
+            return result;
+          }
+
+          Point3d point = allPoints.weld(holeVertices[i]);
+          innerPoly[i].x = point.x();
+          innerPoly[i].y = point.y();
+        }
+        innerPoly.SetOrientation(TPPL_CW);
+        polys.push_back(innerPoly);
+      }
+
+      // do partitioning, ear clipping is O(n^2) so large polygons try the O(n log n) monotone partition first
+      size_t numPoints = 0;
+      for (TPPLPoly& poly : polys){
+        numPoints += poly.GetNumPoints();
+      }
+
+      TPPLPartition pp;
+      std::list<TPPLPoly> resultPolys;
+      int test = 0;
+      if (numPoints > monotoneTriangulationPoints){
+        test = pp.Triangulate_MONO(&polys, &resultPolys);
+        if (test == 0){
+          resultPolys.clear();
+        }
+      }
+      if (test == 0){
+        test = pp.Triangulate_EC(&polys, &resultPolys);
+      }
+      if (test == 0){
+        resultPolys.clear();
+        test = pp.Triangulate_MONO(&polys, &resultPolys);
+      }
+      if (test == 0){
+        //std::stringstream ss;
+        //ss << "Vertices: " << vertices << std::endl;
+        //for (const auto& hole : holes){ ss << "Hole:" << hole << std::endl; }
+        //std::string testStr = ss.str();
+        LOG_FREE(Error, "utilities.geometry.computeTriangulation", "Failed to partition polygon");
+        return result;
+      }
+
+      // convert back to vertices
+      std::list<TPPLPoly>::iterator it, itend;
+      //std::cout << "Start" << std::endl;
+      for(it = resultPolys.begin(), itend = resultPolys.end(); it != itend; ++it){
+
+        it->SetOrientation(TPPL_CW);
+
+        std::vector<Point3d> triangle;
+        for (long i = 0; i < it->GetNumPoints(); ++i){
+          TPPLPoint point = it->GetPoint(i);
+          triangle.push_back(Point3d(point.x, point.y, 0));
+        }
+        //std::cout << triangle << std::endl;
+        result.push_back(triangle);
+      }
+      //std::cout << "End" << std::endl;
+
+      return result;
     }
 
-    // do partitioning
-    TPPLPartition pp;
-    std::list<TPPLPoly> resultPolys;
-    int test = pp.Triangulate_EC(&polys,&resultPolys);
-    if (test == 0){
-      test = pp.Triangulate_MONO(&polys, &resultPolys);
+  }
+
+  std::vector<std::vector<Point3d> > computeTriangulation(const Point3dVector& vertices, const std::vector<std::vector<Point3d> >& holes, double tol)
+  {
+    std::vector<std::vector<Point3d> > result;
+
+    // check input
+    if (vertices.size () < 3){
+      return result;
     }
-    if (test == 0){
-      //std::stringstream ss;
-      //ss << "Vertices: " << vertices << std::endl;
-      //for (const auto& hole : holes){ ss << "Hole:" << hole << std::endl; }
-      //std::string testStr = ss.str();
-      LOG_FREE(Error, "utilities.geometry.computeTriangulation", "Failed to partition polygon");
+
+    boost::optional<Vector3d> normal = getOutwardNormal(vertices);
+    if (!normal || normal->z() > -0.999){
       return result;
     }
 
-    // convert back to vertices
-    std::list<TPPLPoly>::iterator it, itend;
-    //std::cout << "Start" << std::endl;
-    for(it = resultPolys.begin(), itend = resultPolys.end(); it != itend; ++it){
+    for (const auto& hole : holes){
+      normal = getOutwardNormal(hole);
+      if (!normal || normal->z() > -0.999){
+        return result;
+      }
+    }
+
+    // most surfaces are convex without sub surfaces
+    if (holes.empty() && computeConvexTriangulation(vertices, tol, result)){
+      return result;
+    }
 
-      it->SetOrientation(TPPL_CW);
+    size_t hash = triangulationHash(vertices, holes, tol);
+    if (findCachedTriangulation(hash, vertices, holes, tol, result)){
+      return result;
+    }
 
-      std::vector<Point3d> triangle;
-      for (long i = 0; i < it->GetNumPoints(); ++i){
-        TPPLPoint point = it->GetPoint(i);
-        triangle.push_back(Point3d(point.x, point.y, 0));
-      }
-      //std::cout << triangle << std::endl;
-      result.push_back(triangle);
+    result = computePolyPartitionTriangulation(vertices, holes, tol);
+    if (!result.empty()){
+      cacheTriangulation(hash, vertices, holes, tol, result);
     }
-    //std::cout << "End" << std::endl;
 
     return result;
   }
 
+  void clearTriangulationCache()
+  {
+    std::lock_guard<std::mutex> lock(triangulationCacheMutex);
+    triangulationCache.clear();
+  }
+
   std::vector<Point3d> moveVerticesTowardsPoint(const Point3dVector& vertices, const Point3d& point, double distance)
   {
     Point3dVector result;
@@ -87,13 +87,17 @@ namespace openstudio{
   UTILITIES_API bool circularEqual(const std::vector<Point3d>& points1, const std::vector<Point3d>& points2, double tol = 0.001);
 
   /// if point3d is within tol of any existing points then returns existing point
-  /// otherwise adds point3d to allPoints and returns point3d
+  /// otherwise adds point3d to allPoints and returns point3d, see PointWelder for merging many points
   UTILITIES_API Point3d getCombinedPoint(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol = 0.001);
 
   /// compute triangulation of vertices, holes are removed in the triangulation
   /// requires that vertices and holes are in clockwise order on the z = 0 plane (i.e. in face coordinates but reversed)
+  /// convex polygons without holes are split into a fan directly, other successful results are cached by input
   UTILITIES_API std::vector<std::vector<Point3d> > computeTriangulation(const std::vector<Point3d>& vertices, const std::vector<std::vector<Point3d> >& holes, double tol = 0.001);
 
+  /// clear the results cached by computeTriangulation
+  UTILITIES_API void clearTriangulationCache();
+
   /// move all vertices towards point by distance, pass negative distance to move away from point
   /// no guarantee that resulting polygon will be valid
   UTILITIES_API std::vector<Point3d> moveVerticesTowardsPoint(const std::vector<Point3d>& vertices, const Point3d& point, double distance);
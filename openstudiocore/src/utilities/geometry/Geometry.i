@@ -12,6 +12,7 @@
   #include <utilities/geometry/Geometry.hpp>
   #include <utilities/geometry/Transformation.hpp>
   #include <utilities/geometry/BoundingBox.hpp>
+  #include <utilities/geometry/PointWelder.hpp>
   #include <utilities/geometry/Intersection.hpp>
   #include <utilities/geometry/ThreeJS.hpp>
   #include <utilities/geometry/FloorplanJS.hpp>
@@ -77,6 +78,7 @@
 %include <utilities/geometry/Geometry.hpp>
 %include <utilities/geometry/Transformation.hpp>
 %include <utilities/geometry/BoundingBox.hpp>
+%include <utilities/geometry/PointWelder.hpp>
 %include <utilities/geometry/Intersection.hpp>
 %include <utilities/geometry/ThreeJS.hpp>
 %include <utilities/geometry/FloorplanJS.hpp>
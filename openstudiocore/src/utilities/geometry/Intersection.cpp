@@ -30,6 +30,7 @@
 #include "Geometry.hpp"
 #include "Vector3d.hpp"
 #include "Intersection.hpp"
+#include "PointWelder.hpp"
 #include "../data/Matrix.hpp"
 #include "../core/Assert.hpp"
 #include "../core/Logger.hpp"
@@ -40,6 +41,7 @@
 #include <boost/geometry/geometries/polygon.hpp>
 #include <boost/geometry/geometries/ring.hpp>
 #include <boost/geometry/multi/geometries/multi_polygon.hpp>
+#include <boost/geometry/multi/multi.hpp>
 #include <boost/geometry/geometries/adapted/boost_tuple.hpp>
 #include <boost/geometry/strategies/cartesian/point_in_poly_franklin.hpp>
 #include <boost/geometry/strategies/cartesian/point_in_poly_crossings_multiply.hpp>
@@ -53,7 +55,10 @@ typedef boost::geometry::model::multi_polygon<BoostPolygon> BoostMultiPolygon;
 
 #include <polypartition/polypartition.h>
 
+#include <algorithm>
+#include <limits>
 #include <list>
+#include <numeric>
 
 // remove_spikes
 // adapted from https://github.com/boostorg/geometry/commits/develop/include/boost/geometry/algorithms/remove_spikes.hpp eb3260708eb241d8da337f4be73b41d69d33cd09
@@ -422,7 +427,7 @@ namespace openstudio{
   }
 
   // convert a Point3d to a BoostPoint
-  boost::tuple<double, double> boostPointFromPoint3d(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol)
+  boost::tuple<double, double> boostPointFromPoint3d(const Point3d& point3d, PointWelder& allPoints, double tol)
   {
     OS_ASSERT(abs(point3d.z()) <= tol);
 
@@ -430,13 +435,13 @@ namespace openstudio{
     //return boost::make_tuple(point3d.x(), point3d.y());
 
     // detailed method, try to combine points within tolerance
-    Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+    Point3d resultPoint = allPoints.weld(point3d);
 
     return boost::make_tuple(resultPoint.x(), resultPoint.y());
   }
 
   // convert vertices to a boost polygon, all vertices must lie on z = 0 plane
-  boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d>& vertices, std::vector<Point3d>& allPoints, double tol)
+  boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d>& vertices, PointWelder& allPoints, double tol)
   {
     if (vertices.size () < 3){
       return boost::none;
@@ -470,7 +475,7 @@ namespace openstudio{
     return polygon;
   }
 
-  boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std::vector<Point3d>& polygon, std::vector<Point3d>& allPoints, double tol)
+  boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std::vector<Point3d>& polygon, PointWelder& allPoints, double tol)
   {
     boost::optional<BoostPolygon> result = boostPolygonFromVertices(polygon, allPoints, tol);
     if (!result){
@@ -487,7 +492,7 @@ namespace openstudio{
   }
 
   // convert vertices to a boost ring, all vertices must lie on z = 0 plane
-  boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& vertices, std::vector<Point3d>& allPoints, double tol)
+  boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& vertices, PointWelder& allPoints, double tol)
   {
     if (vertices.size () < 3){
       return boost::none;
@@ -521,7 +526,7 @@ namespace openstudio{
     return ring;
   }
 
-  boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vector<Point3d>& polygon, std::vector<Point3d>& allPoints, double tol)
+  boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vector<Point3d>& polygon, PointWelder& allPoints, double tol)
   {
     boost::optional<BoostRing> result = boostRingFromVertices(polygon, allPoints, tol);
     if (!result){
@@ -538,7 +543,7 @@ namespace openstudio{
   }
 
   // convert a boost polygon to vertices
-  std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, std::vector<Point3d>& allPoints, double tol)
+  std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, PointWelder& allPoints, double tol)
   {
     std::vector<Point3d> result;
 
@@ -552,7 +557,7 @@ namespace openstudio{
       Point3d point3d(outer[i].x(), outer[i].y(), 0.0);
 
       // try to combine points within tolerance
-      Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+      Point3d resultPoint = allPoints.weld(point3d);
 
       // don't keep repeated vertices
       if ((i > 0) && (result.back() == resultPoint)){
@@ -580,7 +585,7 @@ namespace openstudio{
   }
 
   // convert a boost ring to vertices
-  std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, std::vector<Point3d>& allPoints, double tol)
+  std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, PointWelder& allPoints, double tol)
   {
     std::vector<Point3d> result;
 
@@ -589,7 +594,7 @@ namespace openstudio{
       Point3d point3d(ring[i].x(), ring[i].y(), 0.0);
 
       // try to combine points within tolerance
-      Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+      Point3d resultPoint = allPoints.weld(point3d);
 
       // don't keep repeated vertices
       if ((i > 0) && (result.back() == resultPoint)){
@@ -660,7 +665,7 @@ namespace openstudio{
   std::vector<Point3d> removeSpikes(const std::vector<Point3d>& polygon, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointWelder allPoints(tol);
 
     boost::optional<BoostPolygon> boostPolygon = boostPolygonFromVertices(polygon, allPoints, tol);
     if (!boostPolygon){
@@ -677,7 +682,7 @@ namespace openstudio{
   bool pointInPolygon(const Point3d& point, const std::vector<Point3d>& polygon, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointWelder allPoints(tol);
 
     boost::optional<BoostRing> boostPolygon = nonIntersectingBoostRingFromVertices(polygon, allPoints, tol);
     if (!boostPolygon){
@@ -707,31 +712,10 @@ namespace openstudio{
 
   }
 
-  boost::optional<std::vector<Point3d> > join(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol)
+  // convert the result of a union to vertices, fails unless the union is a single polygon without holes
+  boost::optional<std::vector<Point3d> > verticesFromUnion(const std::vector<BoostPolygon>& polygons, PointWelder& allPoints, double tol)
   {
-    // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
-
-    boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
-    if (!boostPolygon1){
-      return boost::none;
-    }
-
-    boost::optional<BoostRing> boostPolygon2 = nonIntersectingBoostRingFromVertices(polygon2, allPoints, tol);
-    if (!boostPolygon2){
-      return boost::none;
-    }
-
-    // union the points in face coordinates,
-    std::vector<BoostPolygon> unionResult;
-    try{
-      boost::geometry::union_(*boostPolygon1, *boostPolygon2, unionResult);
-    }catch(const boost::geometry::overlay_invalid_input_exception&){
-      LOG_FREE(Error, "utilities.geometry.join", "overlay_invalid_input_exception");
-      return boost::none;
-    }
-
-    unionResult = removeSpikes(unionResult);
+    std::vector<BoostPolygon> unionResult = removeSpikes(polygons);
 
     // should not be any holes, check for that below
 
@@ -770,6 +754,71 @@ namespace openstudio{
     return unionVertices;
   }
 
+  boost::optional<std::vector<Point3d> > join(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol)
+  {
+    // convert vertices to boost rings
+    PointWelder allPoints(tol);
+
+    boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
+    if (!boostPolygon1){
+      return boost::none;
+    }
+
+    boost::optional<BoostRing> boostPolygon2 = nonIntersectingBoostRingFromVertices(polygon2, allPoints, tol);
+    if (!boostPolygon2){
+      return boost::none;
+    }
+
+    // union the points in face coordinates,
+    std::vector<BoostPolygon> unionResult;
+    try{
+      boost::geometry::union_(*boostPolygon1, *boostPolygon2, unionResult);
+    }catch(const boost::geometry::overlay_invalid_input_exception&){
+      LOG_FREE(Error, "utilities.geometry.join", "overlay_invalid_input_exception");
+      return boost::none;
+    }
+
+    return verticesFromUnion(unionResult, allPoints, tol);
+  }
+
+  // union all polygons in a connected component, pieces are unioned pairwise in a balanced tree so each
+  // boolean operation works on similar sized inputs rather than growing one polygon at a time
+  boost::optional<std::vector<Point3d> > joinComponent(const std::vector<std::vector<Point3d> >& polygons, const std::vector<size_t>& component, double tol)
+  {
+    PointWelder allPoints(tol);
+
+    std::vector<BoostMultiPolygon> pieces;
+    for (size_t i : component){
+      boost::optional<BoostPolygon> boostPolygon = nonIntersectingBoostPolygonFromVertices(polygons[i], allPoints, tol);
+      if (!boostPolygon){
+        return boost::none;
+      }
+      BoostMultiPolygon piece;
+      piece.push_back(*boostPolygon);
+      pieces.push_back(piece);
+    }
+
+    try{
+      while (pieces.size() > 1){
+        std::vector<BoostMultiPolygon> merged;
+        for (size_t i = 0; i + 1 < pieces.size(); i += 2){
+          BoostMultiPolygon unionResult;
+          boost::geometry::union_(pieces[i], pieces[i + 1], unionResult);
+          merged.push_back(unionResult);
+        }
+        if (pieces.size() % 2 == 1){
+          merged.push_back(pieces.back());
+        }
+        pieces.swap(merged);
+      }
+    }catch(const boost::geometry::overlay_invalid_input_exception&){
+      LOG_FREE(Error, "utilities.geometry.joinAll", "overlay_invalid_input_exception");
+      return boost::none;
+    }
+
+    return verticesFromUnion(pieces[0], allPoints, tol);
+  }
+
   std::vector<std::vector<Point3d> > joinAll(const std::vector<std::vector<Point3d> >& polygons, double tol)
   {
     std::vector<std::vector<Point3d> > result;
@@ -779,34 +828,102 @@ namespace openstudio{
       return polygons;
     }
 
-    // compute adjacency matrix
-    Matrix A(N,N,0.0);
-    for (unsigned i = 0; i < polygons.size(); ++i){
-      A(i,i) = 1.0;
-      for (unsigned j = i+1; j < polygons.size(); ++j){
+    // bounding boxes in the z = 0 plane, expanded by tol so that touching polygons overlap
+    std::vector<double> minX(N, std::numeric_limits<double>::max());
+    std::vector<double> minY(N, std::numeric_limits<double>::max());
+    std::vector<double> maxX(N, std::numeric_limits<double>::lowest());
+    std::vector<double> maxY(N, std::numeric_limits<double>::lowest());
+    for (size_t i = 0; i < N; ++i){
+      for (const Point3d& point : polygons[i]){
+        minX[i] = std::min(minX[i], point.x() - tol);
+        minY[i] = std::min(minY[i], point.y() - tol);
+        maxX[i] = std::max(maxX[i], point.x() + tol);
+        maxY[i] = std::max(maxY[i], point.y() + tol);
+      }
+    }
+
+    // union-find over polygon indices, the root of each component is its lowest index
+    std::vector<size_t> parent(N);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto findRoot = [&parent](size_t i) {
+      while (parent[i] != i){
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+      }
+      return i;
+    };
+
+    // sweep along x so only polygons with overlapping bounding boxes are tested with a full join,
+    // pairs that are already connected are skipped
+    std::vector<size_t> order(N);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&minX](size_t a, size_t b) {return minX[a] < minX[b]; });
+
+    for (size_t a = 0; a < N; ++a){
+      size_t i = order[a];
+      for (size_t b = a + 1; b < N; ++b){
+        size_t j = order[b];
+        if (minX[j] > maxX[i]){
+          break;
+        }
+        if ((minY[j] > maxY[i]) || (maxY[j] < minY[i])){
+          continue;
+        }
+        size_t rootI = findRoot(i);
+        size_t rootJ = findRoot(j);
+        if (rootI == rootJ){
+          continue;
+        }
         if (join(polygons[i], polygons[j], tol)){
-          A(i,j) = 1.0;
-          A(j,i) = 1.0;
+          parent[std::max(rootI, rootJ)] = std::min(rootI, rootJ);
         }
       }
     }
 
+    // group by component in order of lowest index
+    std::vector<std::vector<size_t> > connectedComponents;
+    std::vector<size_t> componentIndex(N);
+    for (size_t i = 0; i < N; ++i){
+      size_t root = findRoot(i);
+      if (root == i){
+        componentIndex[i] = connectedComponents.size();
+        connectedComponents.push_back(std::vector<size_t>());
+      }
+      connectedComponents[componentIndex[root]].push_back(i);
+    }
 
+    for (const std::vector<size_t>& component : connectedComponents){
+      if (component.size() == 1){
+        result.push_back(polygons[component[0]]);
+        continue;
+      }
 
-    std::vector<std::vector<unsigned> > connectedComponents = findConnectedComponents(A);
-    for (const std::vector<unsigned>& component : connectedComponents){
-      std::vector<Point3d> points;
-      for (unsigned i : component){
-        if (points.empty()){
-          points = polygons[i];
-        }else{
-          boost::optional<std::vector<Point3d> > joined = join(points, polygons[i], tol);
-          if (!joined){
-            LOG_FREE(Error, "utilities.geometry.joinAll", "Expected polygons to join together");
-          }else{
+      boost::optional<std::vector<Point3d> > joined = joinComponent(polygons, component, tol);
+      if (joined){
+        result.push_back(*joined);
+        continue;
+      }
+
+      // fall back to joining one polygon at a time until no more will join
+      std::vector<Point3d> points = polygons[component[0]];
+      std::vector<size_t> remaining(component.begin() + 1, component.end());
+      bool progress = true;
+      while (progress && !remaining.empty()){
+        progress = false;
+        std::vector<size_t> notJoined;
+        for (size_t i : remaining){
+          joined = join(points, polygons[i], tol);
+          if (joined){
             points = *joined;
+            progress = true;
+          }else{
+            notJoined.push_back(i);
           }
         }
+        remaining.swap(notJoined);
+      }
+      if (!remaining.empty()){
+        LOG_FREE(Error, "utilities.geometry.joinAll", "Expected polygons to join together");
       }
       result.push_back(points);
     }
@@ -822,7 +939,7 @@ namespace openstudio{
     std::vector< std::vector<Point3d> > newPolygons2;
 
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointWelder allPoints(tol);
 
     boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
     if (!boostPolygon1){
@@ -977,7 +1094,7 @@ namespace openstudio{
     std::vector<std::vector<Point3d> > result;
 
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointWelder allPoints(tol);
 
     boost::optional<BoostPolygon> initialBoostPolygon = nonIntersectingBoostPolygonFromVertices(polygon, allPoints, tol);
     if (!initialBoostPolygon){
@@ -1014,7 +1131,7 @@ namespace openstudio{
   bool selfIntersects(const std::vector<Point3d>& polygon, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointWelder allPoints(tol);
 
     boost::optional<BoostPolygon> bp = nonIntersectingBoostPolygonFromVertices(polygon, allPoints, tol);
     if (bp){
@@ -1027,7 +1144,7 @@ namespace openstudio{
   bool intersects(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointWelder allPoints(tol);
 
     boost::optional<BoostPolygon> bp1 = boostPolygonFromVertices(polygon1, allPoints, tol);
     boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, allPoints, tol);
@@ -1049,7 +1166,7 @@ namespace openstudio{
   bool within(const std::vector<Point3d>& geometry1, const std::vector<Point3d>& polygon2, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointWelder allPoints(tol);
 
     if (geometry1.size() == 1){
       if (geometry1[0].z() > tol){
@@ -1138,7 +1255,7 @@ namespace openstudio{
 
   std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeCollinear, double tol)
   {
-    std::vector<Point3d> allPoints;
+    PointWelder allPoints(tol);
 
     bool reversed = false;
     boost::optional<Vector3d> outwardNormal = getOutwardNormal(vertices);
@@ -1184,11 +1301,12 @@ namespace openstudio{
     }
 
     // we want to add back in all the unique points, have to put them in the right place
+    const std::vector<Point3d>& uniquePoints = allPoints.points();
     std::set<size_t> pointsToAdd;
-    for (size_t i = 0; i < allPoints.size(); ++i){
+    for (size_t i = 0; i < uniquePoints.size(); ++i){
       bool found = false;
       for (const auto& tmpPoint : tmp){
-        if (getDistance(tmpPoint, allPoints[i]) < tol){
+        if (getDistance(tmpPoint, uniquePoints[i]) < tol){
           found = true;
         }
       }
@@ -1200,10 +1318,10 @@ namespace openstudio{
     std::vector<Point3d> result;
     result.push_back(tmp[0]);
     for (size_t i = 1; i < tmp.size(); ++i){
-      // see which remaining points fit in this segment, double is index in allPoints, alpha along line
+      // see which remaining points fit in this segment, double is index in uniquePoints, alpha along line
       std::vector<std::pair<size_t, double> > pointsInSegment;
       for (size_t j : pointsToAdd){
-        boost::optional<double> alpha = getLinearAlpha(tmp[i - 1], tmp[i], allPoints[j]);
+        boost::optional<double> alpha = getLinearAlpha(tmp[i - 1], tmp[i], uniquePoints[j]);
         if (alpha){
           pointsInSegment.push_back(std::make_pair(j, *alpha));
         }
@@ -1212,7 +1330,7 @@ namespace openstudio{
       std::sort(pointsInSegment.begin(), pointsInSegment.end(), [](std::pair<size_t, double> a, std::pair<size_t, double> b) {return a.second < b.second; });
 
       for (const auto& pointInSegment : pointsInSegment){
-        result.push_back(allPoints[pointInSegment.first]);
+        result.push_back(uniquePoints[pointInSegment.first]);
         pointsToAdd.erase(pointInSegment.first);
       }
 
@@ -1223,7 +1341,7 @@ namespace openstudio{
     // now check between last point and first point
     std::vector<std::pair<size_t, double> > pointsInSegment;
     for (size_t j : pointsToAdd){
-      boost::optional<double> alpha = getLinearAlpha(tmp[tmp.size() - 1], tmp[0], allPoints[j]);
+      boost::optional<double> alpha = getLinearAlpha(tmp[tmp.size() - 1], tmp[0], uniquePoints[j]);
       if (alpha){
         pointsInSegment.push_back(std::make_pair(j, *alpha));
       }
@@ -1232,7 +1350,7 @@ namespace openstudio{
     std::sort(pointsInSegment.begin(), pointsInSegment.end(), [](std::pair<size_t, double> a, std::pair<size_t, double> b) {return a.second < b.second; });
 
     for (const auto& pointInSegment : pointsInSegment){
-      result.push_back(allPoints[pointInSegment.first]);
+      result.push_back(uniquePoints[pointInSegment.first]);
       pointsToAdd.erase(pointInSegment.first);
     }
 
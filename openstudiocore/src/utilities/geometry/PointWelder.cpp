@@ -0,0 +1,130 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "PointWelder.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <cmath>
+
+namespace openstudio{
+
+  PointWelder::PointWelder(double tol)
+    : m_tol(tol)
+  {}
+
+  Point3d PointWelder::weld(const Point3d& point3d)
+  {
+    return m_points[weldIndex(point3d)];
+  }
+
+  size_t PointWelder::weldIndex(const Point3d& point3d)
+  {
+    boost::optional<size_t> existing = find(point3d);
+    if (existing){
+      return *existing;
+    }
+
+    size_t index = m_points.size();
+    m_points.push_back(point3d);
+    if (m_tol > 0){
+      m_cells[cellKey(cellIndex(point3d.x()), cellIndex(point3d.y()), cellIndex(point3d.z()))].push_back(index);
+    }
+    return index;
+  }
+
+  boost::optional<size_t> PointWelder::find(const Point3d& point3d) const
+  {
+    // nothing can be closer than a non-positive tolerance
+    if (m_tol <= 0){
+      return boost::none;
+    }
+
+    // cells are tol wide so any point within tol is in one of the 27 neighboring cells,
+    // take the lowest index to match a linear scan in insertion order
+    boost::optional<size_t> result;
+    std::int64_t i = cellIndex(point3d.x());
+    std::int64_t j = cellIndex(point3d.y());
+    std::int64_t k = cellIndex(point3d.z());
+    for (std::int64_t di = -1; di <= 1; ++di){
+      for (std::int64_t dj = -1; dj <= 1; ++dj){
+        for (std::int64_t dk = -1; dk <= 1; ++dk){
+          auto it = m_cells.find(cellKey(i + di, j + dj, k + dk));
+          if (it == m_cells.end()){
+            continue;
+          }
+          for (size_t index : it->second){
+            if (result && (index >= *result)){
+              continue;
+            }
+            const Point3d& otherPoint = m_points[index];
+            double dx = point3d.x() - otherPoint.x();
+            double dy = point3d.y() - otherPoint.y();
+            double dz = point3d.z() - otherPoint.z();
+            if (std::sqrt(dx*dx + dy*dy + dz*dz) < m_tol){
+              result = index;
+            }
+          }
+        }
+      }
+    }
+    return result;
+  }
+
+  const std::vector<Point3d>& PointWelder::points() const
+  {
+    return m_points;
+  }
+
+  double PointWelder::tolerance() const
+  {
+    return m_tol;
+  }
+
+  void PointWelder::clear()
+  {
+    m_points.clear();
+    m_cells.clear();
+  }
+
+  std::int64_t PointWelder::cellIndex(double value) const
+  {
+    return static_cast<std::int64_t>(std::floor(value / m_tol));
+  }
+
+  size_t PointWelder::cellKey(std::int64_t i, std::int64_t j, std::int64_t k)
+  {
+    size_t result = 0;
+    boost::hash_combine(result, i);
+    boost::hash_combine(result, j);
+    boost::hash_combine(result, k);
+    return result;
+  }
+
+} // openstudio
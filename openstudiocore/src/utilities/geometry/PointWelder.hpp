@@ -0,0 +1,85 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_POINTWELDER_HPP
+#define UTILITIES_GEOMETRY_POINTWELDER_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "Point3d.hpp"
+
+#include <boost/optional.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace openstudio{
+
+  /** PointWelder merges points that are within a tolerance of a previously added point.  Results are the
+   *  same as calling getCombinedPoint with a shared list of points, but nearby points are found through a
+   *  hash grid with cells the size of the tolerance rather than by scanning every point added so far.
+   */
+  class UTILITIES_API PointWelder{
+  public:
+
+    /// points closer than tol are merged
+    explicit PointWelder(double tol = 0.001);
+
+    /// returns the first added point within tolerance of point3d, otherwise adds point3d and returns it
+    Point3d weld(const Point3d& point3d);
+
+    /// returns the index in points() of the first added point within tolerance of point3d, otherwise adds point3d and returns its index
+    size_t weldIndex(const Point3d& point3d);
+
+    /// returns the index in points() of the first added point within tolerance of point3d, does not add point3d
+    boost::optional<size_t> find(const Point3d& point3d) const;
+
+    /// all distinct points in the order they were added
+    const std::vector<Point3d>& points() const;
+
+    double tolerance() const;
+
+    /// remove all points
+    void clear();
+
+  private:
+
+    std::int64_t cellIndex(double value) const;
+
+    // cells that hash to the same key share a bucket, candidates are always checked by distance
+    static size_t cellKey(std::int64_t i, std::int64_t j, std::int64_t k);
+
+    double m_tol;
+    std::vector<Point3d> m_points;
+    std::unordered_map<size_t, std::vector<size_t> > m_cells;
+  };
+
+} // openstudio
+
+#endif // UTILITIES_GEOMETRY_POINTWELDER_HPP
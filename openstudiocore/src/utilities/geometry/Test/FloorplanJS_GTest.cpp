@@ -35,6 +35,8 @@
 
 #include <resources.hxx>
 
+#include <chrono>
+
 using namespace openstudio;
 
 TEST_F(GeometryFixture, FloorplanJS)
@@ -77,3 +79,119 @@ TEST_F(GeometryFixture, FloorplanJS)
   }
 
 }
+
+TEST_F(GeometryFixture, FloorplanJS_ObjectReferences)
+{
+  std::string json = "{\"stories\":[{\"id\":\"1\",\"name\":\"Story 1\",\"handle\":\"\",\"spaces\":[]}],"
+                     "\"thermal_zones\":[{\"id\":\"2\",\"name\":\"Zone\",\"handle\":\"{00000000-0000-0000-0000-000000000001}\"},"
+                     "{\"id\":\"3\",\"name\":\"Zone\",\"handle\":\"\"}]}";
+
+  boost::optional<FloorplanJS> floorplan = FloorplanJS::load(json);
+  ASSERT_TRUE(floorplan);
+
+  std::string storyHandle = toString(createUUID());
+  std::vector<FloorplanObject> stories;
+  stories.push_back(FloorplanObject("", "Story 1", storyHandle));
+  floorplan->updateStories(stories, false);
+
+  // zones referenced by name only link to zones that are not yet linked to a model object
+  FloorplanObject space("", "Space 1", createUUID());
+  space.setParentHandleString(storyHandle);
+  space.setDataReference("thermal_zone_id", FloorplanObject("", "Zone", ""));
+
+  // zones referenced by handle are found even if another zone has the same name
+  FloorplanObject space2("", "Space 2", createUUID());
+  space2.setParentHandleString(storyHandle);
+  space2.setDataReference("thermal_zone_id", FloorplanObject("", "Zone", "{00000000-0000-0000-0000-000000000001}"));
+
+  std::vector<FloorplanObject> spaces;
+  spaces.push_back(space);
+  spaces.push_back(space2);
+  floorplan->updateSpaces(spaces, false);
+
+  Json::Value value;
+  Json::Reader reader;
+  ASSERT_TRUE(reader.parse(floorplan->toJSON(false), value));
+  const Json::Value& story = value["stories"][0];
+  EXPECT_EQ(storyHandle, story["handle"].asString());
+  ASSERT_EQ(2u, story["spaces"].size());
+  EXPECT_EQ("Space 1", story["spaces"][0]["name"].asString());
+  EXPECT_EQ("3", story["spaces"][0]["thermal_zone_id"].asString());
+  EXPECT_EQ("Space 2", story["spaces"][1]["name"].asString());
+  EXPECT_EQ("2", story["spaces"][1]["thermal_zone_id"].asString());
+
+  // renaming a space and adding one with its old name in the same update creates a new space
+  std::vector<FloorplanObject> renamed;
+  renamed.push_back(FloorplanObject("", "Space 3", space.handleString()));
+  renamed.back().setParentHandleString(storyHandle);
+  renamed.push_back(FloorplanObject("", "Space 1", createUUID()));
+  renamed.back().setParentHandleString(storyHandle);
+  floorplan->updateSpaces(renamed, false);
+
+  ASSERT_TRUE(reader.parse(floorplan->toJSON(false), value));
+  const Json::Value& spaces2 = value["stories"][0]["spaces"];
+  ASSERT_EQ(3u, spaces2.size());
+  EXPECT_EQ("Space 3", spaces2[0]["name"].asString());
+  EXPECT_EQ("Space 2", spaces2[1]["name"].asString());
+  EXPECT_EQ("Space 1", spaces2[2]["name"].asString());
+}
+
+TEST_F(GeometryFixture, DISABLED_FloorplanJS_Benchmark)
+{
+  openstudio::path p = resourcesPath() / toPath("utilities/Geometry/floorplan.json");
+  ASSERT_TRUE(exists(p));
+
+  boost::optional<FloorplanJS> floorplan = FloorplanJS::load(toString(p));
+  ASSERT_TRUE(floorplan);
+
+  auto countThermalZones = [](const FloorplanJS& floorplan) {
+    unsigned result = 0;
+    for (const auto& metadata : floorplan.toThreeScene(true).metadata().modelObjectMetadata()){
+      if (metadata.iddObjectType() == "OS:ThermalZone"){
+        ++result;
+      }
+    }
+    return result;
+  };
+  unsigned numThermalZones = countThermalZones(*floorplan);
+
+  const unsigned n = 2000;
+  std::vector<FloorplanObject> objects;
+  for (unsigned i = 0; i < n; ++i){
+    objects.push_back(FloorplanObject("", "Zone " + std::to_string(i), createUUID()));
+  }
+
+  // new objects are added
+  auto start = std::chrono::steady_clock::now();
+  floorplan->updateThermalZones(objects, false);
+  auto end = std::chrono::steady_clock::now();
+  std::cout << "Adding " << n << " thermal zones took "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+  EXPECT_EQ(numThermalZones + n, countThermalZones(*floorplan));
+
+  // existing objects are found by handle and renamed
+  std::vector<FloorplanObject> renamed;
+  for (unsigned i = 0; i < n; ++i){
+    renamed.push_back(FloorplanObject("", "Renamed Zone " + std::to_string(i), objects[i].handleString()));
+  }
+  start = std::chrono::steady_clock::now();
+  floorplan->updateThermalZones(renamed, false);
+  end = std::chrono::steady_clock::now();
+  std::cout << "Renaming " << n << " thermal zones took "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+  EXPECT_EQ(numThermalZones + n, countThermalZones(*floorplan));
+
+  std::string json = floorplan->toJSON(false);
+  EXPECT_NE(std::string::npos, json.find("Renamed Zone 0"));
+  EXPECT_EQ(std::string::npos, json.find("\"Zone 0\""));
+
+  start = std::chrono::steady_clock::now();
+  boost::optional<FloorplanJS> floorplan2 = FloorplanJS::load(json);
+  ASSERT_TRUE(floorplan2);
+  ThreeScene scene = floorplan2->toThreeScene(false);
+  std::string sceneJSON = scene.toJSON(false);
+  end = std::chrono::steady_clock::now();
+  std::cout << "Loading and converting floorplan took "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+  EXPECT_FALSE(sceneJSON.empty());
+}
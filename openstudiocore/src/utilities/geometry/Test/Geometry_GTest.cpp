@@ -35,6 +35,13 @@
 #include "../PointLatLon.hpp"
 #include "../Vector3d.hpp"
 
+#include <boost/math/constants/constants.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -989,6 +996,107 @@ TEST_F(GeometryFixture, Triangulate_Up)
   EXPECT_TRUE(checkNormals(normal, test));
 }
 
+TEST_F(GeometryFixture, Triangulate_Convex)
+{
+  double tol = 0.01;
+  Vector3d normal(0, 0, -1);
+
+  std::vector<std::vector<Point3d> > test;
+  std::vector<std::vector<Point3d> > holes;
+
+  // regular hexagon, clockwise
+  Point3dVector hexagon;
+  for (int i = 0; i < 6; ++i){
+    double angle = -i * boost::math::constants::pi<double>() / 3.0;
+    hexagon.push_back(Point3d(std::cos(angle), std::sin(angle), 0));
+  }
+  test = computeTriangulation(hexagon, holes, tol);
+  ASSERT_EQ(4u, test.size());
+  EXPECT_NEAR(1.5 * std::sqrt(3.0), totalArea(test), 1.0E-12);
+  EXPECT_TRUE(checkNormals(normal, test));
+
+  // L shape is not convex
+  Point3dVector lShape;
+  lShape.push_back(Point3d(0, 0, 0));
+  lShape.push_back(Point3d(0, 2, 0));
+  lShape.push_back(Point3d(1, 2, 0));
+  lShape.push_back(Point3d(1, 1, 0));
+  lShape.push_back(Point3d(2, 1, 0));
+  lShape.push_back(Point3d(2, 0, 0));
+  test = computeTriangulation(lShape, holes, tol);
+  ASSERT_EQ(4u, test.size());
+  EXPECT_DOUBLE_EQ(3.0, totalArea(test));
+  EXPECT_TRUE(checkNormals(normal, test));
+
+  // collinear point on an edge
+  Point3dVector collinear = makeRectangleDown(0, 0, 4, 4);
+  collinear.insert(collinear.begin() + 1, Point3d(0.5 * (collinear[0].x() + collinear[1].x()), 0.5 * (collinear[0].y() + collinear[1].y()), 0));
+  test = computeTriangulation(collinear, holes, tol);
+  EXPECT_FALSE(test.empty());
+  EXPECT_DOUBLE_EQ(16.0, totalArea(test));
+  EXPECT_TRUE(checkNormals(normal, test));
+
+  // cached results match
+  clearTriangulationCache();
+  holes.push_back(makeRectangleDown(1, 1, 1, 1));
+  std::vector<std::vector<Point3d> > first = computeTriangulation(makeRectangleDown(0, 0, 4, 4), holes, tol);
+  std::vector<std::vector<Point3d> > second = computeTriangulation(makeRectangleDown(0, 0, 4, 4), holes, tol);
+  ASSERT_EQ(first.size(), second.size());
+  for (size_t i = 0; i < first.size(); ++i){
+    EXPECT_TRUE(circularEqual(first[i], second[i]));
+  }
+  EXPECT_DOUBLE_EQ(15.0, totalArea(second));
+}
+
+TEST_F(GeometryFixture, DISABLED_Triangulate_Benchmark)
+{
+  double tol = 0.01;
+
+  // walls, windowed walls and L shaped floors of a large model, in face coordinates
+  const unsigned n = 20000;
+  std::vector<Point3dVector> surfaces;
+  std::vector<Point3dVectorVector> surfaceHoles;
+  for (unsigned i = 0; i < n; ++i){
+    double width = 3.0 + (i % 7);
+    switch (i % 4){
+      case 0:
+      case 1:
+        surfaces.push_back(makeRectangleDown(0, 0, width, 3.0));
+        surfaceHoles.push_back(Point3dVectorVector());
+        break;
+      case 2:
+        surfaces.push_back(makeRectangleDown(0, 0, width, 3.0));
+        surfaceHoles.push_back(Point3dVectorVector());
+        surfaceHoles.back().push_back(makeRectangleDown(0.5, 1.0, 1.0, 1.5));
+        surfaceHoles.back().push_back(makeRectangleDown(2.0, 1.0, 0.5, 1.5));
+        break;
+      default:
+        Point3dVector lShape;
+        lShape.push_back(Point3d(0, 0, 0));
+        lShape.push_back(Point3d(0, width, 0));
+        lShape.push_back(Point3d(2, width, 0));
+        lShape.push_back(Point3d(2, 2, 0));
+        lShape.push_back(Point3d(width, 2, 0));
+        lShape.push_back(Point3d(width, 0, 0));
+        surfaces.push_back(lShape);
+        surfaceHoles.push_back(Point3dVectorVector());
+    }
+  }
+
+  clearTriangulationCache();
+  auto start = std::chrono::steady_clock::now();
+  size_t numTriangles = 0;
+  for (unsigned i = 0; i < n; ++i){
+    numTriangles += computeTriangulation(surfaces[i], surfaceHoles[i], tol).size();
+  }
+  auto end = std::chrono::steady_clock::now();
+  EXPECT_LT(0u, numTriangles);
+
+  double seconds = std::chrono::duration<double>(end - start).count();
+  std::cout << "Triangulated " << n << " surfaces into " << numTriangles << " triangles: "
+            << n / std::max(seconds, 1.0E-9) << " surfaces/s" << std::endl;
+}
+
 TEST_F(GeometryFixture, PointLatLon)
 {
   // building in Portland
@@ -39,6 +39,8 @@
 #include <boost/geometry/multi/geometries/multi_polygon.hpp>
 #include <boost/geometry/geometries/adapted/boost_tuple.hpp>
 
+#include <chrono>
+
 typedef boost::geometry::model::d2::point_xy<double> BoostPoint;
 typedef boost::geometry::model::polygon<BoostPoint> BoostPolygon;
 typedef boost::geometry::model::ring<BoostPoint> BoostRing;
@@ -860,6 +862,67 @@ TEST_F(GeometryFixture, JoinAll)
 }
 
 
+// unit squares in columns of width 10 separated by gaps, each column of squares joins to one rectangle
+std::vector<Point3dVector> makeSquareGrid(unsigned nx, unsigned ny)
+{
+  std::vector<Point3dVector> result;
+  for (unsigned i = 0; i < nx; ++i){
+    for (unsigned j = 0; j < ny; ++j){
+      result.push_back(makeRectangleDown(i + (i / 10) * 0.5, j, 1, 1));
+    }
+  }
+  return result;
+}
+
+TEST_F(GeometryFixture, JoinAll_Grid)
+{
+  double tol = 0.01;
+
+  std::vector<Point3dVector> polygons = makeSquareGrid(30, 20);
+  std::vector<Point3dVector> test = joinAll(polygons, tol);
+  ASSERT_EQ(3u, test.size());
+
+  // components are returned in order of their first polygon
+  EXPECT_TRUE(circularEqual(makeRectangleDown(0, 0, 10, 20), test[0])) << test[0];
+  EXPECT_TRUE(circularEqual(makeRectangleDown(10.5, 0, 10, 20), test[1])) << test[1];
+  EXPECT_TRUE(circularEqual(makeRectangleDown(21, 0, 10, 20), test[2])) << test[2];
+
+  // an L of three squares plus a separate square, given out of order
+  polygons.clear();
+  polygons.push_back(makeRectangleDown(5, 5, 1, 1));
+  polygons.push_back(makeRectangleDown(0, 1, 1, 1));
+  polygons.push_back(makeRectangleDown(1, 0, 1, 1));
+  polygons.push_back(makeRectangleDown(0, 0, 1, 1));
+  test = joinAll(polygons, tol);
+  ASSERT_EQ(2u, test.size());
+  EXPECT_TRUE(circularEqual(makeRectangleDown(5, 5, 1, 1), test[0])) << test[0];
+  ASSERT_EQ(6u, test[1].size());
+  boost::optional<double> area = getArea(test[1]);
+  ASSERT_TRUE(area);
+  EXPECT_NEAR(3.0, *area, tol);
+}
+
+TEST_F(GeometryFixture, DISABLED_JoinAll_Benchmark)
+{
+  double tol = 0.01;
+
+  std::vector<Point3dVector> polygons = makeSquareGrid(100, 100);
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<Point3dVector> test = joinAll(polygons, tol);
+  auto end = std::chrono::steady_clock::now();
+
+  ASSERT_EQ(10u, test.size());
+  for (const Point3dVector& polygon : test){
+    boost::optional<double> area = getArea(polygon);
+    ASSERT_TRUE(area);
+    EXPECT_NEAR(1000.0, *area, tol);
+  }
+
+  double seconds = std::chrono::duration<double>(end - start).count();
+  std::cout << "Joined " << polygons.size() << " polygons into " << test.size() << " in " << seconds << " s" << std::endl;
+}
+
 TEST_F(GeometryFixture, RemoveSpikes_Down)
 {
   double tol = 0.01;
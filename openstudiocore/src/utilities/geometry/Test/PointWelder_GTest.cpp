@@ -0,0 +1,106 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "GeometryFixture.hpp"
+
+#include "../PointWelder.hpp"
+#include "../Geometry.hpp"
+#include "../Point3d.hpp"
+
+#include <random>
+
+using namespace openstudio;
+
+TEST_F(GeometryFixture, PointWelder)
+{
+  PointWelder welder(0.01);
+  EXPECT_EQ(0.01, welder.tolerance());
+  EXPECT_TRUE(welder.points().empty());
+
+  EXPECT_EQ(0u, welder.weldIndex(Point3d(0, 0, 0)));
+  EXPECT_EQ(1u, welder.weldIndex(Point3d(1, 0, 0)));
+
+  // within tolerance, including across cell boundaries
+  EXPECT_EQ(0u, welder.weldIndex(Point3d(0.005, 0, 0)));
+  EXPECT_EQ(0u, welder.weldIndex(Point3d(-0.005, -0.005, 0)));
+  EXPECT_EQ(1u, welder.weldIndex(Point3d(0.999, 0.001, -0.001)));
+  EXPECT_EQ(Point3d(1, 0, 0), welder.weld(Point3d(1.001, 0, 0)));
+
+  // just outside tolerance
+  EXPECT_FALSE(welder.find(Point3d(0.0101, 0, 0)));
+  EXPECT_EQ(2u, welder.weldIndex(Point3d(0.0101, 0, 0)));
+
+  // first added point wins when several are within tolerance
+  EXPECT_EQ(0u, welder.weldIndex(Point3d(0.006, 0, 0)));
+
+  EXPECT_EQ(3u, welder.points().size());
+
+  welder.clear();
+  EXPECT_TRUE(welder.points().empty());
+  EXPECT_FALSE(welder.find(Point3d(0, 0, 0)));
+}
+
+TEST_F(GeometryFixture, PointWelder_MatchesGetCombinedPoint)
+{
+  double tol = 0.001;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> coarse(-2.0, 2.0);
+  std::uniform_real_distribution<double> fine(-0.002, 0.002);
+
+  // clusters of points around a coarse grid so many fall within tolerance of each other
+  std::vector<Point3d> points;
+  for (unsigned i = 0; i < 500; ++i){
+    Point3d center(std::round(coarse(generator) * 100.0) / 100.0, std::round(coarse(generator) * 100.0) / 100.0, 0.0);
+    for (unsigned j = 0; j < 4; ++j){
+      points.push_back(Point3d(center.x() + fine(generator), center.y() + fine(generator), fine(generator)));
+    }
+  }
+
+  PointWelder welder(tol);
+  std::vector<Point3d> allPoints;
+  for (const Point3d& point : points){
+    Point3d expected = getCombinedPoint(point, allPoints, tol);
+    Point3d welded = welder.weld(point);
+    EXPECT_EQ(expected.x(), welded.x());
+    EXPECT_EQ(expected.y(), welded.y());
+    EXPECT_EQ(expected.z(), welded.z());
+  }
+
+  ASSERT_EQ(allPoints.size(), welder.points().size());
+  for (size_t i = 0; i < allPoints.size(); ++i){
+    EXPECT_EQ(allPoints[i], welder.points()[i]);
+  }
+
+  // a non-positive tolerance never merges, like getCombinedPoint
+  PointWelder zeroWelder(0.0);
+  EXPECT_EQ(0u, zeroWelder.weldIndex(Point3d(0, 0, 0)));
+  EXPECT_EQ(1u, zeroWelder.weldIndex(Point3d(0, 0, 0)));
+}
@@ -34,6 +34,11 @@
 
 #include <resources.hxx>
 
+#include <jsoncpp/json.h>
+
+#include <algorithm>
+#include <cmath>
+
 using namespace openstudio;
 
 TEST_F(GeometryFixture, ThreeJS)
@@ -60,3 +65,65 @@ TEST_F(GeometryFixture, ThreeJS)
   scene = ThreeScene::load(toString(p));
   ASSERT_TRUE(scene);
 }
+
+TEST_F(GeometryFixture, ThreeJS_Binary)
+{
+  openstudio::path p = resourcesPath() / toPath("utilities/Geometry/threejs.json");
+  ASSERT_TRUE(exists(p));
+
+  boost::optional<ThreeScene> scene = ThreeScene::load(toString(p));
+  ASSERT_TRUE(scene);
+
+  std::string binary = scene->toBinary();
+  EXPECT_LT(binary.size(), scene->toJSON().size());
+
+  boost::optional<ThreeScene> binaryScene = ThreeScene::loadBinary(binary);
+  ASSERT_TRUE(binaryScene);
+
+  EXPECT_EQ(scene->materials().size(), binaryScene->materials().size());
+  EXPECT_EQ(scene->object().children().size(), binaryScene->object().children().size());
+
+  std::vector<ThreeGeometry> geometries = scene->geometries();
+  std::vector<ThreeGeometry> binaryGeometries = binaryScene->geometries();
+  ASSERT_EQ(geometries.size(), binaryGeometries.size());
+  for (size_t i = 0; i < geometries.size(); ++i){
+    EXPECT_EQ(geometries[i].uuid(), binaryGeometries[i].uuid());
+    EXPECT_EQ(geometries[i].data().faces(), binaryGeometries[i].data().faces());
+
+    std::vector<double> vertices = geometries[i].data().vertices();
+    std::vector<double> binaryVertices = binaryGeometries[i].data().vertices();
+    ASSERT_EQ(vertices.size(), binaryVertices.size());
+    for (size_t j = 0; j < vertices.size(); ++j){
+      // vertices are stored in single precision
+      EXPECT_NEAR(vertices[j], binaryVertices[j], 1.0e-5 * std::max(1.0, std::abs(vertices[j])));
+    }
+  }
+
+  EXPECT_FALSE(ThreeScene::loadBinary(scene->toJSON()));
+  EXPECT_FALSE(ThreeScene::loadBinary(binary.substr(0, binary.size() / 2)));
+}
+
+TEST_F(GeometryFixture, ThreeJS_CompactJSON)
+{
+  openstudio::path p = resourcesPath() / toPath("utilities/Geometry/threejs.json");
+  ASSERT_TRUE(exists(p));
+
+  boost::optional<ThreeScene> scene = ThreeScene::load(toString(p));
+  ASSERT_TRUE(scene);
+
+  // compact output should hold the same values as the pretty printed output
+  std::string compact = scene->toJSON(false);
+  std::string pretty = scene->toJSON(true);
+  EXPECT_LT(compact.size(), pretty.size());
+
+  Json::Reader reader;
+  Json::Value compactValue;
+  Json::Value prettyValue;
+  ASSERT_TRUE(reader.parse(compact, compactValue));
+  ASSERT_TRUE(reader.parse(pretty, prettyValue));
+  EXPECT_TRUE(compactValue == prettyValue);
+
+  boost::optional<ThreeScene> scene2 = ThreeScene::load(compact);
+  ASSERT_TRUE(scene2);
+  EXPECT_EQ(compact, scene2->toJSON(false));
+}
@@ -37,6 +37,10 @@
 
 #include <boost/math/constants/constants.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -595,3 +599,64 @@ TEST_F(GeometryFixture, Transformation_Decompose)
   EXPECT_TRUE(transformation.matrix() == test.matrix()) << transformation.matrix() << std::endl << test.matrix();
 
 }
+
+TEST_F(GeometryFixture, Transformation_PointVector)
+{
+  Transformation t = Transformation::translation(Vector3d(10, -5, 3)) *
+                     Transformation::rotation(Vector3d(1, 1, 1), degToRad(35)) *
+                     Transformation::rotation(Vector3d(0, 0, 1), degToRad(-20));
+
+  std::vector<Point3d> points;
+  for (unsigned i = 0; i < 1000; ++i){
+    points.push_back(Point3d(0.5*i, 100.0 - 0.25*i, 0.1*(i % 7)));
+  }
+
+  std::vector<Point3d> transformed = t*points;
+  ASSERT_EQ(points.size(), transformed.size());
+  for (unsigned i = 0; i < points.size(); ++i){
+    Point3d single = t*points[i];
+    EXPECT_DOUBLE_EQ(single.x(), transformed[i].x());
+    EXPECT_DOUBLE_EQ(single.y(), transformed[i].y());
+    EXPECT_DOUBLE_EQ(single.z(), transformed[i].z());
+  }
+
+  // round trip through the inverse
+  std::vector<Point3d> roundTrip = t.inverse()*transformed;
+  ASSERT_EQ(points.size(), roundTrip.size());
+  for (unsigned i = 0; i < points.size(); ++i){
+    EXPECT_NEAR(points[i].x(), roundTrip[i].x(), 1.0E-9);
+    EXPECT_NEAR(points[i].y(), roundTrip[i].y(), 1.0E-9);
+    EXPECT_NEAR(points[i].z(), roundTrip[i].z(), 1.0E-9);
+  }
+}
+
+TEST_F(GeometryFixture, DISABLED_Transformation_PointVector_Benchmark)
+{
+  Transformation t = Transformation::translation(Vector3d(10, -5, 3)) *
+                     Transformation::rotation(Vector3d(1, 1, 1), degToRad(35));
+
+  const unsigned n = 1000000;
+  std::vector<Point3d> points;
+  points.reserve(n);
+  for (unsigned i = 0; i < n; ++i){
+    points.push_back(Point3d(i % 1000, i / 1000, i % 13));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<Point3d> transformed = t*points;
+  auto afterVector = std::chrono::steady_clock::now();
+  std::vector<Point3d> single;
+  single.reserve(n);
+  for (const Point3d& point : points){
+    single.push_back(t*point);
+  }
+  auto afterSingle = std::chrono::steady_clock::now();
+
+  ASSERT_EQ(n, transformed.size());
+  EXPECT_DOUBLE_EQ(single[n-1].x(), transformed[n-1].x());
+
+  double vectorSeconds = std::chrono::duration<double>(afterVector - start).count();
+  double singleSeconds = std::chrono::duration<double>(afterSingle - afterVector).count();
+  std::cout << "Point3d vector: " << n / std::max(vectorSeconds, 1.0E-9) << " points/s, "
+            << "single points: " << n / std::max(singleSeconds, 1.0E-9) << " points/s" << std::endl;
+}
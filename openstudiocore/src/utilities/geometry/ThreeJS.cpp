@@ -37,6 +37,8 @@
 
 #include <jsoncpp/json.h>
 
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <string>
 
@@ -310,24 +312,38 @@ namespace openstudio{
       }
     }
 
+    setFromJsonValue(root);
+  }
+
+  ThreeScene::ThreeScene(const Json::Value& root)
+    : m_metadata(std::vector<std::string>(), ThreeBoundingBox(0,0,0,0,0,0,0,0,0,0), std::vector<ThreeModelObjectMetadata>()), m_sceneObject(ThreeSceneObject("", std::vector<ThreeSceneChild>()))
+  {
+    setFromJsonValue(root);
+  }
+
+  void ThreeScene::setFromJsonValue(const Json::Value& root)
+  {
     assertKeyAndType(root, "metadata", Json::objectValue);
     assertKeyAndType(root, "geometries", Json::arrayValue);
     assertKeyAndType(root, "materials", Json::arrayValue);
     assertKeyAndType(root, "object", Json::objectValue);
 
-    m_metadata = ThreeSceneMetadata(root.get("metadata", Json::objectValue));
+    // read through references, copying the parsed values doubles the memory used for large scenes
+    m_metadata = ThreeSceneMetadata(root["metadata"]);
 
-    Json::Value geometries = root.get("geometries", Json::arrayValue);
+    const Json::Value& geometries = root["geometries"];
+    m_geometries.reserve(geometries.size());
     for (const auto& g : geometries) {
       m_geometries.push_back(ThreeGeometry(g));
     }
 
-    Json::Value materials = root.get("materials", Json::arrayValue);
+    const Json::Value& materials = root["materials"];
+    m_materials.reserve(materials.size());
     for (const auto& m : materials) {
       m_materials.push_back(ThreeMaterial(m));
     }
 
-    m_sceneObject = ThreeSceneObject(root.get("object", Json::objectValue));
+    m_sceneObject = ThreeSceneObject(root["object"]);
   }
 
   boost::optional<ThreeScene> ThreeScene::load(const std::string& json)
@@ -342,6 +358,25 @@ namespace openstudio{
   }
 
   std::string ThreeScene::toJSON(bool prettyPrint) const
+  {
+    Json::Value scene = toJsonValue();
+
+    // write to string
+    std::string result;
+    if (prettyPrint){
+      Json::StyledWriter writer;
+      result = writer.write(scene);
+    } else{
+      // no indentation or spaces, streamed without the intermediate copies made by Json::FastWriter
+      Json::StreamWriterBuilder builder;
+      builder["indentation"] = "";
+      result = Json::writeString(builder, scene);
+    }
+
+    return result;
+  }
+
+  Json::Value ThreeScene::toJsonValue() const
   {
     Json::Value scene(Json::objectValue);
 
@@ -365,19 +400,187 @@ namespace openstudio{
     // object
     scene["object"] = m_sceneObject.toJsonValue();
 
-    // write to string
-    std::string result;
-    if (prettyPrint){
-      Json::StyledWriter writer;
-      result = writer.write(scene);
-    } else{
-      Json::FastWriter writer;
-      result = writer.write(scene);
+    return scene;
+  }
+
+  namespace {
+
+    // binary container layout, all integers are little endian uint32:
+    //   header: magic, version, total length
+    //   chunks: chunk length, chunk type, chunk data padded to 4 bytes
+    // the first chunk is the JSON scene, the second holds the vertices (float32) and then the faces (uint32)
+    // of each geometry in the order of the geometries array, each geometry only records its counts
+    const uint32_t threeBinaryMagic = 0x4A54534F; // "OSTJ"
+    const uint32_t threeBinaryVersion = 1;
+    const uint32_t threeBinaryJSONChunk = 0x4E4F534A; // "JSON"
+    const uint32_t threeBinaryBINChunk = 0x004E4942; // "BIN\0"
+
+    void appendUInt32(std::string& s, uint32_t value)
+    {
+      s.push_back(static_cast<char>(value & 0xFF));
+      s.push_back(static_cast<char>((value >> 8) & 0xFF));
+      s.push_back(static_cast<char>((value >> 16) & 0xFF));
+      s.push_back(static_cast<char>((value >> 24) & 0xFF));
+    }
+
+    void appendFloat32(std::string& s, double value)
+    {
+      float f = static_cast<float>(value);
+      uint32_t bits;
+      std::memcpy(&bits, &f, sizeof(bits));
+      appendUInt32(s, bits);
     }
 
+    uint32_t readUInt32(const std::string& s, size_t offset)
+    {
+      return static_cast<uint32_t>(static_cast<unsigned char>(s[offset])) |
+             (static_cast<uint32_t>(static_cast<unsigned char>(s[offset + 1])) << 8) |
+             (static_cast<uint32_t>(static_cast<unsigned char>(s[offset + 2])) << 16) |
+             (static_cast<uint32_t>(static_cast<unsigned char>(s[offset + 3])) << 24);
+    }
+
+    double readFloat32(const std::string& s, size_t offset)
+    {
+      uint32_t bits = readUInt32(s, offset);
+      float f;
+      std::memcpy(&f, &bits, sizeof(f));
+      return f;
+    }
+
+  }
+
+  std::string ThreeScene::toBinary() const
+  {
+    Json::Value scene(Json::objectValue);
+    scene["metadata"] = m_metadata.toJsonValue();
+
+    // geometry data goes to the binary chunk, the JSON only references it
+    std::string buffer;
+    Json::Value geometries(Json::arrayValue);
+    for (const auto& g : m_geometries) {
+      Json::Value geometry = g.toJsonValue(false);
+      Json::Value& data = geometry["data"];
+      data.removeMember("vertices");
+      data.removeMember("faces");
+
+      const std::vector<double>& vertices = g.m_data.m_vertices;
+      data["vertexCount"] = static_cast<unsigned>(vertices.size());
+      for (const auto& v : vertices){
+        appendFloat32(buffer, v);
+      }
+
+      const std::vector<size_t>& faces = g.m_data.m_faces;
+      data["faceCount"] = static_cast<unsigned>(faces.size());
+      for (const auto& f : faces){
+        appendUInt32(buffer, static_cast<uint32_t>(f));
+      }
+
+      geometries.append(geometry);
+    }
+    scene["geometries"] = geometries;
+
+    Json::Value materials(Json::arrayValue);
+    for (const auto& m : m_materials){
+      materials.append(m.toJsonValue());
+    }
+    scene["materials"] = materials;
+
+    scene["object"] = m_sceneObject.toJsonValue();
+
+    Json::FastWriter writer;
+    std::string json = writer.write(scene);
+    while (json.size() % 4 != 0){
+      json.push_back(' ');
+    }
+
+    std::string result;
+    result.reserve(12 + 8 + json.size() + 8 + buffer.size());
+    appendUInt32(result, threeBinaryMagic);
+    appendUInt32(result, threeBinaryVersion);
+    appendUInt32(result, static_cast<uint32_t>(12 + 8 + json.size() + 8 + buffer.size()));
+    appendUInt32(result, static_cast<uint32_t>(json.size()));
+    appendUInt32(result, threeBinaryJSONChunk);
+    result.append(json);
+    appendUInt32(result, static_cast<uint32_t>(buffer.size()));
+    appendUInt32(result, threeBinaryBINChunk);
+    result.append(buffer);
+
     return result;
   }
 
+  boost::optional<ThreeScene> ThreeScene::loadBinary(const std::string& binary)
+  {
+    try {
+      if (binary.size() < 20 || readUInt32(binary, 0) != threeBinaryMagic){
+        LOG_AND_THROW("Not a ThreeJS binary container");
+      }
+      if (readUInt32(binary, 4) != threeBinaryVersion){
+        LOG_AND_THROW("Unknown ThreeJS binary container version " << readUInt32(binary, 4));
+      }
+      if (readUInt32(binary, 8) != binary.size()){
+        LOG_AND_THROW("ThreeJS binary container is truncated");
+      }
+
+      size_t jsonLength = readUInt32(binary, 12);
+      if (readUInt32(binary, 16) != threeBinaryJSONChunk || 20 + jsonLength + 8 > binary.size()){
+        LOG_AND_THROW("ThreeJS binary container is missing the JSON chunk");
+      }
+
+      size_t bufferOffset = 20 + jsonLength;
+      size_t bufferLength = readUInt32(binary, bufferOffset);
+      if (readUInt32(binary, bufferOffset + 4) != threeBinaryBINChunk || bufferOffset + 8 + bufferLength != binary.size()){
+        LOG_AND_THROW("ThreeJS binary container is missing the binary chunk");
+      }
+      bufferOffset += 8;
+
+      Json::Value root;
+      Json::Reader reader;
+      if (!reader.parse(binary.data() + 20, binary.data() + 20 + jsonLength, root)){
+        LOG_AND_THROW("ThreeJS binary container JSON cannot be processed, " << reader.getFormattedErrorMessages());
+      }
+
+      // restore the geometry data from the binary chunk, geometries are stored back to back
+      assertKeyAndType(root, "geometries", Json::arrayValue);
+      size_t offset = 0;
+      for (auto& geometry : root["geometries"]) {
+        assertKeyAndType(geometry, "data", Json::objectValue);
+        Json::Value& data = geometry["data"];
+        assertKeyAndType(data, "vertexCount", Json::uintValue);
+        assertKeyAndType(data, "faceCount", Json::uintValue);
+
+        size_t vertexCount = data["vertexCount"].asUInt();
+        size_t faceCount = data["faceCount"].asUInt();
+        if (offset + 4 * (vertexCount + faceCount) > bufferLength){
+          LOG_AND_THROW("ThreeJS binary container geometry buffer out of range");
+        }
+
+        Json::Value vertices(Json::arrayValue);
+        for (size_t i = 0; i < vertexCount; ++i, offset += 4){
+          vertices.append(readFloat32(binary, bufferOffset + offset));
+        }
+
+        Json::Value faces(Json::arrayValue);
+        for (size_t i = 0; i < faceCount; ++i, offset += 4){
+          faces.append(readUInt32(binary, bufferOffset + offset));
+        }
+
+        data["vertices"] = vertices;
+        data["faces"] = faces;
+        data.removeMember("vertexCount");
+        data.removeMember("faceCount");
+      }
+      if (offset != bufferLength){
+        LOG_AND_THROW("ThreeJS binary container has unused geometry data");
+      }
+
+      ThreeScene scene(root);
+      return scene;
+    } catch (...) {
+      LOG(Error, "Could not parse binary input");
+    }
+    return boost::none;
+  }
+
   ThreeSceneMetadata ThreeScene::metadata() const
   {
     return m_metadata;
@@ -446,39 +649,45 @@ namespace openstudio{
     m_receiveShadow = value.get("receiveShadow", true).asBool();
     m_doubleSided = value.get("doubleSided", true).asBool();
 
-    Json::Value vertices = value.get("vertices", Json::arrayValue);
+    const Json::Value& vertices = value["vertices"];
     Json::ArrayIndex n = vertices.size();
+    m_vertices.reserve(n);
     for (Json::ArrayIndex i = 0; i < n; ++i){
       m_vertices.push_back(vertices[i].asDouble());
     }
 
-    Json::Value normals = value.get("normals", Json::arrayValue);
+    const Json::Value& normals = value["normals"];
     n = normals.size();
+    m_normals.reserve(n);
     for (Json::ArrayIndex i = 0; i < n; ++i){
       m_normals.push_back(normals[i].asInt()); // DLM: known type conversion?
     }
 
-    Json::Value uvs = value.get("uvs", Json::arrayValue);
+    const Json::Value& uvs = value["uvs"];
     n = uvs.size();
+    m_uvs.reserve(n);
     for (Json::ArrayIndex i = 0; i < n; ++i){
       m_uvs.push_back(uvs[i].asInt()); // DLM: known type conversion?
     }
 
-    Json::Value faces = value.get("faces", Json::arrayValue);
+    const Json::Value& faces = value["faces"];
     n = faces.size();
+    m_faces.reserve(n);
     for (Json::ArrayIndex i = 0; i < n; ++i){
       m_faces.push_back(faces[i].asInt()); // DLM: known type conversion?
     }
 
   }
 
-  Json::Value ThreeGeometryData::toJsonValue() const
+  Json::Value ThreeGeometryData::toJsonValue(bool includeBuffers) const
   {
     Json::Value result;
 
     Json::Value vertices(Json::arrayValue);
-    for (const auto& v : m_vertices){
-      vertices.append(v);
+    if (includeBuffers){
+      for (const auto& v : m_vertices){
+        vertices.append(v);
+      }
     }
 
     Json::Value normals(Json::arrayValue);
@@ -486,8 +695,10 @@ namespace openstudio{
     Json::Value uvs(Json::arrayValue);
 
     Json::Value faces(Json::arrayValue);
-    for (const size_t& f : m_faces){
-      faces.append(static_cast<unsigned>(f));
+    if (includeBuffers){
+      for (const size_t& f : m_faces){
+        faces.append(static_cast<unsigned>(f));
+      }
     }
 
     result["vertices"] = vertices;
@@ -554,7 +765,7 @@ namespace openstudio{
    {}
 
   ThreeGeometry::ThreeGeometry(const Json::Value& value)
-    : m_data(value.get("data", Json::objectValue))
+    : m_data(value["data"])
   {
     assertKeyAndType(value, "data", Json::objectValue);
     assertKeyAndType(value, "uuid", Json::stringValue);
@@ -563,12 +774,12 @@ namespace openstudio{
     m_type = value.get("type", "").asString();
   }
 
-  Json::Value ThreeGeometry::toJsonValue() const
+  Json::Value ThreeGeometry::toJsonValue(bool includeBuffers) const
   {
     Json::Value result(Json::objectValue);
     result["uuid"] = m_uuid;
     result["type"] = m_type;
-    result["data"] = m_data.toJsonValue();
+    result["data"] = m_data.toJsonValue(includeBuffers);
 
     return result;
   }
@@ -1292,13 +1503,13 @@ namespace openstudio{
     m_geometryId = value.get("geometry", "").asString();
     m_materialId = value.get("material", "").asString();
 
-    Json::Value matrix = value.get("matrix", Json::arrayValue);
+    const Json::Value& matrix = value["matrix"];
     Json::ArrayIndex n = matrix.size();
     for (Json::ArrayIndex i = 0; i < n; ++i){
       m_matrix.push_back(matrix[i].asDouble());
     }
 
-    m_userData = ThreeUserData(value.get("userData", Json::objectValue));
+    m_userData = ThreeUserData(value["userData"]);
   }
 
   Json::Value ThreeSceneChild::toJsonValue() const
@@ -1370,13 +1581,14 @@ namespace openstudio{
     m_uuid = value.get("uuid", "").asString();
     m_type = value.get("type", "").asString();
 
-    Json::Value children = value.get("children", Json::arrayValue);
+    const Json::Value& children = value["children"];
     Json::ArrayIndex n = children.size();
+    m_children.reserve(n);
     for (Json::ArrayIndex i = 0; i < n; ++i){
       m_children.push_back(ThreeSceneChild(children[i]));
     }
 
-    Json::Value matrix = value.get("matrix", Json::arrayValue);
+    const Json::Value& matrix = value["matrix"];
     n = matrix.size();
     for (Json::ArrayIndex i = 0; i < n; ++i){
       m_matrix.push_back(matrix[i].asDouble());
@@ -1742,8 +1954,9 @@ namespace openstudio{
     // DLM: done in initializer
     //boundingBox = ThreeBoundingBox(value.get("boundinmgBox", Json::objectValue));
 
-    Json::Value modelObjectMetadata = value.get("modelObjectMetadata", Json::arrayValue);
+    const Json::Value& modelObjectMetadata = value["modelObjectMetadata"];
     n = modelObjectMetadata.size();
+    m_modelObjectMetadata.reserve(n);
     for (Json::ArrayIndex i = 0; i < n; ++i){
       m_modelObjectMetadata.push_back(ThreeModelObjectMetadata(modelObjectMetadata[i]));
     }
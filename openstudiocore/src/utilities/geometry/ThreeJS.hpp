@@ -139,8 +139,9 @@ namespace openstudio{
 
   private:
     friend class ThreeGeometry;
+    friend class ThreeScene;
     ThreeGeometryData(const Json::Value& json);
-    Json::Value toJsonValue() const;
+    Json::Value toJsonValue(bool includeBuffers = true) const;
 
     std::vector<double> m_vertices;
     std::vector<size_t> m_normals;
@@ -164,7 +165,7 @@ namespace openstudio{
   private:
     friend class ThreeScene;
     ThreeGeometry(const Json::Value& json);
-    Json::Value toJsonValue() const;
+    Json::Value toJsonValue(bool includeBuffers = true) const;
 
     std::string m_uuid;
     std::string m_type;
@@ -391,6 +392,7 @@ namespace openstudio{
 
   private:
     friend class ThreeSceneObject;
+    friend class ThreeScene;
     ThreeSceneChild(const Json::Value& json);
     Json::Value toJsonValue() const;
 
@@ -567,6 +569,14 @@ namespace openstudio{
     /// print to JSON
     std::string toJSON(bool prettyPrint = false) const;
 
+    /** print to a compact binary container in the style of glTF binary files, a JSON chunk holds the scene
+    *   with geometry vertices and faces replaced by their counts, a binary chunk holds the packed little endian
+    *   float32 positions and uint32 face indices of each geometry in turn, vertices are stored in single precision */
+    std::string toBinary() const;
+
+    /// load from a string written by toBinary
+    static boost::optional<ThreeScene> loadBinary(const std::string& binary);
+
     ThreeSceneMetadata metadata() const;
     std::vector<ThreeGeometry> geometries() const;
     boost::optional<ThreeGeometry> getGeometry(const std::string& geometryId) const;
@@ -577,6 +587,10 @@ namespace openstudio{
   private:
     REGISTER_LOGGER("ThreeScene");
 
+    ThreeScene(const Json::Value& root);
+    void setFromJsonValue(const Json::Value& root);
+    Json::Value toJsonValue() const;
+
     ThreeSceneMetadata m_metadata;
     std::vector<ThreeGeometry> m_geometries;
     std::vector<ThreeMaterial> m_materials;
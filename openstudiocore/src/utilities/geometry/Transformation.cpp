@@ -321,25 +321,24 @@ namespace openstudio{
   /// apply the transformation to the point
   Point3d Transformation::operator*(const Point3d& point) const
   {
-    Vector temp(4);
-    temp(0) = point.x();
-    temp(1) = point.y();
-    temp(2) = point.z();
-    temp(3) = 1.0;
-    temp = prod(m_storage, temp);
-    return Point3d(temp[0], temp[1], temp[2]);
+    // affine transformation, the last row of m_storage is never needed
+    const double x = point.x();
+    const double y = point.y();
+    const double z = point.z();
+    return Point3d(m_storage(0,0)*x + m_storage(0,1)*y + m_storage(0,2)*z + m_storage(0,3),
+                   m_storage(1,0)*x + m_storage(1,1)*y + m_storage(1,2)*z + m_storage(1,3),
+                   m_storage(2,0)*x + m_storage(2,1)*y + m_storage(2,2)*z + m_storage(2,3));
   }
 
   /// apply the transformation to the vector
   Vector3d Transformation::operator*(const Vector3d& vector) const
   {
-    Vector temp(4);
-    temp(0) = vector.x();
-    temp(1) = vector.y();
-    temp(2) = vector.z();
-    temp(3) = 1.0;
-    temp = prod(m_storage, temp);
-    return Vector3d(temp[0], temp[1], temp[2]);
+    const double x = vector.x();
+    const double y = vector.y();
+    const double z = vector.z();
+    return Vector3d(m_storage(0,0)*x + m_storage(0,1)*y + m_storage(0,2)*z + m_storage(0,3),
+                    m_storage(1,0)*x + m_storage(1,1)*y + m_storage(1,2)*z + m_storage(1,3),
+                    m_storage(2,0)*x + m_storage(2,1)*y + m_storage(2,2)*z + m_storage(2,3));
   }
 
   /// apply the transformation to the BoundingBox
@@ -372,9 +371,18 @@ namespace openstudio{
   /// apply the transformation to a vector of points
   std::vector<Point3d> Transformation::operator*(const std::vector<Point3d>& points) const
   {
-    std::vector<Point3d> result(points.size());
-    for(unsigned i = 0; i < points.size(); ++i){
-      result[i] = (*this)*points[i];
+    std::vector<Point3d> result;
+    result.reserve(points.size());
+    const double m00 = m_storage(0,0), m01 = m_storage(0,1), m02 = m_storage(0,2), m03 = m_storage(0,3);
+    const double m10 = m_storage(1,0), m11 = m_storage(1,1), m12 = m_storage(1,2), m13 = m_storage(1,3);
+    const double m20 = m_storage(2,0), m21 = m_storage(2,1), m22 = m_storage(2,2), m23 = m_storage(2,3);
+    for (const Point3d& point : points){
+      const double x = point.x();
+      const double y = point.y();
+      const double z = point.z();
+      result.push_back(Point3d(m00*x + m01*y + m02*z + m03,
+                               m10*x + m11*y + m12*z + m13,
+                               m20*x + m21*y + m22*z + m23));
     }
     return result;
   }
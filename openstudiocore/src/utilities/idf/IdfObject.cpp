@@ -77,7 +77,7 @@ namespace detail {
   IdfObject_Impl::IdfObject_Impl(const IdfObject_Impl& other, bool keepHandle)
     : m_comment(other.comment()),
       m_iddObject(other.iddObject()),
-      m_fields(other.fields()),
+      m_fields(other.m_fields),
       m_fieldComments(other.fieldComments())
   {
     if (keepHandle){
@@ -155,6 +155,20 @@ namespace detail {
     resizeToMinFields();
   }
 
+  IdfObject_Impl::IdfObject_Impl(const Handle& handle,
+                                 const std::string& comment,
+                                 const IddObject& iddObject,
+                                 const IdfObjectFields& fields,
+                                 const StringVector& fieldComments)
+    : m_handle(handle),
+      m_comment(comment),
+      m_iddObject(iddObject),
+      m_fields(fields),
+      m_fieldComments(fieldComments)
+  {
+    resizeToMinFields();
+  }
+
   // GETTERS
 
   Handle IdfObject_Impl::handle() const {
@@ -476,7 +490,7 @@ namespace detail {
       n = numFields();
       if (i < n) {
         std::string oldName = m_fields[i];
-        m_fields[i] = newName;
+        m_fields.set(i, newName);
         m_diffs.push_back(IdfObjectDiff(i, oldName, newName));
       }
       else {
@@ -561,7 +575,7 @@ namespace detail {
 
       OS_ASSERT(index < m_fields.size());
 
-      m_fields[index] = value;
+      m_fields.set(index, value);
       m_diffs.push_back(IdfObjectDiff(index, oldValue, value));
       return result;
     }
@@ -2025,7 +2039,7 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
 
   std::vector<std::string> IdfObject_Impl::fields() const
   {
-    return m_fields;
+    return m_fields.strings();
   }
 
   std::vector<std::string> IdfObject_Impl::fieldComments() const
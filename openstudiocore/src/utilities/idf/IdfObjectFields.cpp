@@ -0,0 +1,164 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "IdfObjectFields.hpp"
+
+#include "../core/Assert.hpp"
+
+#include <algorithm>
+
+namespace openstudio {
+namespace detail {
+
+  namespace {
+
+    struct OverlayIndexLess {
+      bool operator()(const std::pair<unsigned, std::string>& left, unsigned right) const {
+        return left.first < right;
+      }
+    };
+
+  }
+
+  IdfObjectFields::IdfObjectFields()
+  {}
+
+  IdfObjectFields::IdfObjectFields(const std::vector<std::string>& fields)
+    : m_block(std::make_shared<std::vector<std::string> >(fields))
+  {}
+
+  unsigned IdfObjectFields::size() const {
+    if (!m_block) {
+      return 0u;
+    }
+    return m_block->size();
+  }
+
+  bool IdfObjectFields::empty() const {
+    return (size() == 0u);
+  }
+
+  const std::string& IdfObjectFields::operator[](unsigned index) const {
+    OS_ASSERT(index < size());
+    if (!m_overlay.empty()) {
+      auto it = std::lower_bound(m_overlay.begin(), m_overlay.end(), index, OverlayIndexLess());
+      if ((it != m_overlay.end()) && (it->first == index)) {
+        return it->second;
+      }
+    }
+    return (*m_block)[index];
+  }
+
+  const std::string& IdfObjectFields::back() const {
+    OS_ASSERT(!empty());
+    return (*this)[size() - 1u];
+  }
+
+  std::vector<std::string> IdfObjectFields::strings() const {
+    if (!m_block) {
+      return std::vector<std::string>();
+    }
+    std::vector<std::string> result(*m_block);
+    for (const auto& edit : m_overlay) {
+      result[edit.first] = edit.second;
+    }
+    return result;
+  }
+
+  void IdfObjectFields::set(unsigned index, const std::string& value) {
+    OS_ASSERT(index < size());
+    if (m_block.use_count() == 1) {
+      applyOverlay();
+      (*m_block)[index] = value;
+      return;
+    }
+    auto it = std::lower_bound(m_overlay.begin(), m_overlay.end(), index, OverlayIndexLess());
+    if ((it != m_overlay.end()) && (it->first == index)) {
+      it->second = value;
+    }
+    else if (m_overlay.size() < maxOverlayFields) {
+      m_overlay.insert(it, std::make_pair(index, value));
+    }
+    else {
+      detach();
+      (*m_block)[index] = value;
+    }
+  }
+
+  void IdfObjectFields::push_back(const std::string& value) {
+    detach();
+    m_block->push_back(value);
+  }
+
+  void IdfObjectFields::pop_back() {
+    OS_ASSERT(!empty());
+    detach();
+    m_block->pop_back();
+  }
+
+  void IdfObjectFields::resize(unsigned n) {
+    if (n == size()) {
+      return;
+    }
+    detach();
+    m_block->resize(n);
+  }
+
+  bool IdfObjectFields::isShared() const {
+    return (m_block.use_count() > 1);
+  }
+
+  bool IdfObjectFields::sharesStorageWith(const IdfObjectFields& other) const {
+    return (m_block && (m_block == other.m_block));
+  }
+
+  unsigned IdfObjectFields::numOverlayFields() const {
+    return m_overlay.size();
+  }
+
+  void IdfObjectFields::detach() {
+    if (!m_block) {
+      m_block = std::make_shared<std::vector<std::string> >();
+    }
+    else if (m_block.use_count() > 1) {
+      m_block = std::make_shared<std::vector<std::string> >(*m_block);
+    }
+    applyOverlay();
+  }
+
+  void IdfObjectFields::applyOverlay() {
+    OS_ASSERT(!m_block || (m_block.use_count() == 1));
+    for (auto& edit : m_overlay) {
+      (*m_block)[edit.first].swap(edit.second);
+    }
+    m_overlay.clear();
+  }
+
+} // detail
+} // openstudio
@@ -0,0 +1,106 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_IDFOBJECTFIELDS_HPP
+#define UTILITIES_IDF_IDFOBJECTFIELDS_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace openstudio {
+namespace detail {
+
+  /** Copy-on-write storage for the fields of an IdfObject_Impl. Copies share one immutable block
+   *  of field strings. A small number of single field edits (for instance the new handle written
+   *  into field 0 of a clone) are kept in a per-object overlay; any other modification detaches
+   *  the object onto its own block. Cloning an object therefore costs a pointer copy, and field
+   *  data is only duplicated for objects that are later changed. */
+  class UTILITIES_API IdfObjectFields {
+   public:
+
+    IdfObjectFields();
+
+    explicit IdfObjectFields(const std::vector<std::string>& fields);
+
+    /** Returns the number of fields. */
+    unsigned size() const;
+
+    bool empty() const;
+
+    /** Returns the value of field index. Requires index < size(). */
+    const std::string& operator[](unsigned index) const;
+
+    /** Returns the value of the last field. Requires !empty(). */
+    const std::string& back() const;
+
+    /** Returns a copy of all fields as a plain vector. */
+    std::vector<std::string> strings() const;
+
+    /** Sets field index to value. Requires index < size(). */
+    void set(unsigned index, const std::string& value);
+
+    void push_back(const std::string& value);
+
+    void pop_back();
+
+    void resize(unsigned n);
+
+    /** Returns true if this object shares its field block with at least one other object. */
+    bool isShared() const;
+
+    /** Returns true if this object and other read from the same field block. */
+    bool sharesStorageWith(const IdfObjectFields& other) const;
+
+    /** Returns the number of edits held in the overlay, on top of the shared block. */
+    unsigned numOverlayFields() const;
+
+   private:
+
+    // make sure m_block is owned by this object alone and holds all overlay edits
+    void detach();
+
+    // write the overlay into m_block, which must not be shared
+    void applyOverlay();
+
+    std::shared_ptr<std::vector<std::string> > m_block;
+
+    // edits on top of a shared m_block, sorted by field index
+    std::vector<std::pair<unsigned, std::string> > m_overlay;
+
+    static const unsigned maxOverlayFields = 8u;
+  };
+
+} // detail
+} // openstudio
+
+#endif // UTILITIES_IDF_IDFOBJECTFIELDS_HPP
@@ -33,6 +33,7 @@
 #include <utilities/UtilitiesAPI.hpp>
 #include <utilities/idf/Handle.hpp>
 #include <utilities/idf/IdfObjectDiff.hpp>
+#include <utilities/idf/IdfObjectFields.hpp>
 #include <utilities/idd/IddObject.hpp>
 
 #include <utilities/core/Logger.hpp>
@@ -86,6 +87,14 @@ namespace detail {
                    const StringVector& fields,
                    const StringVector& fieldComments);
 
+    /** Constructor from underlying data that shares fields with the caller, copy-on-write. Used
+     *  by WorkspaceObject_Impl. */
+    IdfObject_Impl(const Handle& handle,
+                   const std::string& comment,
+                   const IddObject& iddObject,
+                   const IdfObjectFields& fields,
+                   const StringVector& fieldComments);
+
     virtual ~IdfObject_Impl() {}
 
     //@}
@@ -405,8 +414,8 @@ namespace detail {
     // idd object definition
     IddObject m_iddObject;
 
-    // idf fields
-    std::vector<std::string> m_fields;
+    // idf fields, shared copy-on-write between clones
+    IdfObjectFields m_fields;
     std::vector<std::string> m_fieldComments; // only populated if encounter non-empty, non-default comment
 
     // idf differences
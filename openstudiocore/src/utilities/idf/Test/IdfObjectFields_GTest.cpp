@@ -0,0 +1,111 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "IdfFixture.hpp"
+
+#include "../IdfObjectFields.hpp"
+
+using namespace openstudio;
+using namespace openstudio::detail;
+
+TEST_F(IdfFixture, IdfObjectFields_CopyShares)
+{
+  StringVector values;
+  values.push_back("{handle}");
+  values.push_back("Name");
+  values.push_back("1.0");
+  IdfObjectFields original(values);
+  EXPECT_FALSE(original.isShared());
+
+  IdfObjectFields copy(original);
+  EXPECT_TRUE(copy.sharesStorageWith(original));
+  EXPECT_TRUE(original.isShared());
+  EXPECT_EQ(values, copy.strings());
+}
+
+TEST_F(IdfFixture, IdfObjectFields_SetUsesOverlay)
+{
+  StringVector values(4u, "x");
+  IdfObjectFields original(values);
+  IdfObjectFields copy(original);
+
+  copy.set(0, "{new handle}");
+  EXPECT_TRUE(copy.sharesStorageWith(original));
+  EXPECT_EQ(1u, copy.numOverlayFields());
+  EXPECT_EQ("{new handle}", copy[0]);
+  EXPECT_EQ("x", original[0]);
+
+  // overwriting the same field does not grow the overlay
+  copy.set(0, "{newer handle}");
+  EXPECT_EQ(1u, copy.numOverlayFields());
+  EXPECT_EQ("{newer handle}", copy[0]);
+
+  // structural changes detach and fold the overlay into the new block
+  copy.push_back("y");
+  EXPECT_FALSE(copy.sharesStorageWith(original));
+  EXPECT_EQ(0u, copy.numOverlayFields());
+  ASSERT_EQ(5u, copy.size());
+  EXPECT_EQ("{newer handle}", copy[0]);
+  EXPECT_EQ("y", copy.back());
+  ASSERT_EQ(4u, original.size());
+  EXPECT_EQ("x", original[0]);
+
+  // original is now the sole owner and writes in place
+  original.set(1, "z");
+  EXPECT_EQ(0u, original.numOverlayFields());
+  EXPECT_EQ("z", original[1]);
+  EXPECT_EQ("x", copy[1]);
+}
+
+TEST_F(IdfFixture, IdfObjectFields_ManyEditsDetach)
+{
+  StringVector values(20u, "x");
+  IdfObjectFields original(values);
+  IdfObjectFields copy(original);
+
+  for (unsigned i = 0; i < 20u; ++i) {
+    copy.set(i, "y");
+  }
+  EXPECT_FALSE(copy.sharesStorageWith(original));
+  EXPECT_EQ(StringVector(20u, "y"), copy.strings());
+  EXPECT_EQ(values, original.strings());
+}
+
+TEST_F(IdfFixture, IdfObjectFields_Resize)
+{
+  IdfObjectFields fields;
+  EXPECT_TRUE(fields.empty());
+  fields.resize(3);
+  EXPECT_EQ(3u, fields.size());
+  EXPECT_TRUE(fields[2].empty());
+  fields.pop_back();
+  EXPECT_EQ(2u, fields.size());
+}
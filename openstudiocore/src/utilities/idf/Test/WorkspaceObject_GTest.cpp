@@ -515,6 +515,60 @@ TEST_F(IdfFixture, WorkspaceObject_Filter_Sources)
 }
 
 
+TEST_F(IdfFixture, WorkspaceObject_SourceIndex)
+{
+  Workspace ws(StrictnessLevel::Draft, IddFileType::OpenStudio);
+  OptionalWorkspaceObject node = ws.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject node2 = ws.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject spm = ws.addObject(IdfObject(IddObjectType::OS_SetpointManager_MixedAir));
+  OptionalWorkspaceObject spm2 = ws.addObject(IdfObject(IddObjectType::OS_SetpointManager_MixedAir));
+  ASSERT_TRUE(node && node2 && spm && spm2);
+
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName, node->handle()));
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::FanInletNodeName, node->handle()));
+  EXPECT_TRUE(spm2->setPointer(OS_SetpointManager_MixedAirFields::FanInletNodeName, node->handle()));
+  EXPECT_EQ(3u, node->numSources());
+  EXPECT_EQ(2u, node->sources().size());
+  EXPECT_EQ(2u, node->getSources(IddObjectType::OS_SetpointManager_MixedAir).size());
+  EXPECT_TRUE(node->getSources(IddObjectType::OS_Node).empty());
+
+  // sources stay sorted and unique
+  WorkspaceObjectVector sources = node->sources();
+  WorkspaceObjectVector sorted = sources;
+  std::sort(sorted.begin(), sorted.end());
+  EXPECT_TRUE(sources == sorted);
+
+  // moving one of two pointers keeps the source
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::FanInletNodeName, node2->handle()));
+  EXPECT_EQ(2u, node->numSources());
+  EXPECT_EQ(2u, node->sources().size());
+  ASSERT_EQ(1u, node2->sources().size());
+  EXPECT_EQ(spm->handle(), node2->sources()[0].handle());
+
+  // moving the last one drops it
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName, node2->handle()));
+  ASSERT_EQ(1u, node->getSources(IddObjectType::OS_SetpointManager_MixedAir).size());
+  EXPECT_EQ(spm2->handle(), node->getSources(IddObjectType::OS_SetpointManager_MixedAir)[0].handle());
+
+  // removing a source updates the index
+  spm2->remove();
+  EXPECT_EQ(0u, node->numSources());
+  EXPECT_TRUE(node->sources().empty());
+  EXPECT_TRUE(node->getSources(IddObjectType::OS_SetpointManager_MixedAir).empty());
+
+  // clones point to their own objects
+  for (bool keepHandles : {false, true}) {
+    Workspace clone = ws.clone(keepHandles);
+    OptionalWorkspaceObject cloneNode2 = clone.getObjectByTypeAndName(IddObjectType::OS_Node, node2->name().get());
+    ASSERT_TRUE(cloneNode2);
+    WorkspaceObjectVector cloneSources = cloneNode2->getSources(IddObjectType::OS_SetpointManager_MixedAir);
+    ASSERT_EQ(1u, cloneSources.size());
+    EXPECT_TRUE(cloneSources[0].workspace() == clone);
+    EXPECT_EQ(1u, cloneNode2->sources().size());
+    EXPECT_EQ(2u, cloneNode2->numSources());
+  }
+}
+
 TEST_F(IdfFixture, WorkspaceObject_SetDouble_NaN_and_Inf) {
 
   // try with an WorkspaceObject
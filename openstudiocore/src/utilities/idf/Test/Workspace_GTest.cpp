@@ -554,6 +554,28 @@ TEST_F(IdfFixture, Workspace_Clone) {
   EXPECT_FALSE(cloneHandles == wsHandles);
 }
 
+TEST_F(IdfFixture, Workspace_CloneCopyOnWrite) {
+  Workspace workspace(epIdfFile,StrictnessLevel::None);
+  Workspace clone = workspace.clone();
+
+  WorkspaceObjectVector wsZones = workspace.getObjectsByType(IddObjectType::Zone);
+  ASSERT_FALSE(wsZones.empty());
+  WorkspaceObject wsZone = wsZones[0];
+  OptionalWorkspaceObject cloneZone = clone.getObjectByTypeAndName(IddObjectType::Zone,wsZone.name().get());
+  ASSERT_TRUE(cloneZone);
+  EXPECT_EQ(wsZone.getString(ZoneFields::Multiplier,true).get(),
+            cloneZone->getString(ZoneFields::Multiplier,true).get());
+
+  // modifying the clone must not leak into the original, and vice versa
+  EXPECT_TRUE(cloneZone->setString(ZoneFields::Multiplier,"7"));
+  EXPECT_EQ("7",cloneZone->getString(ZoneFields::Multiplier).get());
+  EXPECT_NE("7",wsZone.getString(ZoneFields::Multiplier).get());
+  EXPECT_TRUE(wsZone.setString(ZoneFields::Multiplier,"3"));
+  EXPECT_EQ("7",cloneZone->getString(ZoneFields::Multiplier).get());
+  EXPECT_EQ("3",wsZone.getString(ZoneFields::Multiplier).get());
+  EXPECT_EQ(wsZone.numFields(),cloneZone->numFields());
+}
+
 TEST_F(IdfFixture,Workspace_Insert) {
   Workspace workspace(epIdfFile,StrictnessLevel::None);
   unsigned n = workspace.handles().size();
@@ -88,7 +88,14 @@ namespace detail {
     m_workspace(workspace),
     m_sourceData(other.m_sourceData),
     m_targetData(other.m_targetData)
-  {}
+  {
+    if (m_targetData) {
+      // links refer to other's sources, rebuild on first use
+      m_targetData->sourceLinks.clear();
+      m_targetData->sourceLinksByType.clear();
+      m_targetData->linksValid = false;
+    }
+  }
 
   WorkspaceObject_Impl::~WorkspaceObject_Impl() {}
 
@@ -161,7 +168,7 @@ namespace detail {
           OptionalWorkspaceObject target = workspace().getObject(fp.targetHandle);
           if (target) {
             // need to set reverse pointer
-            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(),fp.fieldIndex);
+            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this,fp.fieldIndex);
             th = fp.targetHandle;
           }
         }
@@ -181,6 +188,7 @@ namespace detail {
         }
       }
       m_targetData->reversePointers = mappedPointers;
+      m_targetData->linksValid = false;
     }
   }
 
@@ -276,14 +284,12 @@ namespace detail {
     WorkspaceObjectVector result;
     if (!initialized()) { return result; }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
-        OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        result.push_back(*owo);
+      // source links are unique and already in WorkspaceObject::operator< order
+      ensureSourceLinks();
+      result.reserve(m_targetData->sourceLinks.size());
+      for (SourceLinkMap::value_type& p : m_targetData->sourceLinks) {
+        result.push_back(WorkspaceObject(resolveSourceLink(p.second)));
       }
-      std::sort(result.begin(), result.end());
-      result.erase(std::unique(result.begin(), result.end()), result.end());
     }
     return result;
   }
@@ -292,14 +298,14 @@ namespace detail {
     WorkspaceObjectVector result;
     if (!initialized()) { return result; }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
-        OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        if (owo->iddObject().type() == type) { result.push_back(*owo); }
+      ensureSourceLinks();
+      auto it = m_targetData->sourceLinksByType.find(type.value());
+      if (it != m_targetData->sourceLinksByType.end()) {
+        result.reserve(it->second.size());
+        for (SourceLinkMap::value_type& p : it->second) {
+          result.push_back(WorkspaceObject(resolveSourceLink(p.second)));
+        }
       }
-      std::sort(result.begin(), result.end());
-      result.erase(std::unique(result.begin(), result.end()), result.end());
     }
     return result;
   }
@@ -989,7 +995,7 @@ namespace detail {
     OptionalWorkspaceObject oTarget = getTarget(index);
     if (oTarget) {
       WorkspaceObject target = *oTarget;
-      target.getImpl<WorkspaceObject_Impl>()->nullifyReversePointer(m_handle,index);
+      target.getImpl<WorkspaceObject_Impl>()->nullifyReversePointer(*this,index);
       // remove forwarded reference if no other source sets the same
       m_workspace->removeForwardedReferences(handle(),index,target);
     }
@@ -1006,24 +1012,51 @@ namespace detail {
   // Pre-condition:  Object sourceHandle points to this object from field index.
   // Post-condition: That information is removed from this object's m_targetData (in preparation for
   //                 a change to the source pointer).
-  void WorkspaceObject_Impl::nullifyReversePointer(const Handle& sourceHandle,unsigned index) {
+  void WorkspaceObject_Impl::nullifyReversePointer(const WorkspaceObject_Impl& source,unsigned index) {
     OS_ASSERT(!m_handle.isNull());
     OS_ASSERT(m_targetData);
-    auto it = m_targetData->reversePointers.find(ReversePointer(sourceHandle,index));
+    auto it = m_targetData->reversePointers.find(ReversePointer(source.handle(),index));
     OS_ASSERT(it != m_targetData->reversePointers.end());
     m_targetData->reversePointers.erase(it);
+
+    if (m_targetData->linksValid) {
+      auto linkIt = m_targetData->sourceLinks.find(&source);
+      OS_ASSERT(linkIt != m_targetData->sourceLinks.end());
+      if (--(linkIt->second.numPointers) == 0) {
+        m_targetData->sourceLinks.erase(linkIt);
+      }
+      auto typeIt = m_targetData->sourceLinksByType.find(source.iddObject().type().value());
+      OS_ASSERT(typeIt != m_targetData->sourceLinksByType.end());
+      linkIt = typeIt->second.find(&source);
+      OS_ASSERT(linkIt != typeIt->second.end());
+      if (--(linkIt->second.numPointers) == 0) {
+        typeIt->second.erase(linkIt);
+        if (typeIt->second.empty()) {
+          m_targetData->sourceLinksByType.erase(typeIt);
+        }
+      }
+    }
   }
 
   // Pre-condition:  ReversePointer(sourceHandle,index) is not in m_targetData.
   // Post-condition: m_targetData indicates that object sourceHandle points to this object from
   //                 field index.
-  void WorkspaceObject_Impl::setReversePointer(const Handle& sourceHandle, unsigned index) {
+  void WorkspaceObject_Impl::setReversePointer(const WorkspaceObject_Impl& source, unsigned index) {
     OS_ASSERT(!m_handle.isNull());
     if (!m_targetData) { m_targetData = TargetData(); }
     // automatically maintains uniqueness
     std::pair<TargetData::pointer_set::iterator,bool> insertResult;
-    insertResult = m_targetData->reversePointers.insert(ReversePointer(sourceHandle,index));
+    insertResult = m_targetData->reversePointers.insert(ReversePointer(source.handle(),index));
     OS_ASSERT(insertResult.second);
+
+    if (m_targetData->linksValid) {
+      SourceLink& link = m_targetData->sourceLinks[&source];
+      link.sourceHandle = source.handle();
+      ++link.numPointers;
+      SourceLink& typeLink = m_targetData->sourceLinksByType[source.iddObject().type().value()][&source];
+      typeLink.sourceHandle = source.handle();
+      ++typeLink.numPointers;
+    }
   }
 
   void WorkspaceObject_Impl::restorePointers() {
@@ -1036,7 +1069,7 @@ namespace detail {
             WorkspaceObjectVector sources = target->getSources(iddObject().type());
             HandleVector h = getHandles<WorkspaceObject>(sources);
             if (std::find(h.begin(),h.end(),m_handle) == h.end()) {
-              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle,ptr.fieldIndex);
+              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this,ptr.fieldIndex);
             }
           }
         }
@@ -1091,7 +1124,7 @@ namespace detail {
     if (!targetHandle.isNull()) {
       OptionalWorkspaceObject target = m_workspace->getObject(targetHandle);
       OS_ASSERT(target);
-      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle,index);
+      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this,index);
       // forward references if is object-list and defines references simultaneously
       m_workspace->forwardReferences(m_handle,index,targetHandle);
     }
@@ -1177,6 +1210,41 @@ namespace detail {
     return true;
   }
 
+  // SOURCE INDEX HELPERS
+
+  void WorkspaceObject_Impl::ensureSourceLinks() const {
+    OS_ASSERT(m_targetData);
+    if (m_targetData->linksValid) { return; }
+    m_targetData->sourceLinks.clear();
+    m_targetData->sourceLinksByType.clear();
+    for (const ReversePointer& ptr : m_targetData->reversePointers) {
+      OS_ASSERT(!ptr.sourceHandle.isNull());
+      OptionalWorkspaceObject owo = m_workspace->getObject(ptr.sourceHandle);
+      OS_ASSERT(owo);
+      std::shared_ptr<WorkspaceObject_Impl> source = owo->getImpl<WorkspaceObject_Impl>();
+      SourceLink& link = m_targetData->sourceLinks[source.get()];
+      link.sourceHandle = ptr.sourceHandle;
+      link.source = source;
+      ++link.numPointers;
+      SourceLink& typeLink = m_targetData->sourceLinksByType[source->iddObject().type().value()][source.get()];
+      typeLink.sourceHandle = ptr.sourceHandle;
+      typeLink.source = source;
+      ++typeLink.numPointers;
+    }
+    m_targetData->linksValid = true;
+  }
+
+  std::shared_ptr<WorkspaceObject_Impl> WorkspaceObject_Impl::resolveSourceLink(SourceLink& link) const {
+    std::shared_ptr<WorkspaceObject_Impl> result = link.source.lock();
+    if (!result) {
+      OptionalWorkspaceObject owo = m_workspace->getObject(link.sourceHandle);
+      OS_ASSERT(owo);
+      result = owo->getImpl<WorkspaceObject_Impl>();
+      link.source = result;
+    }
+    return result;
+  }
+
   // QUERY HELPERS
 
   void WorkspaceObject_Impl::populateValidityReport(ValidityReport& report, bool checkNames) const
@@ -36,6 +36,9 @@
 #include <utilities/idf/IdfObject_Impl.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
 
+#include <map>
+#include <unordered_map>
+
 namespace openstudio {
 
 // forward declarations
@@ -86,30 +89,56 @@ namespace detail {
   };
   typedef std::set<ReversePointer,ReversePointerLess > ReversePointerSet;
 
+  class WorkspaceObject_Impl; // forward declaration
+
+  /** Direct link from a target object to one of its sources. The impl pointer is resolved from
+   *  sourceHandle on first use. */
+  struct UTILITIES_API SourceLink {
+    Handle   sourceHandle;
+    std::weak_ptr<WorkspaceObject_Impl> source;
+    unsigned numPointers; // number of fields in source that point to the target
+
+    SourceLink() : numPointers(0) {}
+  };
+  /** Keyed by the source's impl, which matches the ordering of WorkspaceObject::operator<. */
+  typedef std::map<const WorkspaceObject_Impl*, SourceLink> SourceLinkMap;
+
   struct UTILITIES_API TargetData {
     typedef ReversePointer    pointer_type;
     typedef ReversePointerSet pointer_set;
 
     pointer_set reversePointers;
+
+    // index of reversePointers by source object, overall and by IddObjectType value. rebuilt from
+    // reversePointers when !linksValid (for instance, after cloning).
+    mutable SourceLinkMap sourceLinks;
+    mutable std::unordered_map<int, SourceLinkMap> sourceLinksByType;
+    mutable bool linksValid;
+
+    TargetData() : linksValid(true) {}
   };
   typedef boost::optional<TargetData> OptionalTargetData;
 
+  /** Looks up fieldIndex in a pointer_set ordered by FieldIndexLess (i.e. SourceData). */
   template<class T>
   typename T::pointer_set::iterator getIteratorAtFieldIndex(
                                                             typename T::pointer_set& pointerSet,
                                                             unsigned fieldIndex)
   {
-    return std::find_if(pointerSet.begin(),pointerSet.end(),
-                        std::bind(fieldIndexEqualTo<typename T::pointer_type>,std::placeholders::_1,fieldIndex));
+    typename T::pointer_type key;
+    key.fieldIndex = fieldIndex;
+    return pointerSet.find(key);
   }
 
+  /** Looks up fieldIndex in a pointer_set ordered by FieldIndexLess (i.e. SourceData). */
   template<class T>
   typename T::pointer_set::const_iterator getConstIteratorAtFieldIndex(
                                                                        const typename T::pointer_set& pointerSet,
                                                                        unsigned fieldIndex)
   {
-    return std::find_if(pointerSet.begin(),pointerSet.end(),
-                        std::bind(fieldIndexEqualTo<typename T::pointer_type>,std::placeholders::_1,fieldIndex));
+    typename T::pointer_type key;
+    key.fieldIndex = fieldIndex;
+    return pointerSet.find(key);
   }
 
   class UTILITIES_API WorkspaceObject_Impl : public IdfObject_Impl {
@@ -313,10 +342,10 @@ namespace detail {
     /** Mechanics only exposed to Workspace_Impl for use in object removal. */
     void nullifyPointer(unsigned index);
 
-    void nullifyReversePointer(const Handle& sourceHandle, unsigned index);
+    void nullifyReversePointer(const WorkspaceObject_Impl& source, unsigned index);
 
 
-    void setReversePointer(const Handle& sourceHandle, unsigned index);
+    void setReversePointer(const WorkspaceObject_Impl& source, unsigned index);
 
     /** Called when restoring object because could not remove and retain validity. Double-checks
      *  that companion pointers are in place. May not be able to fix all if multiple objects are
@@ -356,6 +385,14 @@ namespace detail {
 
     void restoreOriginalNumFields(unsigned n);
 
+    // SOURCE INDEX HELPERS
+
+    /** Rebuilds m_targetData's source links from its reverse pointers, if they are out of date. */
+    void ensureSourceLinks() const;
+
+    /** Returns the source object behind link, resolving and caching the impl pointer. */
+    std::shared_ptr<WorkspaceObject_Impl> resolveSourceLink(SourceLink& link) const;
+
     bool popField();
 
     // configure logging
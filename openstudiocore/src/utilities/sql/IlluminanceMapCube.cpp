@@ -0,0 +1,225 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "IlluminanceMapCube.hpp"
+
+#include "../core/Assert.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace openstudio {
+
+IlluminanceMapCube::IlluminanceMapCube()
+{}
+
+IlluminanceMapCube::IlluminanceMapCube(const std::vector<double>& x, const std::vector<double>& y,
+                                       const std::vector<DateTime>& dateTimes, const std::vector<float>& values)
+  : m_x(x), m_y(y), m_dateTimes(dateTimes)
+{
+  const size_t numPoints = m_x.size() * m_y.size();
+  if (values.size() != numPoints * m_dateTimes.size()){
+    LOG_AND_THROW("Illuminance map has " << values.size() << " values for " << m_x.size() << "x" << m_y.size()
+      << " points and " << m_dateTimes.size() << " timesteps");
+  }
+
+  // reorder from one map after another into blocks of timesteps
+  m_values.resize(values.size());
+  for (unsigned t = 0; t < m_dateTimes.size() && numPoints > 0; ++t){
+    const float* map = &values[t * numPoints];
+    for (unsigned point = 0; point < numPoints; ++point){
+      m_values[index(point, t)] = map[point];
+    }
+  }
+}
+
+unsigned IlluminanceMapCube::blockSize()
+{
+  return 256;
+}
+
+const std::vector<double>& IlluminanceMapCube::x() const
+{
+  return m_x;
+}
+
+const std::vector<double>& IlluminanceMapCube::y() const
+{
+  return m_y;
+}
+
+const std::vector<DateTime>& IlluminanceMapCube::dateTimes() const
+{
+  return m_dateTimes;
+}
+
+unsigned IlluminanceMapCube::numPoints() const
+{
+  return m_x.size() * m_y.size();
+}
+
+unsigned IlluminanceMapCube::numTimesteps() const
+{
+  return m_dateTimes.size();
+}
+
+double IlluminanceMapCube::value(unsigned i, unsigned j, unsigned t) const
+{
+  OS_ASSERT(i < m_x.size());
+  OS_ASSERT(j < m_y.size());
+  OS_ASSERT(t < m_dateTimes.size());
+  return m_values[index(i * m_y.size() + j, t)];
+}
+
+Matrix IlluminanceMapCube::map(unsigned t) const
+{
+  OS_ASSERT(t < m_dateTimes.size());
+
+  Matrix result(m_x.size(), m_y.size());
+  for (unsigned i = 0; i < m_x.size(); ++i){
+    for (unsigned j = 0; j < m_y.size(); ++j){
+      result(i, j) = m_values[index(i * m_y.size() + j, t)];
+    }
+  }
+  return result;
+}
+
+Vector IlluminanceMapCube::pointValues(unsigned i, unsigned j) const
+{
+  OS_ASSERT(i < m_x.size());
+  OS_ASSERT(j < m_y.size());
+
+  const unsigned point = i * m_y.size() + j;
+  Vector result(m_dateTimes.size());
+  for (unsigned t = 0; t < m_dateTimes.size(); ++t){
+    result[t] = m_values[index(point, t)];
+  }
+  return result;
+}
+
+Matrix IlluminanceMapCube::mean(const std::vector<bool>& timesteps) const
+{
+  return statistic(timesteps, 0.0,
+    [](double& sum, float value) { sum += value; },
+    [](double sum, unsigned count) { return count > 0 ? sum / count : 0.0; });
+}
+
+Matrix IlluminanceMapCube::minimum(const std::vector<bool>& timesteps) const
+{
+  return statistic(timesteps, std::numeric_limits<double>::max(),
+    [](double& result, float value) { result = std::min<double>(result, value); },
+    [](double result, unsigned count) { return count > 0 ? result : 0.0; });
+}
+
+Matrix IlluminanceMapCube::maximum(const std::vector<bool>& timesteps) const
+{
+  return statistic(timesteps, std::numeric_limits<double>::lowest(),
+    [](double& result, float value) { result = std::max<double>(result, value); },
+    [](double result, unsigned count) { return count > 0 ? result : 0.0; });
+}
+
+Matrix IlluminanceMapCube::fractionAtOrAbove(double threshold, const std::vector<bool>& timesteps) const
+{
+  return statistic(timesteps, 0.0,
+    [threshold](double& n, float value) { n += (value >= threshold ? 1.0 : 0.0); },
+    [](double n, unsigned count) { return count > 0 ? n / count : 0.0; });
+}
+
+Matrix IlluminanceMapCube::fractionBetween(double lower, double upper, const std::vector<bool>& timesteps) const
+{
+  return statistic(timesteps, 0.0,
+    [lower, upper](double& n, float value) { n += ((value >= lower && value < upper) ? 1.0 : 0.0); },
+    [](double n, unsigned count) { return count > 0 ? n / count : 0.0; });
+}
+
+size_t IlluminanceMapCube::index(unsigned point, unsigned t) const
+{
+  // the last block may be shorter than the others
+  const size_t block = t / blockSize();
+  const size_t blockStart = block * blockSize();
+  const size_t blockLength = std::min<size_t>(blockSize(), m_dateTimes.size() - blockStart);
+  return blockStart * numPoints() + point * blockLength + (t - blockStart);
+}
+
+template<typename Accumulate, typename Finish>
+Matrix IlluminanceMapCube::statistic(const std::vector<bool>& timesteps, double init, Accumulate accumulate, Finish finish) const
+{
+  const bool allTimesteps = timesteps.empty();
+  if (!allTimesteps && timesteps.size() != m_dateTimes.size()){
+    LOG_AND_THROW("Timestep filter has " << timesteps.size() << " values for " << m_dateTimes.size() << " timesteps");
+  }
+
+  const unsigned numPoints = this->numPoints();
+  std::vector<double> results(numPoints, init);
+  unsigned count = 0;
+
+  for (size_t blockStart = 0; blockStart < m_dateTimes.size() && numPoints > 0; blockStart += blockSize()){
+    const size_t blockLength = std::min<size_t>(blockSize(), m_dateTimes.size() - blockStart);
+    const float* block = &m_values[blockStart * numPoints];
+
+    if (allTimesteps){
+      count += blockLength;
+      for (unsigned point = 0; point < numPoints; ++point){
+        const float* values = block + point * blockLength;
+        double result = results[point];
+        for (size_t k = 0; k < blockLength; ++k){
+          accumulate(result, values[k]);
+        }
+        results[point] = result;
+      }
+    } else{
+      // unpack the filter once per block
+      std::vector<size_t> included;
+      for (size_t k = 0; k < blockLength; ++k){
+        if (timesteps[blockStart + k]){
+          included.push_back(k);
+        }
+      }
+      count += included.size();
+      for (unsigned point = 0; point < numPoints; ++point){
+        const float* values = block + point * blockLength;
+        double result = results[point];
+        for (size_t k : included){
+          accumulate(result, values[k]);
+        }
+        results[point] = result;
+      }
+    }
+  }
+
+  Matrix result(m_x.size(), m_y.size());
+  for (unsigned i = 0; i < m_x.size(); ++i){
+    for (unsigned j = 0; j < m_y.size(); ++j){
+      result(i, j) = finish(results[i * m_y.size() + j], count);
+    }
+  }
+  return result;
+}
+
+} // openstudio
@@ -0,0 +1,120 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2018, Alliance for Sustainable Energy, LLC. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_ILLUMINANCEMAPCUBE_HPP
+#define UTILITIES_SQL_ILLUMINANCEMAPCUBE_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "../data/Vector.hpp"
+#include "../data/Matrix.hpp"
+#include "../time/DateTime.hpp"
+#include "../core/Logger.hpp"
+
+#include <vector>
+
+namespace openstudio {
+
+/** IlluminanceMapCube holds every hourly report of an illuminance map, as returned by
+ *  SqlFile::illuminanceMapCube.  Values are stored in single precision in blocks of blockSize()
+ *  timesteps, within a block the values of each point are contiguous, so a single map and the
+ *  annual series of a point can both be read without touching the whole cube.  Point (i,j) is
+ *  the point at x(i), y(j) as for SqlFile::illuminanceMap.  The per point statistics take an
+ *  optional vector with one value per timestep telling which timesteps to include, e.g. occupied
+ *  hours, all timesteps are included if it is empty. */
+class UTILITIES_API IlluminanceMapCube {
+ public:
+
+  /// empty cube
+  IlluminanceMapCube();
+
+  /// constructor from axes, dates and values, values holds one map after another with value(i,j)
+  /// at index i*y.size() + j of each map, will throw if sizes do not match
+  IlluminanceMapCube(const std::vector<double>& x, const std::vector<double>& y,
+                     const std::vector<DateTime>& dateTimes, const std::vector<float>& values);
+
+  /// number of timesteps in a storage block
+  static unsigned blockSize();
+
+  /// x position (m) of the illuminance map
+  const std::vector<double>& x() const;
+
+  /// y position (m) of the illuminance map
+  const std::vector<double>& y() const;
+
+  /// date and time of each hourly report
+  const std::vector<DateTime>& dateTimes() const;
+
+  unsigned numPoints() const;
+
+  unsigned numTimesteps() const;
+
+  /// value (lux) at x(i), y(j) and timestep t
+  double value(unsigned i, unsigned j, unsigned t) const;
+
+  /// value (lux) of the illuminance map at timestep t, value(i,j) is the illuminance at x(i), y(j)
+  Matrix map(unsigned t) const;
+
+  /// value (lux) at x(i), y(j) for all timesteps
+  Vector pointValues(unsigned i, unsigned j) const;
+
+  /// mean value (lux) of each point over the included timesteps, value(i,j) is at x(i), y(j)
+  Matrix mean(const std::vector<bool>& timesteps = std::vector<bool>()) const;
+
+  /// minimum value (lux) of each point over the included timesteps, value(i,j) is at x(i), y(j)
+  Matrix minimum(const std::vector<bool>& timesteps = std::vector<bool>()) const;
+
+  /// maximum value (lux) of each point over the included timesteps, value(i,j) is at x(i), y(j)
+  Matrix maximum(const std::vector<bool>& timesteps = std::vector<bool>()) const;
+
+  /// fraction of the included timesteps with a value at or above threshold, e.g. daylight autonomy
+  Matrix fractionAtOrAbove(double threshold, const std::vector<bool>& timesteps = std::vector<bool>()) const;
+
+  /// fraction of the included timesteps with a value at or above lower and below upper, e.g. useful daylight illuminance
+  Matrix fractionBetween(double lower, double upper, const std::vector<bool>& timesteps = std::vector<bool>()) const;
+
+ private:
+
+  REGISTER_LOGGER("openstudio.IlluminanceMapCube");
+
+  size_t index(unsigned point, unsigned t) const;
+
+  // accumulates the included values of each point starting from init, finish is called with the result and the number of included timesteps
+  template<typename Accumulate, typename Finish>
+  Matrix statistic(const std::vector<bool>& timesteps, double init, Accumulate accumulate, Finish finish) const;
+
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<DateTime> m_dateTimes;
+  std::vector<float> m_values;
+};
+
+} // openstudio
+
+#endif // UTILITIES_SQL_ILLUMINANCEMAPCUBE_HPP
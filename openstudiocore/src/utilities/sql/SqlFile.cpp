@@ -1692,6 +1692,24 @@ void SqlFile::illuminanceMap(const int& hourlyReportIndex, std::vector<double>&
   }
 }
 
+boost::optional<IlluminanceMapCube> SqlFile::illuminanceMapCube(const std::string& name) const
+{
+  boost::optional<IlluminanceMapCube> result;
+  if (m_impl){
+    result = m_impl->illuminanceMapCube(name);
+  }
+  return result;
+}
+
+boost::optional<IlluminanceMapCube> SqlFile::illuminanceMapCube(const int& mapIndex) const
+{
+  boost::optional<IlluminanceMapCube> result;
+  if (m_impl){
+    result = m_impl->illuminanceMapCube(mapIndex);
+  }
+  return result;
+}
+
 
 
 // equality test
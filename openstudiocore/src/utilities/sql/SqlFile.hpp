@@ -35,6 +35,7 @@
 #include "SummaryData.hpp"
 #include "SqlFileDataDictionary.hpp"
 #include "SqlFileEnums.hpp"
+#include "IlluminanceMapCube.hpp"
 
 #include "../data/Vector.hpp"
 #include "../data/Matrix.hpp"
@@ -778,6 +779,11 @@ class UTILITIES_API SqlFile {
    *  value(i,j) is the illuminance at x(i), y(j) fills in x,y, illuminance*/
   void illuminanceMap(const int& hourlyReportIndex, std::vector<double>& x, std::vector<double>& y, std::vector<double>& illuminance) const;
 
+  /** all hourly reports of the illuminance map read with a single query, use this rather than
+   *  illuminanceMap for each hourly report when computing annual statistics */
+  boost::optional<IlluminanceMapCube> illuminanceMapCube(const std::string& name) const;
+  boost::optional<IlluminanceMapCube> illuminanceMapCube(const int& mapIndex) const;
+
   /// Returns the summary data for each installlocation and fuel type found in report variables
   std::vector<SummaryData> getSummaryData() const;
 
@@ -8,6 +8,7 @@
   #include <utilities/sql/SqlFile.hpp>
   #include <utilities/sql/SqlFileEnums.hpp>
   #include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
+  #include <utilities/sql/IlluminanceMapCube.hpp>
 
   #include <utilities/units/Unit.hpp>
   #include <utilities/units/BTUUnit.hpp>
@@ -32,6 +33,7 @@
 
 // create an instantiation of the optional classes
 %template(OptionalSqlFile) boost::optional<openstudio::SqlFile>;
+%template(OptionalIlluminanceMapCube) boost::optional<openstudio::IlluminanceMapCube>;
 %template(OptionalEnvironmentType) boost::optional<openstudio::EnvironmentType>;
 %template(OptionalReportingFrequency) boost::optional<openstudio::ReportingFrequency>;
 %template(OptionalKeyValueIdentifier) boost::optional<openstudio::KeyValueIdentifier>;
@@ -44,6 +46,7 @@
 
 %template(SqlTimeSeriesQueryVector) std::vector<openstudio::SqlFileTimeSeriesQuery>;
 
+%include <utilities/sql/IlluminanceMapCube.hpp>
 %include <utilities/sql/SqlFile.hpp>
 %include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
 %include <utilities/sql/SqlFileEnums.hpp>
@@ -3594,6 +3594,110 @@ namespace openstudio{
       return illuminance;
     }
 
+    boost::optional<IlluminanceMapCube> SqlFile_Impl::illuminanceMapCube(const std::string& name) const
+    {
+      boost::optional<int> mapIndex = illuminanceMapIndex(name);
+      if (!mapIndex){
+        LOG(Error, "Unknown illuminance map '" << name << "'");
+        return boost::none;
+      }
+      return illuminanceMapCube(*mapIndex);
+    }
+
+    boost::optional<IlluminanceMapCube> SqlFile_Impl::illuminanceMapCube(const int& mapIndex) const
+    {
+      std::vector<double> x;
+      std::vector<double> y;
+      std::vector<DateTime> dateTimes;
+      std::vector<float> values;
+
+      // every report of the map has the same points, the axes are taken from the first report
+      // and the points of later reports are checked against them
+      std::vector<double> pointX;
+      std::vector<double> pointY;
+      int currentReportIndex = 0;
+      size_t point = 0;
+      bool ok = true;
+
+      std::stringstream s;
+      s << "select r.HourlyReportIndex, r.Month, r.DayOfMonth, r.Hour, d.X, d.Y, d.Illuminance"
+        << " from daylightmaphourlyreports r inner join daylightmaphourlydata d on d.HourlyReportIndex = r.HourlyReportIndex"
+        << " where r.MapNumber=" << mapIndex
+        << " order by r.HourlyReportIndex asc, d.X asc, d.Y asc";
+
+      sqlite3_stmt* sqlStmtPtr;
+
+      int code = sqlite3_prepare_v2(m_db, s.str().c_str(),-1,&sqlStmtPtr,nullptr);
+      code = sqlite3_step(sqlStmtPtr);
+      while (code == SQLITE_ROW)
+      {
+        int reportIndex = sqlite3_column_int(sqlStmtPtr,0);
+        double xVal = sqlite3_column_double(sqlStmtPtr,4);
+        double yVal = sqlite3_column_double(sqlStmtPtr,5);
+
+        if (dateTimes.empty() || reportIndex != currentReportIndex){
+          if (!dateTimes.empty() && point != pointX.size()){
+            LOG(Error, "Hourly report " << currentReportIndex << " of illuminance map " << mapIndex << " has " << point
+                << " points, expected " << pointX.size());
+            ok = false;
+            break;
+          }
+
+          // DLM: potential leap year problem
+          // DLM: get standard time zone?
+          dateTimes.push_back(DateTime(Date(monthOfYear(sqlite3_column_int(sqlStmtPtr,1)), sqlite3_column_int(sqlStmtPtr,2)),
+                                       Time(0, sqlite3_column_int(sqlStmtPtr,3), 0, 0)));
+          currentReportIndex = reportIndex;
+          point = 0;
+        }
+
+        if (dateTimes.size() == 1){
+          pointX.push_back(xVal);
+          pointY.push_back(yVal);
+        } else if (point >= pointX.size() || pointX[point] != xVal || pointY[point] != yVal){
+          LOG(Error, "Hourly report " << currentReportIndex << " of illuminance map " << mapIndex << " has different points than the first report");
+          ok = false;
+          break;
+        }
+
+        values.push_back(static_cast<float>(sqlite3_column_double(sqlStmtPtr,6)));
+        ++point;
+
+        // step to next row
+        code = sqlite3_step(sqlStmtPtr);
+      }
+
+      /// must finalize to prevent memory leaks
+      sqlite3_finalize(sqlStmtPtr);
+
+      if (!ok){
+        return boost::none;
+      }
+
+      if (!dateTimes.empty() && point != pointX.size()){
+        LOG(Error, "Hourly report " << currentReportIndex << " of illuminance map " << mapIndex << " has " << point
+            << " points, expected " << pointX.size());
+        return boost::none;
+      }
+
+      // points are ordered by x then y
+      for (size_t i = 0; i < pointX.size(); ++i){
+        if (x.empty() || pointX[i] != x.back()){
+          x.push_back(pointX[i]);
+        }
+        if (x.size() == 1){
+          y.push_back(pointY[i]);
+        }
+      }
+
+      if (x.size() * y.size() != pointX.size()){
+        LOG(Error, "Illuminance map " << mapIndex << " is not a regular grid");
+        return boost::none;
+      }
+
+      return IlluminanceMapCube(x, y, dateTimes, values);
+    }
+
     // find the illuminance map index by name
     boost::optional<int> SqlFile_Impl::illuminanceMapIndex(const std::string& name) const
     {
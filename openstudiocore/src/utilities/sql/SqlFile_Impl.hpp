@@ -35,6 +35,7 @@
 #include <sqlite/sqlite3.h>
 #include "SummaryData.hpp"
 #include "SqlFileEnums.hpp"
+#include "IlluminanceMapCube.hpp"
 #include "SqlFileDataDictionary.hpp"
 #include "../data/DataEnums.hpp"
 #include "../data/EndUses.hpp"
@@ -738,6 +739,10 @@ namespace openstudio{
       /// value(i,j) is the illuminance at x(i), y(j) - returns x, y and illuminance
       void illuminanceMap(const int& hourlyReportIndex, std::vector<double>& x, std::vector<double>& y, std::vector<double>& illuminance) const  ;
 
+      /// all hourly reports of the illuminance map read with a single query
+      boost::optional<IlluminanceMapCube> illuminanceMapCube(const std::string& name) const;
+      boost::optional<IlluminanceMapCube> illuminanceMapCube(const int& mapIndex) const;
+
       // execute a statement and return the first (if any) value as a double
       boost::optional<double> execAndReturnFirstDouble(const std::string& statement) const;
 
@@ -39,6 +39,9 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <algorithm>
+#include <limits>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -226,6 +229,127 @@ TEST_F(IlluminanceMapFixture, IlluminanceMapPlotSeriesOpt)
   }
 }
 
+TEST_F(IlluminanceMapFixture, IlluminanceMapCube)
+{
+  const std::string& mapName = "CLASSROOM ILLUMINANCE MAP";
+
+  boost::optional<IlluminanceMapCube> cube = sqlFile.illuminanceMapCube(mapName);
+  ASSERT_TRUE(cube);
+  ASSERT_EQ(9u, cube->x().size());
+  ASSERT_EQ(9u, cube->y().size());
+  ASSERT_EQ(81u, cube->numPoints());
+  ASSERT_EQ(4760u, cube->numTimesteps());
+
+  EXPECT_NEAR(-8.2296, cube->x()[0], 0.00001);
+  EXPECT_NEAR(-0.9144, cube->x()[8], 0.00001);
+  EXPECT_NEAR(-8.2296, cube->y()[0], 0.00001);
+  EXPECT_NEAR(-0.9144, cube->y()[8], 0.00001);
+
+  // same dates and maps as the per report interface
+  std::vector< std::pair<int, DateTime> > reportIndicesDates = sqlFile.illuminanceMapHourlyReportIndicesDates(mapName);
+  ASSERT_EQ(reportIndicesDates.size(), cube->numTimesteps());
+  for (unsigned t = 0; t < cube->numTimesteps(); t += 500){
+    EXPECT_EQ(reportIndicesDates[t].second, cube->dateTimes()[t]);
+
+    Matrix map = sqlFile.illuminanceMap(reportIndicesDates[t].first);
+    Matrix cubeMap = cube->map(t);
+    ASSERT_EQ(map.size1(), cubeMap.size1());
+    ASSERT_EQ(map.size2(), cubeMap.size2());
+    for (unsigned i = 0; i < map.size1(); ++i){
+      for (unsigned j = 0; j < map.size2(); ++j){
+        EXPECT_NEAR(map(i, j), cubeMap(i, j), 1.0e-6 * std::max(1.0, map(i, j)));
+      }
+    }
+  }
+
+  // annual statistics match the yearly min and max
+  Matrix minimum = cube->minimum();
+  Matrix maximum = cube->maximum();
+  Matrix mean = cube->mean();
+  Matrix all = cube->fractionAtOrAbove(0.0);
+  double minValue = std::numeric_limits<double>::max();
+  double maxValue = std::numeric_limits<double>::lowest();
+  for (unsigned i = 0; i < 9; ++i){
+    for (unsigned j = 0; j < 9; ++j){
+      minValue = std::min(minValue, minimum(i, j));
+      maxValue = std::max(maxValue, maximum(i, j));
+      EXPECT_LE(minimum(i, j), mean(i, j));
+      EXPECT_GE(maximum(i, j), mean(i, j));
+      EXPECT_DOUBLE_EQ(1.0, all(i, j));
+    }
+  }
+  EXPECT_EQ(0, minValue);
+  EXPECT_EQ(3648, maxValue);
+
+  EXPECT_FALSE(sqlFile.illuminanceMapCube("NOT A MAP"));
+}
+
+TEST_F(IlluminanceMapFixture, IlluminanceMapCubeStatistics)
+{
+  std::vector<double> x = {0.0, 1.0};
+  std::vector<double> y = {0.0, 1.0, 2.0};
+
+  // more timesteps than one block
+  const unsigned numTimesteps = IlluminanceMapCube::blockSize() * 2 + 10;
+  std::vector<DateTime> dateTimes;
+  std::vector<float> values;
+  std::vector<bool> odd;
+  DateTime start(Date(MonthOfYear::Jan, 1));
+  for (unsigned t = 0; t < numTimesteps; ++t){
+    dateTimes.push_back(start + Time(0, t + 1));
+    odd.push_back(t % 2 == 1);
+    for (unsigned i = 0; i < x.size(); ++i){
+      for (unsigned j = 0; j < y.size(); ++j){
+        values.push_back(static_cast<float>(100 * i + 10 * j + (t % 2)));
+      }
+    }
+  }
+
+  IlluminanceMapCube cube(x, y, dateTimes, values);
+  ASSERT_EQ(6u, cube.numPoints());
+  ASSERT_EQ(numTimesteps, cube.numTimesteps());
+
+  for (unsigned t = 0; t < numTimesteps; ++t){
+    Matrix map = cube.map(t);
+    for (unsigned i = 0; i < x.size(); ++i){
+      for (unsigned j = 0; j < y.size(); ++j){
+        ASSERT_EQ(100 * i + 10 * j + (t % 2), map(i, j));
+        ASSERT_EQ(map(i, j), cube.value(i, j, t));
+      }
+    }
+  }
+
+  Vector series = cube.pointValues(1, 2);
+  ASSERT_EQ(numTimesteps, series.size());
+  EXPECT_EQ(120, series[0]);
+  EXPECT_EQ(121, series[numTimesteps - 1]);
+
+  Matrix mean = cube.mean();
+  Matrix oddMean = cube.mean(odd);
+  Matrix minimum = cube.minimum();
+  Matrix maximum = cube.maximum();
+  Matrix above = cube.fractionAtOrAbove(101);
+  Matrix between = cube.fractionBetween(10, 21);
+  for (unsigned i = 0; i < x.size(); ++i){
+    for (unsigned j = 0; j < y.size(); ++j){
+      double base = 100 * i + 10 * j;
+      EXPECT_DOUBLE_EQ(base + 0.5, mean(i, j));
+      EXPECT_DOUBLE_EQ(base + 1, oddMean(i, j));
+      EXPECT_DOUBLE_EQ(base, minimum(i, j));
+      EXPECT_DOUBLE_EQ(base + 1, maximum(i, j));
+    }
+  }
+  EXPECT_DOUBLE_EQ(0.0, above(0, 2));
+  EXPECT_DOUBLE_EQ(0.5, above(1, 0));
+  EXPECT_DOUBLE_EQ(1.0, above(1, 1));
+  EXPECT_DOUBLE_EQ(0.0, between(0, 0));
+  EXPECT_DOUBLE_EQ(1.0, between(0, 1));
+  EXPECT_DOUBLE_EQ(0.5, between(0, 2));
+
+  EXPECT_THROW(cube.mean(std::vector<bool>(3, true)), std::exception);
+  EXPECT_THROW(IlluminanceMapCube(x, y, dateTimes, std::vector<float>(5)), std::exception);
+}
+
 TEST_F(IlluminanceMapFixture, IlluminanceMapMatrixBaseline)
 {
   if (!Application::instance().hasApplication()){